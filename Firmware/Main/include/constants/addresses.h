@@ -17,15 +17,42 @@
  */
 #define CONSTANTS_ADDRESSES_MAIN_FONT_BASE_ADDRESS 0
 
+/**
+ * Main font (metrics table and rasters) must fit into this size
+ */
+#define CONSTANTS_ADDRESSES_MAIN_FONT_SIZE 983040
+
 /**
  * Localization config base address
  */
-#define CONSTANTS_ADDRESSES_LOCALIZATION_CONFIG_BASE_ADDRESS 65536
+#define CONSTANTS_ADDRESSES_LOCALIZATION_CONFIG_BASE_ADDRESS 983040
 
 /**
  * Bluetooth config base address
  */
-#define CONSTANTS_ADDRESSES_BLUETOOTH_CONFIG_BASE_ADDRESS 70000
+#define CONSTANTS_ADDRESSES_BLUETOOTH_CONFIG_BASE_ADDRESS 1015808
+
+/**
+ * Off-screen layers storage base address
+ */
+#define CONSTANTS_ADDRESSES_LAYERS_BASE_ADDRESS 1048576
+
+/**
+ * Off-screen layers storage size
+ */
+#define CONSTANTS_ADDRESSES_LAYERS_SIZE 1048576
+
+/**
+ * Measurements history (time series) base addresses
+ */
+#define CONSTANTS_ADDRESSES_TEMPERATURE_HISTORY_BASE_ADDRESS 2097152
+#define CONSTANTS_ADDRESSES_HUMIDITY_HISTORY_BASE_ADDRESS 3145728
+#define CONSTANTS_ADDRESSES_PRESSURE_HISTORY_BASE_ADDRESS 4194304
+
+/**
+ * Each measurements history size
+ */
+#define CONSTANTS_ADDRESSES_HISTORY_SIZE 1048576
 
 
 #endif /* INCLUDE_CONSTANTS_ADDRESSES_H_ */
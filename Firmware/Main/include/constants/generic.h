@@ -15,14 +15,35 @@
  */
 
 /**
- * If set to true, e-ink display will do periodic full refreshes
+ * E-ink display tile (80x60 pixels) is cleaned from ghosting after this count of its pixels were toggled by partial updates.
+ * 0 - never clean
  */
-#define CONSTANTS_GENERIC_IS_DO_PERIODIC_FULL_REFRESH false
+#define CONSTANTS_GENERIC_DISPLAY_TILE_GHOSTING_BUDGET 20000
 
 /**
- * How often to do full refresh if enabled (in frames)
+ * If at least this count of tiles (out of 25) must be cleaned, full refresh is done instead
  */
-#define CONSTANTS_GENERIC_PERIODIC_FULL_REFRESH_PERIOD 10
+#define CONSTANTS_GENERIC_DISPLAY_FULL_REFRESH_TILES_COUNT 10
+
+/**
+ * When display is idle, tiles which spent at least this percent of ghosting budget are cleaned
+ */
+#define CONSTANTS_GENERIC_DISPLAY_IDLE_CLEANING_PERCENT 25
+
+/**
+ * Display is idle if nothing was drawn during this time (milliseconds)
+ */
+#define CONSTANTS_GENERIC_DISPLAY_IDLE_TIMEOUT 60000
+
+/**
+ * Main font characters, which are redrawn on each measurement, their rasters are kept in SRAM. UTF-8 encoded
+ */
+#define CONSTANTS_GENERIC_MAIN_FONT_PINNED_CHARACTERS "0123456789.,-%°C"
+
+/**
+ * Local sensor latest values are read with this interval (milliseconds)
+ */
+#define CONSTANTS_GENERIC_LOCAL_SENSOR_POLL_INTERVAL 10000
 
 
 #endif /* INCLUDE_CONSTANTS_GENERIC_H_ */
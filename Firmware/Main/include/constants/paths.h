@@ -27,4 +27,9 @@
  */
 #define CONSTANTS_PATHS_BLUETOOTH_CONFIG "/System/Configs/bluetooth.config"
 
+/**
+ * Display fast refresh waveforms for temperature bands (optional)
+ */
+#define CONSTANTS_PATHS_DISPLAY_WAVEFORMS "/System/Display/waveforms.bin"
+
 #endif /* INCLUDE_CONSTANTS_PATHS_H_ */
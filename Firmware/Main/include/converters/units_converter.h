@@ -10,16 +10,46 @@
 
 #define ZERO_CELSIUS_IN_KELVINS (273.15)
 
+#define ZERO_CELSIUS_IN_CENTIKELVINS 27315
+
+/**
+ * Fixed-point sensor output scales: humidity is Q22.10 percents, pressure is Q24.8 Pascals
+ */
+#define FIXED_POINT_HUMIDITY_SCALE 1024.0f
+#define FIXED_POINT_PRESSURE_SCALE 256.0f
+
+#include <stdint.h>
+
 /**
  * Convert temperature from Kelvins to Celsius
  */
 double TemperatureKelvinsToCelsius(double kelvins);
 
+/**
+ * Convert temperature from hundredths of Kelvin (fixed-point sensor output) to Celsius
+ */
+float TemperatureCentikelvinsToCelsius(int32_t centikelvins);
+
+/**
+ * Convert temperature from hundredths of Kelvin to Kelvins
+ */
+float TemperatureCentikelvinsToKelvins(int32_t centikelvins);
+
 /**
  * Convert temperature from Kelvins to Fahrenheits
  */
 double TemperatureKelvinsToFahrenheits(double kelvins);
 
+/**
+ * Convert temperature from hundredths of Kelvin to Fahrenheits
+ */
+float TemperatureCentikelvinsToFahrenheits(int32_t centikelvins);
+
+/**
+ * Convert humidity from Q22.10 fixed-point percents to percents
+ */
+float HumidityFixedPointToPercents(uint32_t humidity);
+
 /**
  * Convert pressure from Pascals to mmHg
  */
@@ -35,4 +65,19 @@ double PressurePascalsToHPa(double pascals);
  */
 double PressurePascalsToInHg(double pascals);
 
+/**
+ * Convert pressure from Q24.8 fixed-point Pascals to mmHg
+ */
+float PressureFixedPointToMmHg(uint32_t pressure);
+
+/**
+ * Convert pressure from Q24.8 fixed-point Pascals to hPa
+ */
+float PressureFixedPointToHPa(uint32_t pressure);
+
+/**
+ * Convert pressure from Q24.8 fixed-point Pascals to inHg
+ */
+float PressureFixedPointToInHg(uint32_t pressure);
+
 #endif /* INCLUDE_CONVERTERS_UNITS_CONVERTER_H_ */
@@ -0,0 +1,82 @@
+/*
+ * waveforms.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Shakti
+ */
+
+#ifndef INCLUDE_DISPLAY_WAVEFORMS_H_
+#define INCLUDE_DISPLAY_WAVEFORMS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../libs/l2hal/l2hal_config.h"
+
+/**
+ * Don't reload waveform while temperature is within this distance (Celsius) from current band
+ */
+#define WAVEFORMS_HYSTERESIS 1.0f
+
+/**
+ * Waveforms file consists of such records. Band is [MinTemperature; MaxTemperature), Celsius
+ */
+typedef struct
+{
+	int8_t MinTemperature;
+
+	int8_t MaxTemperature;
+
+	uint8_t Waveform[L2HAL_SSD1683_WAVEFORM_SIZE];
+}
+WaveformsRecordStruct;
+
+/**
+ * Fast refresh waveforms for different temperatures
+ */
+typedef struct
+{
+	/**
+	 * Waveforms file
+	 */
+	char* Path;
+
+	/**
+	 * If false, there is no waveforms file and display uses OTP waveforms only
+	 */
+	bool IsAvailable;
+
+	/**
+	 * If true, Current contains waveform for current temperature
+	 */
+	bool IsBandLoaded;
+
+	/**
+	 * If true, waveforms file was searched for SearchedTemperature. If no band was found for it, file isn't searched again
+	 * till temperature changes by more than WAVEFORMS_HYSTERESIS
+	 */
+	bool IsSearched;
+
+	/**
+	 * Temperature of last search (Celsius)
+	 */
+	float SearchedTemperature;
+
+	/**
+	 * Currently used record. Display partial waveform points here, so it is changed only when new band is found
+	 */
+	WaveformsRecordStruct Current;
+
+} WaveformsContextStruct;
+
+/**
+ * Initialize waveforms, stored in given file. File is optional
+ */
+WaveformsContextStruct WaveformsInit(char* path);
+
+/**
+ * Pass ambient temperature (Celsius) to display and select partial update waveform for it.
+ * If there is no waveform for given temperature, OTP one will be used
+ */
+void WaveformsSelectByTemperature(WaveformsContextStruct* context, L2HAL_SSD1683_ContextStruct* display, float temperature);
+
+#endif /* INCLUDE_DISPLAY_WAVEFORMS_H_ */
@@ -11,7 +11,10 @@
 #include "../libs/l2hal/l2hal_config.h"
 #include "../libs/fatfs/ff.h"
 #include "localization/localizator.h"
+#include "display/waveforms.h"
+#include "measurements/time_series.h"
 #include "../libs/l2hal/fmgl/console/include/console.h"
+#include "../libs/l2hal/fmgl/layers/include/layers.h"
 #include "bluetooth/bluetooth.h"
 
 /* Put global variables (like contexts) here */
@@ -61,6 +64,11 @@ L2HAL_LY68L6400_ContextStruct RamContext;
  */
 L2HAL_SSD1683_ContextStruct DisplayContext;
 
+/**
+ * Display back buffer (copy of shown image), FMGL can draw into framebuffer while display is refreshing
+ */
+uint8_t DisplayBackBuffer[L2HAL_SSD1683_FRAMEBUFFER_SIZE];
+
 /**
  * FMGL context.
  */
@@ -96,6 +104,11 @@ FMGL_API_FontSettings MainFont;
  */
 I2C_HandleTypeDef I2C1_Handle = { 0 };
 
+/**
+ * I2C1 RX DMA handle
+ */
+DMA_HandleTypeDef I2C1RxDmaHandle = { 0 };
+
 /**
  * Local sensor
  */
@@ -106,11 +119,28 @@ L2HAL_BME280_I2C_ContextStruct LocalSensor;
  */
 LocalizationContextStruct LocalizationContext;
 
+/**
+ * Display waveforms context
+ */
+WaveformsContextStruct Waveforms;
+
+/**
+ * Local sensor measurements history
+ */
+TimeSeriesContextStruct TemperatureHistory;
+TimeSeriesContextStruct HumidityHistory;
+TimeSeriesContextStruct PressureHistory;
+
 /**
  * Console
  */
 FMGL_Console_ContextStruct Console;
 
+/**
+ * Off-screen layers are allocated here
+ */
+FMGL_Layers_StorageStruct LayersStorage;
+
 /**
  * UART1 Handle
  */
@@ -53,6 +53,7 @@
  **********************/
 #define HAL_DISPLAY_BUSY_PORT GPIOB
 #define HAL_DISPLAY_BUSY_PIN GPIO_PIN_0
+#define HAL_DISPLAY_BUSY_IRQ EXTI0_IRQn
 
 #define HAL_DISPLAY_RESET_PORT GPIOB
 #define HAL_DISPLAY_RESET_PIN GPIO_PIN_1
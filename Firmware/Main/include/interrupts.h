@@ -31,10 +31,16 @@ void DMA1_Stream4_IRQHandler(void);
 /* SPI2 DMA RX complete */
 void DMA1_Stream3_IRQHandler(void);
 
+/* Display BUSY falling edge */
+void EXTI0_IRQHandler(void);
+
 /* I2C1 */
 void I2C1_EV_IRQHandler(void);
 void I2C1_ER_IRQHandler(void);
 
+/* I2C1 DMA RX complete */
+void DMA1_Stream0_IRQHandler(void);
+
 /* UART1 */
 void USART1_IRQHandler(void);
 
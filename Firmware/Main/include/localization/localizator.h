@@ -73,6 +73,11 @@ void LocalizatorSetPressureUnit(LocalizationContextStruct* context, enum LOCALIZ
  */
 double LocalizatorGetLocalizedTemperature(LocalizationContextStruct* context, double t);
 
+/**
+ * Convert temperature from hundredths of Kelvin (fixed-point sensor output) to local format
+ */
+float LocalizatorGetLocalizedFixedPointTemperature(LocalizationContextStruct* context, int32_t t);
+
 /**
  * Get localized temperature unit (like K, C or F)
  */
@@ -88,6 +93,11 @@ char* LocalizatorGetLocalizedTemperaturePrecisionTemplate(LocalizationContextStr
  */
 double LocalizatorGetLocalizedPressure(LocalizationContextStruct* context, double p);
 
+/**
+ * Convert pressure from Q24.8 fixed-point Pascals (sensor output) to local format
+ */
+float LocalizatorGetLocalizedFixedPointPressure(LocalizationContextStruct* context, uint32_t p);
+
 /**
  * Get localized pressure unit (like mmHg, hPa or inHg)
  */
@@ -12,12 +12,15 @@
 #include "hal.h"
 #include "filesystem.h"
 #include "localization/localizator.h"
+#include "display/waveforms.h"
+#include "measurements/time_series.h"
 #include "configuration/config_reader_writer.h"
 #include "constants/generic.h"
 #include "constants/paths.h"
 #include "constants/addresses.h"
 #include "bluetooth/bluetooth.h"
 #include "packets_processor/low_level_packets_processor.h"
+#include "../libs/l2hal/fmgl/widgets/include/widgets.h"
 
 /**
  * Called every SysTick, executed in interrupt context
@@ -27,6 +30,47 @@ void OnSysTick(void);
 volatile bool IsNewPacketReceived = false;
 volatile uint8_t PacketPayload[255];
 
+/**
+ * Local sensor asynchronous reading results
+ */
+volatile bool IsLocalSensorMeasurementCompleted = false;
+volatile L2HAL_BME280_I2C_RawMeasurementsStruct LocalSensorRawMeasurements;
+
+/**
+ * Milliseconds left till next local sensor measurement
+ */
+volatile uint32_t LocalSensorPollTimeLeft = 0;
+
+/**
+ * Seconds since startup (measurements history timestamps). HAL tick overflows in 49 days, so we count seconds separately
+ */
+volatile uint32_t Uptime = 0;
+volatile uint16_t UptimeMilliseconds = 0;
+
+/**
+ * Called when local sensor asynchronous measurement is completed, executed in interrupt context
+ */
+void OnLocalSensorMeasurementCompleted(L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements);
+
+/**
+ * Dashboard, showing local sensor measurements
+ */
+FMGL_Widgets_ScreenStruct Dashboard;
+FMGL_Widgets_WidgetStruct TemperatureWidget;
+FMGL_Widgets_WidgetStruct HumidityWidget;
+FMGL_Widgets_WidgetStruct PressureWidget;
+
+/**
+ * Create dashboard widgets, one line per measurement. Widgets are empty till first UpdateDashboard() call
+ */
+void InitDashboard(void);
+
+/**
+ * Show local sensor measurements (fixed-point, as returned by L2HAL_BME280_I2C_GetFixedPointValues()) on dashboard.
+ * Only changed lines are redrawn and pushed to display
+ */
+void UpdateDashboard(L2HAL_BME280_I2C_FixedPointMeasurementsStruct values);
+
 /**
  * For test purposes
  */
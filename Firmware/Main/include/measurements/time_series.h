@@ -0,0 +1,230 @@
+/*
+ * time_series.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Shakti
+ */
+
+#ifndef INCLUDE_MEASUREMENTS_TIME_SERIES_H_
+#define INCLUDE_MEASUREMENTS_TIME_SERIES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Tiers capacities (records). Raw tier keeps a day of samples, taken each 10 seconds
+ */
+#define TIME_SERIES_RAW_CAPACITY 8640U
+#define TIME_SERIES_MINUTE_CAPACITY 10080U /* 7 days */
+#define TIME_SERIES_HOUR_CAPACITY 8760U /* 1 year */
+#define TIME_SERIES_DAY_CAPACITY 3650U /* 10 years */
+
+/**
+ * Aggregation periods in seconds
+ */
+#define TIME_SERIES_MINUTE_PERIOD 60U
+#define TIME_SERIES_HOUR_PERIOD 3600U
+#define TIME_SERIES_DAY_PERIOD 86400U
+
+/**
+ * All columns elements are 4-bytes long
+ */
+#define TIME_SERIES_ELEMENT_SIZE 4U
+
+/**
+ * Raw tier keeps timestamp and value only, aggregated tiers - all columns
+ */
+#define TIME_SERIES_RAW_COLUMNS_COUNT 2U
+#define TIME_SERIES_AGGREGATED_COLUMNS_COUNT 5U
+
+/**
+ * External memory, required for one time series
+ */
+#define TIME_SERIES_SIZE \
+	(TIME_SERIES_ELEMENT_SIZE * \
+	(TIME_SERIES_RAW_COLUMNS_COUNT * TIME_SERIES_RAW_CAPACITY \
+	+ TIME_SERIES_AGGREGATED_COLUMNS_COUNT * (TIME_SERIES_MINUTE_CAPACITY + TIME_SERIES_HOUR_CAPACITY + TIME_SERIES_DAY_CAPACITY)))
+
+/**
+ * Tiers
+ */
+enum TIME_SERIES_TIER
+{
+	TIME_SERIES_TIER_RAW = 0,
+	TIME_SERIES_TIER_MINUTE = 1,
+	TIME_SERIES_TIER_HOUR = 2,
+	TIME_SERIES_TIER_DAY = 3
+};
+
+#define TIME_SERIES_TIERS_COUNT 4U
+
+/**
+ * Columns. Each column of tier is stored contiguously in external memory
+ */
+enum TIME_SERIES_COLUMN
+{
+	/**
+	 * Sample time or aggregation period start time (uint32_t, seconds)
+	 */
+	TIME_SERIES_COLUMN_TIMESTAMP = 0,
+
+	/**
+	 * Sample value or mean value for aggregation period (int32_t)
+	 */
+	TIME_SERIES_COLUMN_MEAN = 1,
+
+	/**
+	 * Minimal value for aggregation period (int32_t), for raw tier it's sample value
+	 */
+	TIME_SERIES_COLUMN_MIN = 2,
+
+	/**
+	 * Maximal value for aggregation period (int32_t), for raw tier it's sample value
+	 */
+	TIME_SERIES_COLUMN_MAX = 3,
+
+	/**
+	 * Samples count in aggregation period (uint32_t), not available for raw tier
+	 */
+	TIME_SERIES_COLUMN_COUNT = 4
+};
+
+/**
+ * One tier - ring buffer of records
+ */
+typedef struct
+{
+	/**
+	 * Tier base address in external memory
+	 */
+	uint32_t BaseAddress;
+
+	/**
+	 * Maximal records count
+	 */
+	uint32_t Capacity;
+
+	/**
+	 * Aggregation period in seconds, 0 for raw tier
+	 */
+	uint32_t Period;
+
+	/**
+	 * Physical index of oldest record
+	 */
+	uint32_t Head;
+
+	/**
+	 * Records count
+	 */
+	uint32_t Count;
+
+	/**
+	 * Currently aggregated period start time
+	 */
+	uint32_t BucketTimestamp;
+
+	/**
+	 * Currently aggregated period minimal value
+	 */
+	int32_t BucketMin;
+
+	/**
+	 * Currently aggregated period maximal value
+	 */
+	int32_t BucketMax;
+
+	/**
+	 * Currently aggregated period values sum
+	 */
+	int64_t BucketSum;
+
+	/**
+	 * Currently aggregated period samples count, period is written to external memory when next period starts
+	 */
+	uint32_t BucketCount;
+
+} TimeSeriesTierStruct;
+
+/**
+ * Time series context
+ */
+typedef struct
+{
+	/**
+	 * External RAM driver context
+	 */
+	void* MemoryDriverContext;
+
+	/**
+	 * External RAM read function
+	 */
+	void (*MemoryReadFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*);
+
+	/**
+	 * External RAM write function
+	 */
+	void (*MemoryWriteFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*);
+
+	/**
+	 * Tiers, indexed by enum TIME_SERIES_TIER
+	 */
+	TimeSeriesTierStruct Tiers[TIME_SERIES_TIERS_COUNT];
+
+	/**
+	 * Latest sample timestamp, samples must be added in chronological order
+	 */
+	uint32_t LastTimestamp;
+
+} TimeSeriesContextStruct;
+
+/**
+ * Initialize empty time series, occupying TIME_SERIES_SIZE bytes of external memory (must fit into given size)
+ */
+TimeSeriesContextStruct TimeSeriesInit
+(
+	uint32_t baseAddress,
+	uint32_t size,
+	void* memoryDriverContext,
+	void (*memoryReadFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*),
+	void (*memoryWriteFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*)
+);
+
+/**
+ * Add sample. Aggregated tiers are updated, finished aggregation periods are written to external memory
+ */
+void TimeSeriesAdd(TimeSeriesContextStruct* context, uint32_t timestamp, int32_t value);
+
+/**
+ * Records count in given tier
+ */
+uint32_t TimeSeriesGetCount(TimeSeriesContextStruct* context, enum TIME_SERIES_TIER tier);
+
+/**
+ * Find records with timestamps within [from; to] in given tier (binary search, O(log n) external memory reads).
+ * Returns records count, index of first found record (0 - oldest record in tier) is returned via firstIndex
+ */
+uint32_t TimeSeriesFindRange
+(
+	TimeSeriesContextStruct* context,
+	enum TIME_SERIES_TIER tier,
+	uint32_t from,
+	uint32_t to,
+	uint32_t* firstIndex
+);
+
+/**
+ * Read count elements of column, starting from firstIndex (0 - oldest record in tier), into buffer
+ * (count * TIME_SERIES_ELEMENT_SIZE bytes). Column is read by at most two contiguous external memory reads
+ */
+void TimeSeriesReadColumn
+(
+	TimeSeriesContextStruct* context,
+	enum TIME_SERIES_TIER tier,
+	enum TIME_SERIES_COLUMN column,
+	uint32_t firstIndex,
+	uint32_t count,
+	void* buffer
+);
+
+#endif /* INCLUDE_MEASUREMENTS_TIME_SERIES_H_ */
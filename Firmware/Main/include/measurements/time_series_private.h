@@ -0,0 +1,49 @@
+/*
+ * time_series_private.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Shakti
+ */
+
+#ifndef INCLUDE_MEASUREMENTS_TIME_SERIES_PRIVATE_H_
+#define INCLUDE_MEASUREMENTS_TIME_SERIES_PRIVATE_H_
+
+#include "time_series.h"
+
+/**
+ * Setup tier, located at given address, returns address right after tier
+ */
+uint32_t TimeSeriesInitTier(TimeSeriesTierStruct* tier, uint32_t baseAddress, uint32_t capacity, uint32_t period);
+
+/**
+ * Accumulate sample into tier's current aggregation period, writing previous period if it's finished
+ */
+void TimeSeriesAggregate(TimeSeriesContextStruct* context, TimeSeriesTierStruct* tier, uint32_t timestamp, int32_t value);
+
+/**
+ * Write record (one element per column) to tier, dropping oldest record if tier is full
+ */
+void TimeSeriesAppendRecord(TimeSeriesContextStruct* context, TimeSeriesTierStruct* tier, uint32_t* record, uint8_t columnsCount);
+
+/**
+ * Address of column element with given physical index
+ */
+uint32_t TimeSeriesGetElementAddress(TimeSeriesTierStruct* tier, enum TIME_SERIES_COLUMN column, uint32_t physicalIndex);
+
+/**
+ * Timestamp of record with given index (0 - oldest record)
+ */
+uint32_t TimeSeriesReadTimestamp(TimeSeriesContextStruct* context, TimeSeriesTierStruct* tier, uint32_t index);
+
+/**
+ * Index of first record with timestamp not less than given (or greater than given, if isStrict).
+ * Returns records count if there is no such record
+ */
+uint32_t TimeSeriesLowerBound(TimeSeriesContextStruct* context, TimeSeriesTierStruct* tier, uint32_t timestamp, bool isStrict);
+
+/**
+ * Get tier by index
+ */
+TimeSeriesTierStruct* TimeSeriesGetTier(TimeSeriesContextStruct* context, enum TIME_SERIES_TIER tier);
+
+#endif /* INCLUDE_MEASUREMENTS_TIME_SERIES_PRIVATE_H_ */
@@ -538,7 +538,11 @@ FMGL_API_ColorStruct L2HAL_GC9A01_GetPixel(L2HAL_GC9A01_ContextStruct* context,
 	}
 	else
 	{
-		/* Cache miss, we need to download cache from external memory */
+		/* Cache miss, cache may contain drawn pixels, so pushing it to external memory before moving */
+		L2HAL_GC9A01_WriteCacheToFramebuffer(context);
+
+		context->PixelsCacheX = x;
+		context->PixelsCacheY = y;
 		L2HAL_GC9A01_ReadCacheFromFramebuffer(context);
 
 		return L2HAL_GC9A01_ReadPixelsCache(context, x, y);
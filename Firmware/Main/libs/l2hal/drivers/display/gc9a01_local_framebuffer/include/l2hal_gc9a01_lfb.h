@@ -153,7 +153,7 @@ uint16_t L2HAL_GC9A01_LFB_GetHeight(void);
 void L2HAL_GC9A01_LFB_ClearDisplay(L2HAL_GC9A01_LFB_ContextStruct *context);
 
 /**
- * Draw pixel
+ * Draw pixel. Coordinates aren't checked, FMGL clips everything before drawing.
  */
 void L2HAL_GC9A01_LFB_DrawPixel(void* context, uint16_t x, uint16_t y);
 
@@ -167,11 +167,32 @@ FMGL_API_ColorStruct L2HAL_GC9A01_LFB_GetPixel(void* context, uint16_t x, uint16
  */
 void L2HAL_GC9A01_LFB_SetActiveColor(void* context, FMGL_API_ColorStruct color);
 
+/**
+ * Fill horizontal span [x1; x2] with active color. Coordinates must be on screen, x1 <= x2
+ */
+void L2HAL_GC9A01_LFB_FillSpan(void* context, uint16_t x1, uint16_t x2, uint16_t y);
+
+/**
+ * Fill rectangle with active color. Coordinates must be on screen, x1 <= x2, y1 <= y2
+ */
+void L2HAL_GC9A01_LFB_FillRect(void* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+/**
+ * Render top left width x height part of XBM image at (x, y). Rendered part must be on screen, active color is not changed
+ */
+void L2HAL_GC9A01_LFB_BlitMono1bpp(void* context, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+		FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency);
+
 /**
  * Push framebuffer to display
  */
 void L2HAL_GC9A01_LFB_PushFramebuffer(void* context);
 
+/**
+ * Push given framebuffer regions to display. Dirty lines are not affected
+ */
+void L2HAL_GC9A01_LFB_PushRegions(void* context, FMGL_API_RegionStruct* regions, uint8_t regionsCount);
+
 /**
  * Fill framebuffer with black color
  */
@@ -87,5 +87,10 @@ void L2HAL_GC9A01_LFB_WriteByteData(L2HAL_GC9A01_LFB_ContextStruct *context, uin
  */
 void L2HAL_GC9A01_LFB_WaitForDataTransferCompletion(L2HAL_GC9A01_LFB_ContextStruct *context);
 
+/**
+ * Mark framebuffer line as dirty
+ */
+void L2HAL_GC9A01_LFB_MarkLineAsDirty(L2HAL_GC9A01_LFB_ContextStruct* context, uint16_t y);
+
 
 #endif /* L2HAL_DRIVERS_DISPLAY_GC9A01_LOCAL_FRAMEBUFFER_INCLUDE_L2HAL_GC9A01_LFB_LFB_PRIVATE_H_ */
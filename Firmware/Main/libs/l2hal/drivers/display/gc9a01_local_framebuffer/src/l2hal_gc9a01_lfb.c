@@ -27,6 +27,7 @@
 
 #include "../include/l2hal_gc9a01_lfb.h"
 #include "../include/l2hal_gc9a01_lfb_private.h"
+#include "../../../../fmgl/include/fmgl_pixel_formats.h"
 #include "../../../../include/l2hal_errors.h"
 
 void L2HAL_GC9A01_LFB_Init
@@ -474,6 +475,50 @@ void L2HAL_GC9A01_LFB_SetActiveColor(void* context, FMGL_API_ColorStruct color)
 	((L2HAL_GC9A01_LFB_ContextStruct*)context)->ActiveColor = color;
 }
 
+void L2HAL_GC9A01_LFB_FillSpan(void* context, uint16_t x1, uint16_t x2, uint16_t y)
+{
+	L2HAL_GC9A01_LFB_ContextStruct* lfbContext = (L2HAL_GC9A01_LFB_ContextStruct*)context;
+
+	FMGL_PF_RGB888FillSpan(&lfbContext->Framebuffer[y * L2HAL_GC9A01_LFB_DISPLAY_LINE_SIZE], x1, x2, lfbContext->ActiveColor);
+
+	L2HAL_GC9A01_LFB_MarkLineAsDirty(lfbContext, y);
+}
+
+void L2HAL_GC9A01_LFB_FillRect(void* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	L2HAL_GC9A01_LFB_ContextStruct* lfbContext = (L2HAL_GC9A01_LFB_ContextStruct*)context;
+
+	L2HAL_GC9A01_LFB_FillSpan(context, x1, x2, y1);
+
+	/* Other lines are copies of the first one */
+	uint8_t* firstLine = &lfbContext->Framebuffer[y1 * L2HAL_GC9A01_LFB_DISPLAY_LINE_SIZE + x1 * 3];
+	uint16_t spanSize = (x2 - x1 + 1) * 3;
+
+	for (uint16_t y = y1 + 1; y <= y2; y++)
+	{
+		memcpy(&lfbContext->Framebuffer[y * L2HAL_GC9A01_LFB_DISPLAY_LINE_SIZE + x1 * 3], firstLine, spanSize);
+		L2HAL_GC9A01_LFB_MarkLineAsDirty(lfbContext, y);
+	}
+}
+
+void L2HAL_GC9A01_LFB_BlitMono1bpp(void* context, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+		FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+{
+	L2HAL_GC9A01_LFB_ContextStruct* lfbContext = (L2HAL_GC9A01_LFB_ContextStruct*)context;
+
+	FMGL_PF_RGB888Blit(lfbContext->Framebuffer, L2HAL_GC9A01_LFB_DISPLAY_LINE_SIZE, x, y, image, width, height, activeColor, inactiveColor, transparency);
+
+	for (uint16_t row = 0; row < height; row++)
+	{
+		L2HAL_GC9A01_LFB_MarkLineAsDirty(lfbContext, y + row);
+	}
+}
+
+void L2HAL_GC9A01_LFB_MarkLineAsDirty(L2HAL_GC9A01_LFB_ContextStruct* context, uint16_t y)
+{
+	context->DirtyLinesBuffer[y / 8] |= (1 << (y % 8));
+}
+
 void L2HAL_GC9A01_LFB_PushFramebuffer(void* context)
 {
 	for (uint8_t y = 0; y < L2HAL_GC9A01_LFB_DISPLAY_HEIGHT; y ++)
@@ -482,7 +527,7 @@ void L2HAL_GC9A01_LFB_PushFramebuffer(void* context)
 		uint8_t dirtyBitNumber = y % 8;
 		uint8_t mask = (1 << dirtyBitNumber);
 
-		if (((L2HAL_GC9A01_LFB_ContextStruct*)context)->DirtyLinesBuffer[dirtyLineAddress] & mask != 0x00)
+		if ((((L2HAL_GC9A01_LFB_ContextStruct*)context)->DirtyLinesBuffer[dirtyLineAddress] & mask) != 0x00)
 		{
 			L2HAL_GC9A01_LFB_SetColumnsRange(context, 0, L2HAL_GC9A01_LFB_DISPLAY_WIDTH - 1);
 			L2HAL_GC9A01_LFB_SetRowsRange(context, y, y);
@@ -495,6 +540,27 @@ void L2HAL_GC9A01_LFB_PushFramebuffer(void* context)
 	memset(((L2HAL_GC9A01_LFB_ContextStruct*)context)->DirtyLinesBuffer, 0x00, L2HAL_GC9A01_LFB_DIRTY_LINES_BUFFER_SIZE);
 }
 
+void L2HAL_GC9A01_LFB_PushRegions(void* context, FMGL_API_RegionStruct* regions, uint8_t regionsCount)
+{
+	L2HAL_GC9A01_LFB_ContextStruct* lfbContext = (L2HAL_GC9A01_LFB_ContextStruct*)context;
+
+	for (uint8_t i = 0; i < regionsCount; i++)
+	{
+		FMGL_API_RegionStruct* region = &regions[i];
+		uint16_t lineSize = (region->X2 - region->X1 + 1) * 3;
+
+		L2HAL_GC9A01_LFB_SetColumnsRange(lfbContext, region->X1, region->X2);
+		L2HAL_GC9A01_LFB_SetRowsRange(lfbContext, region->Y1, region->Y2);
+
+		L2HAL_GC9A01_LFB_WriteCommand(lfbContext, 0x2C);
+
+		for (uint16_t y = region->Y1; y <= region->Y2; y++)
+		{
+			L2HAL_GC9A01_LFB_WriteData(lfbContext, &lfbContext->Framebuffer[y * L2HAL_GC9A01_LFB_DISPLAY_LINE_SIZE + region->X1 * 3], lineSize);
+		}
+	}
+}
+
 void L2HAL_GC9A01_LFB_ClearFramebuffer(L2HAL_GC9A01_LFB_ContextStruct* context)
 {
 	memset(context->Framebuffer, 0x00, L2HAL_GC9A01_LFB_FRAMEBUFFER_SIZE);
@@ -208,6 +208,15 @@ void L2HAL_SSD1306_SetActiveColor(L2HAL_SSD1306_ContextStruct* context, FMGL_API
  */
 void L2HAL_SSD1306_DrawPixel(L2HAL_SSD1306_ContextStruct* context, uint16_t x, uint16_t y);
 
+/**
+ * Same as L2HAL_SSD1306_DrawPixel(), but without coordinates check, so coordinates must be on screen. Intended for FMGL,
+ * which clips everything before drawing.
+ * @param context Pointer to driver context.
+ * @param x Pixel X coordinate.
+ * @param y Pixel Y coordinate.
+ */
+void L2HAL_SSD1306_DrawPixelUnchecked(L2HAL_SSD1306_ContextStruct* context, uint16_t x, uint16_t y);
+
 /**
  * Get color of pixel with given coordinates. Return off pixel color if coordinates are incorrect.
  * @param context Pointer to driver context.
@@ -217,6 +226,40 @@ void L2HAL_SSD1306_DrawPixel(L2HAL_SSD1306_ContextStruct* context, uint16_t x, u
  */
 FMGL_API_ColorStruct L2HAL_SSD1306_GetPixel(L2HAL_SSD1306_ContextStruct* context, uint16_t x, uint16_t y);
 
+/**
+ * Fills horizontal span with active color. DOESN'T PUSH FRAMEBUFFER.
+ * @param context Pointer to driver context.
+ * @param x1 Span left X coordinate, must be on screen.
+ * @param x2 Span right X coordinate, must be on screen and not less than x1.
+ * @param y Span Y coordinate, must be on screen.
+ */
+void L2HAL_SSD1306_FillSpan(L2HAL_SSD1306_ContextStruct* context, uint16_t x1, uint16_t x2, uint16_t y);
+
+/**
+ * Fills rectangle with active color. DOESN'T PUSH FRAMEBUFFER.
+ * @param context Pointer to driver context.
+ * @param x1 Left X coordinate, must be on screen.
+ * @param y1 Top Y coordinate, must be on screen.
+ * @param x2 Right X coordinate, must be on screen and not less than x1.
+ * @param y2 Bottom Y coordinate, must be on screen and not less than y1.
+ */
+void L2HAL_SSD1306_FillRect(L2HAL_SSD1306_ContextStruct* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+/**
+ * Renders top left width x height part of XBM image at given position. Active color is not changed. DOESN'T PUSH FRAMEBUFFER.
+ * @param context Pointer to driver context.
+ * @param x Image top left corner X coordinate.
+ * @param y Image top left corner Y coordinate.
+ * @param image Pointer to XBM image.
+ * @param width Rendered part width, rendered part must be on screen.
+ * @param height Rendered part height, rendered part must be on screen.
+ * @param activeColor Draw image active pixels with this color.
+ * @param inactiveColor Draw image inactive pixels with this color.
+ * @param transparency Transparency mode.
+ */
+void L2HAL_SSD1306_BlitMono1bpp(L2HAL_SSD1306_ContextStruct* context, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+		FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency);
+
 /**
  * Pushes framebuffer to display, if push already initiated waits for completion.
  * @param context Pointer to driver context.
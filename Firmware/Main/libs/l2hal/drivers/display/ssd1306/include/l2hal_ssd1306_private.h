@@ -148,4 +148,11 @@ bool L2HAL_SSD1306_GetFramebufferAddress(uint16_t x, uint16_t y, uint16_t* index
  */
 uint16_t L2HAL_SSD1306_GetBrightness(FMGL_API_ColorStruct color);
 
+/**
+ * Converts color to framebuffer byte value (L2HAL_SSD1306_PIXEL_ON or L2HAL_SSD1306_PIXEL_OFF).
+ * @param color Color to convert.
+ * @return Framebuffer byte value.
+ */
+uint8_t L2HAL_SSD1306_BinarizeColor(FMGL_API_ColorStruct color);
+
 #endif /* L2HAL_DRIVERS_DISPLAY_SSD1306_INCLUDE_L2HAL_SSD1306_PRIVATE_H_ */
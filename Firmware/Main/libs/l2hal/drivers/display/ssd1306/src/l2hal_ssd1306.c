@@ -242,34 +242,126 @@ bool L2HAL_SSD1306_GetFramebufferAddress(uint16_t x, uint16_t y, uint16_t* index
 }
 
 void L2HAL_SSD1306_SetActiveColor(L2HAL_SSD1306_ContextStruct* context, FMGL_API_ColorStruct color)
+{
+	context->ActiveColor = L2HAL_SSD1306_BinarizeColor(color);
+}
+
+uint8_t L2HAL_SSD1306_BinarizeColor(FMGL_API_ColorStruct color)
 {
 	uint16_t brightness = L2HAL_SSD1306_GetBrightness(color);
 
 	if (L2HAL_SSD1306_BRIGHTNESS_THRESHOLD > brightness)
 	{
-		context->ActiveColor = L2HAL_SSD1306_PIXEL_OFF;
+		return L2HAL_SSD1306_PIXEL_OFF;
 	}
-	else
+
+	return L2HAL_SSD1306_PIXEL_ON;
+}
+
+void L2HAL_SSD1306_DrawPixel(L2HAL_SSD1306_ContextStruct* context, uint16_t x, uint16_t y)
+{
+	if (L2HAL_SSD1306_DISPLAY_WIDTH <= x || L2HAL_SSD1306_DISPLAY_HEIGHT <= y)
 	{
-		context->ActiveColor = L2HAL_SSD1306_PIXEL_ON;
+		return;
 	}
+
+	L2HAL_SSD1306_DrawPixelUnchecked(context, x, y);
 }
 
-void L2HAL_SSD1306_DrawPixel(L2HAL_SSD1306_ContextStruct* context, uint16_t x, uint16_t y)
+void L2HAL_SSD1306_DrawPixelUnchecked(L2HAL_SSD1306_ContextStruct* context, uint16_t x, uint16_t y)
 {
 	L2HAL_SSD1306_WaitForTransferCompletion(context); /* We can't change framebuffer during transfer. */
 
-	uint16_t index;
-	uint8_t mask;
+	uint16_t index = (y / L2HAL_SSD1306_PAGE_HEIGHT) * L2HAL_SSD1306_DISPLAY_WIDTH + x;
+	uint8_t mask = 1 << (y % L2HAL_SSD1306_PAGE_HEIGHT);
 
-	if (false == L2HAL_SSD1306_GetFramebufferAddress(x, y, &index, &mask))
+	uint8_t antimask = ~mask;
+
+	context->Framebuffer[index] = (context->Framebuffer[index] & antimask) | (mask & context->ActiveColor);
+}
+
+void L2HAL_SSD1306_FillSpan(L2HAL_SSD1306_ContextStruct* context, uint16_t x1, uint16_t x2, uint16_t y)
+{
+	L2HAL_SSD1306_FillRect(context, x1, y, x2, y);
+}
+
+void L2HAL_SSD1306_FillRect(L2HAL_SSD1306_ContextStruct* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	L2HAL_SSD1306_WaitForTransferCompletion(context); /* We can't change framebuffer during transfer. */
+
+	uint16_t firstPage = y1 / L2HAL_SSD1306_PAGE_HEIGHT;
+	uint16_t lastPage = y2 / L2HAL_SSD1306_PAGE_HEIGHT;
+
+	for (uint16_t page = firstPage; page <= lastPage; page++)
 	{
-		return;
+		/* Rows of this page, covered by rectangle */
+		uint8_t mask = 0xFF;
+
+		if (page == firstPage)
+		{
+			mask &= (uint8_t)(0xFF << (y1 % L2HAL_SSD1306_PAGE_HEIGHT));
+		}
+
+		if (page == lastPage)
+		{
+			mask &= 0xFF >> (L2HAL_SSD1306_PAGE_HEIGHT - 1 - (y2 % L2HAL_SSD1306_PAGE_HEIGHT));
+		}
+
+		uint8_t antimask = ~mask;
+		uint8_t value = mask & context->ActiveColor;
+		uint8_t* pageBase = &context->Framebuffer[page * L2HAL_SSD1306_DISPLAY_WIDTH];
+
+		for (uint16_t x = x1; x <= x2; x++)
+		{
+			pageBase[x] = (pageBase[x] & antimask) | value;
+		}
 	}
+}
 
-	uint8_t antimask = ~mask;
+void L2HAL_SSD1306_BlitMono1bpp(L2HAL_SSD1306_ContextStruct* context, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+		FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+{
+	L2HAL_SSD1306_WaitForTransferCompletion(context); /* We can't change framebuffer during transfer. */
 
-	context->Framebuffer[index] = (context->Framebuffer[index] & antimask) | (mask & context->ActiveColor);
+	uint8_t binarizedColors[2] = { L2HAL_SSD1306_BinarizeColor(inactiveColor), L2HAL_SSD1306_BinarizeColor(activeColor) };
+	bool isWritten[2] =
+	{
+		FMGL_XBMTransparencyModeTransparentInactive != transparency,
+		FMGL_XBMTransparencyModeTransparentActive != transparency
+	};
+
+	uint16_t imageLineSize = (image->Width + 7) / 8;
+
+	for (uint16_t row = 0; row < height; row++)
+	{
+		uint16_t dy = y + row;
+		uint8_t mask = 1 << (dy % L2HAL_SSD1306_PAGE_HEIGHT);
+		uint8_t antimask = ~mask;
+
+		const uint8_t* source = &image->Raster[row * imageLineSize];
+		uint8_t* destination = &context->Framebuffer[(dy / L2HAL_SSD1306_PAGE_HEIGHT) * L2HAL_SSD1306_DISPLAY_WIDTH + x];
+
+		for (uint16_t byteIndex = 0; byteIndex < (width + 7) / 8; byteIndex++)
+		{
+			/* Fully transparent source bytes are skipped */
+			if ((0x00 == source[byteIndex] && !isWritten[0]) || (0xFF == source[byteIndex] && !isWritten[1]))
+			{
+				continue;
+			}
+
+			uint16_t lastColumn = MIN(width, (byteIndex + 1) * 8);
+			for (uint16_t column = byteIndex * 8; column < lastColumn; column++)
+			{
+				uint8_t bitNumber = image->IsMSBFirst ? 7 - (column % 8) : column % 8;
+				uint8_t isActive = (source[byteIndex] >> bitNumber) & 0x01;
+
+				if (isWritten[isActive])
+				{
+					destination[column] = (destination[column] & antimask) | (mask & binarizedColors[isActive]);
+				}
+			}
+		}
+	}
 }
 
 uint16_t L2HAL_SSD1306_GetBrightness(FMGL_API_ColorStruct color)
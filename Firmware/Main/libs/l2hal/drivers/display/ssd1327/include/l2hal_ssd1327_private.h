@@ -71,6 +71,11 @@
  */
 #define L2HAL_SSD1327_PAGE_WIDTH 8
 
+/**
+ * Framebuffer line size in bytes (for grayscale mode).
+ */
+#define L2HAL_SSD1327_GRAYSCALE_LINE_SIZE (L2HAL_SSD1327_DISPLAY_WIDTH / 2U)
+
 /**
  * Wait this amount of milliseconds after transmitting column address before sending a row address
  */
@@ -134,4 +139,12 @@ bool L2HAL_SSD1327_GetPixelAddress(uint16_t x, uint16_t y, uint16_t* index, bool
  */
 bool L2HAL_SSD1327_GetPixelAddressMonochrome(uint16_t x, uint16_t y, uint16_t* index, uint8_t* mask);
 
+/**
+ * Converts color to display brightness.
+ * @param color Color to convert.
+ * @return Brightness [0-L2HAL_SSD1327_MAX_BRIGHTNESS].
+ */
+uint8_t L2HAL_SSD1327_GetColorBrightness(FMGL_API_ColorStruct color);
+
+
 #endif /* L2HAL_DRIVERS_DISPLAY_SSD1327_INCLUDE_L2HAL_SSD1327_PRIVATE_H_ */
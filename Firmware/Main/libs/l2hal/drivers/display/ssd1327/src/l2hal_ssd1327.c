@@ -26,6 +26,7 @@
  */
 
 #include "../include/l2hal_ssd1327_private.h"
+#include "../../../../fmgl/include/fmgl_pixel_formats.h"
 #include "../../../../include/l2hal_errors.h"
 
 L2HAL_SSD1327_ContextStruct L2HAL_SSD1327_DetectDisplayAtAddress(I2C_HandleTypeDef* i2cBusHandle, uint8_t address)
@@ -323,6 +324,7 @@ void L2HAL_SSD1327_SetDisplayMode(L2HAL_SSD1327_ContextStruct* context, L2HAL_SS
 		break;
 		default:
 			L2HAL_Error(Generic);
+			return;
 	}
 
 	L2HAL_SSD1327_WriteCommand(context, command);
@@ -484,7 +486,7 @@ void L2HAL_SSD1327_SetGrayscaleTable(L2HAL_SSD1327_ContextStruct* context, uint8
 
 bool L2HAL_SSD1327_GetPixelAddress(uint16_t x, uint16_t y, uint16_t* index, bool* isMostSignificantNibble)
 {
-	if (x > L2HAL_SSD1327_DISPLAY_WIDTH || y > L2HAL_SSD1327_DISPLAY_HEIGHT)
+	if (x >= L2HAL_SSD1327_DISPLAY_WIDTH || y >= L2HAL_SSD1327_DISPLAY_HEIGHT)
 	{
 		return false;
 	}
@@ -499,7 +501,7 @@ bool L2HAL_SSD1327_GetPixelAddress(uint16_t x, uint16_t y, uint16_t* index, bool
 
 bool L2HAL_SSD1327_GetPixelAddressMonochrome(uint16_t x, uint16_t y, uint16_t* index, uint8_t* mask)
 {
-	if (x > L2HAL_SSD1327_DISPLAY_WIDTH || y > L2HAL_SSD1327_DISPLAY_HEIGHT)
+	if (x >= L2HAL_SSD1327_DISPLAY_WIDTH || y >= L2HAL_SSD1327_DISPLAY_HEIGHT)
 	{
 		return false;
 	}
@@ -512,28 +514,39 @@ bool L2HAL_SSD1327_GetPixelAddressMonochrome(uint16_t x, uint16_t y, uint16_t* i
 
 void L2HAL_SSD1327_SetActiveColor(L2HAL_SSD1327_ContextStruct* context, FMGL_API_ColorStruct color)
 {
-	context->ActiveColor = ((uint32_t)color.R * L2HAL_SSD1327_BRIGHTNESS_MUL_R_FACTOR
+	context->ActiveColor = L2HAL_SSD1327_GetColorBrightness(color);
+}
+
+uint8_t L2HAL_SSD1327_GetColorBrightness(FMGL_API_ColorStruct color)
+{
+	uint32_t brightness = ((uint32_t)color.R * L2HAL_SSD1327_BRIGHTNESS_MUL_R_FACTOR
 				+ (uint32_t)color.G * L2HAL_SSD1327_BRIGHTNESS_MUL_G_FACTOR
 				+ (uint32_t)color.B * L2HAL_SSD1327_BRIGHTNESS_MUL_B_FACTOR) / L2HAL_SSD1327_BRIGHTNESS_DIV_FACTOR;
 
-	if (context->ActiveColor > L2HAL_SSD1327_MAX_BRIGHTNESS)
+	if (brightness > L2HAL_SSD1327_MAX_BRIGHTNESS)
 	{
-		context->ActiveColor = L2HAL_SSD1327_MAX_BRIGHTNESS;
+		brightness = L2HAL_SSD1327_MAX_BRIGHTNESS;
 	}
+
+	return brightness;
 }
 
-#ifdef L2HAL_SSD1327_MONOCHROME_MODE
-	void L2HAL_SSD1327_DrawPixel(L2HAL_SSD1327_ContextStruct* context, uint16_t x, uint16_t y)
+void L2HAL_SSD1327_DrawPixel(L2HAL_SSD1327_ContextStruct* context, uint16_t x, uint16_t y)
+{
+	if (x >= L2HAL_SSD1327_DISPLAY_WIDTH || y >= L2HAL_SSD1327_DISPLAY_HEIGHT)
 	{
-		uint16_t index;
-		uint8_t bitmask;
+		return;
+	}
 
-		if (!L2HAL_SSD1327_GetPixelAddressMonochrome(x, y, &index, &bitmask))
-		{
-			return;
-		}
+	L2HAL_SSD1327_DrawPixelUnchecked(context, x, y);
+}
+
+#ifdef L2HAL_SSD1327_MONOCHROME_MODE
+	void L2HAL_SSD1327_DrawPixelUnchecked(L2HAL_SSD1327_ContextStruct* context, uint16_t x, uint16_t y)
+	{
+		uint16_t index = y * L2HAL_SSD1327_COMPRESSED_LINE_SIZE + x / L2HAL_SSD1327_PAGE_WIDTH;
+		uint8_t bitmask = 1 << (x % L2HAL_SSD1327_PAGE_WIDTH);
 
-		uint8_t targetColor;
 		if (context->ActiveColor > 0)
 		{
 			// Lit
@@ -546,26 +559,9 @@ void L2HAL_SSD1327_SetActiveColor(L2HAL_SSD1327_ContextStruct* context, FMGL_API
 		}
 	}
 #else
-	void L2HAL_SSD1327_DrawPixel(L2HAL_SSD1327_ContextStruct* context, uint16_t x, uint16_t y)
+	void L2HAL_SSD1327_DrawPixelUnchecked(L2HAL_SSD1327_ContextStruct* context, uint16_t x, uint16_t y)
 	{
-		uint16_t index;
-		bool isMostSignificantNibble;
-
-		if (!L2HAL_SSD1327_GetPixelAddress(x, y, &index, &isMostSignificantNibble))
-		{
-			return;
-		}
-
-		if (isMostSignificantNibble)
-		{
-			context->Framebuffer[index] &= 0x0FU;
-			context->Framebuffer[index] |= (context->ActiveColor & 0x0FU) << 4;
-		}
-		else
-		{
-			context->Framebuffer[index] &= 0xF0U;
-			context->Framebuffer[index] |= (context->ActiveColor & 0x0FU);
-		}
+		FMGL_PF_Grey4WritePixel(&context->Framebuffer[y * L2HAL_SSD1327_GRAYSCALE_LINE_SIZE], x, context->ActiveColor);
 	}
 #endif
 
@@ -631,7 +627,44 @@ void L2HAL_SSD1327_SetActiveColor(L2HAL_SSD1327_ContextStruct* context, FMGL_API
 	}
 #endif
 
+#ifdef L2HAL_SSD1327_MONOCHROME_MODE
+	void L2HAL_SSD1327_FillSpan(L2HAL_SSD1327_ContextStruct* context, uint16_t x1, uint16_t x2, uint16_t y)
+	{
+		uint8_t value = (context->ActiveColor > 0) ? 0xFFU : 0x00U;
+
+		FMGL_PF_Mono1FillSpan(&context->Framebuffer[y * L2HAL_SSD1327_COMPRESSED_LINE_SIZE], x1, x2, value, false);
+	}
 
+	void L2HAL_SSD1327_BlitMono1bpp(L2HAL_SSD1327_ContextStruct* context, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+			FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+	{
+		uint8_t activeValue = (L2HAL_SSD1327_GetColorBrightness(activeColor) > 0) ? 0xFFU : 0x00U;
+		uint8_t inactiveValue = (L2HAL_SSD1327_GetColorBrightness(inactiveColor) > 0) ? 0xFFU : 0x00U;
+
+		FMGL_PF_Mono1Blit(context->Framebuffer, L2HAL_SSD1327_COMPRESSED_LINE_SIZE, x, y, image, width, height,
+				activeValue, inactiveValue, transparency, false);
+	}
+#else
+	void L2HAL_SSD1327_FillSpan(L2HAL_SSD1327_ContextStruct* context, uint16_t x1, uint16_t x2, uint16_t y)
+	{
+		FMGL_PF_Grey4FillSpan(&context->Framebuffer[y * L2HAL_SSD1327_GRAYSCALE_LINE_SIZE], x1, x2, context->ActiveColor);
+	}
+
+	void L2HAL_SSD1327_BlitMono1bpp(L2HAL_SSD1327_ContextStruct* context, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+			FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+	{
+		FMGL_PF_Grey4Blit(context->Framebuffer, L2HAL_SSD1327_GRAYSCALE_LINE_SIZE, x, y, image, width, height,
+				L2HAL_SSD1327_GetColorBrightness(activeColor), L2HAL_SSD1327_GetColorBrightness(inactiveColor), transparency);
+	}
+#endif
+
+void L2HAL_SSD1327_FillRect(L2HAL_SSD1327_ContextStruct* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	for (uint16_t y = y1; y <= y2; y++)
+	{
+		L2HAL_SSD1327_FillSpan(context, x1, x2, y);
+	}
+}
 
 uint16_t L2HAL_SSD1327_GetWidth(void)
 {
@@ -21,6 +21,60 @@
 #define L2HAL_SSD1683_DISPLAY_LINE_SIZE (L2HAL_SSD1683_DISPLAY_WIDTH / 8)
 #define L2HAL_SSD1683_FRAMEBUFFER_SIZE (L2HAL_SSD1683_DISPLAY_LINE_SIZE * L2HAL_SSD1683_DISPLAY_HEIGHT)
 
+/**
+ * Greyscale framebuffer: 2 bits per pixel (FMGL Grey2 format), 0 - black, 3 - white
+ */
+#define L2HAL_SSD1683_GREYSCALE_LINE_SIZE (L2HAL_SSD1683_DISPLAY_WIDTH / 4)
+#define L2HAL_SSD1683_GREYSCALE_FRAMEBUFFER_SIZE (L2HAL_SSD1683_GREYSCALE_LINE_SIZE * L2HAL_SSD1683_DISPLAY_HEIGHT)
+
+/**
+ * Not more than this number of RAM windows is pushed per frame, if there are more regions, the whole framebuffer is pushed
+ */
+#define L2HAL_SSD1683_MAX_WINDOWS 16
+
+/**
+ * Waveform: LUT (0x32), end option (0x3F), gate voltage (0x03), source voltages (0x04, 3 bytes) and VCOM (0x2C)
+ */
+#define L2HAL_SSD1683_WAVEFORM_SIZE 233
+
+/**
+ * Ghosting is accounted per tile of this size (tile width must be multiple of 8)
+ */
+#define L2HAL_SSD1683_GHOSTING_TILE_WIDTH 80
+#define L2HAL_SSD1683_GHOSTING_TILE_HEIGHT 60
+
+#define L2HAL_SSD1683_GHOSTING_TILE_LINE_SIZE (L2HAL_SSD1683_GHOSTING_TILE_WIDTH / 8)
+#define L2HAL_SSD1683_GHOSTING_TILES_PER_ROW (L2HAL_SSD1683_DISPLAY_WIDTH / L2HAL_SSD1683_GHOSTING_TILE_WIDTH)
+#define L2HAL_SSD1683_GHOSTING_TILES_COUNT (L2HAL_SSD1683_GHOSTING_TILES_PER_ROW * (L2HAL_SSD1683_DISPLAY_HEIGHT / L2HAL_SSD1683_GHOSTING_TILE_HEIGHT))
+
+/**
+ * When to clean display from ghosting
+ */
+typedef struct
+{
+	/**
+	 * Tile is cleaned when this count of its pixels were toggled by partial updates (pixel toggled twice is counted twice).
+	 * 0 - never clean
+	 */
+	uint32_t TileGhostingBudget;
+
+	/**
+	 * If at least this count of tiles must be cleaned, full refresh is done instead
+	 */
+	uint8_t FullRefreshTilesCount;
+
+	/**
+	 * L2HAL_SSD1683_CleanOnIdle() cleans tiles, which spent at least this percent of budget
+	 */
+	uint8_t IdleCleaningPercent;
+
+	/**
+	 * Display is idle if nothing was pushed during this time (milliseconds)
+	 */
+	uint32_t IdleTimeout;
+}
+L2HAL_SSD1683_RefreshPolicyStruct;
+
 /**
  * Display context, SPI connection and various stuff is stored here
  */
@@ -71,20 +125,87 @@ typedef struct
 	uint8_t Framebuffer[L2HAL_SSD1683_FRAMEBUFFER_SIZE];
 
 	/**
-	 * If set to true, then driver will perform full refreshs each AutoFullRefreshFramesCount
-	 * Applied for L2HAL_SSD1683_PushFramebufferPartial()
+	 * When to clean display from ghosting
+	 */
+	L2HAL_SSD1683_RefreshPolicyStruct RefreshPolicy;
+
+	/**
+	 * Pixels, toggled by partial updates since last tile cleaning
 	 */
-	bool IsAutoFullRefresh;
+	uint32_t TilesGhosting[L2HAL_SSD1683_GHOSTING_TILES_COUNT];
 
 	/**
-	 * Do full refresh every this frames count if IsAutoFullRefresh == true
+	 * When (in HAL ticks) display was updated last time
 	 */
-	uint8_t AutoFullRefreshFramesCount;
+	uint32_t LastUpdateTime;
 
 	/**
-	 * Do full refresh when this variable == 0
+	 * Waveform for partial updates (L2HAL_SSD1683_WAVEFORM_SIZE bytes, owned by caller). If NULL, waveform from OTP is used
 	 */
-	uint8_t FramesTillFullRefresh;
+	uint8_t* PartialWaveform;
+
+	/**
+	 * True if display LUT register contains PartialWaveform
+	 */
+	bool IsPartialWaveformLoaded;
+
+	/**
+	 * If true, OTP waveforms are selected by Temperature instead of built-in sensor readings
+	 */
+	bool IsExternalTemperature;
+
+	/**
+	 * Temperature in 1/16 of Celsius, it is sent to display before next update if IsTemperatureChanged
+	 */
+	int16_t Temperature;
+	bool IsTemperatureChanged;
+
+	/**
+	 * Greyscale framebuffer (L2HAL_SSD1683_GREYSCALE_FRAMEBUFFER_SIZE bytes, owned by caller), NULL if not attached
+	 */
+	uint8_t* GreyscaleFramebuffer;
+
+	/**
+	 * Waveform for greyscale refresh (L2HAL_SSD1683_WAVEFORM_SIZE bytes, owned by caller)
+	 */
+	uint8_t* GreyscaleWaveform;
+
+	/**
+	 * Current greyscale drawing level, 0 - black, 3 - white
+	 */
+	uint8_t GreyscaleActiveLevel;
+
+	/**
+	 * True if greyscale image is shown. Display RAM doesn't contain monochrome image then, so next monochrome push is full
+	 */
+	bool IsGreyscaleShown;
+
+	/**
+	 * If true, then display refresh is in progress. Cleared by L2HAL_SSD1683_MarkRefreshAsCompleted()
+	 */
+	volatile bool IsRefreshInProgress;
+
+	/**
+	 * Copy of image, shown on display (NULL if not attached). Required for asynchronous refresh, previous image RAM is
+	 * updated from it, so framebuffer could be changed while display is refreshing
+	 */
+	uint8_t* BackBuffer;
+
+	/**
+	 * Hashes of shown image rows, used to find changed rows if there is no back buffer
+	 */
+	uint32_t RowsHashes[L2HAL_SSD1683_DISPLAY_HEIGHT];
+
+	/**
+	 * These windows must be copied to previous image RAM after refresh completion
+	 */
+	FMGL_API_RegionStruct PendingWindows[L2HAL_SSD1683_MAX_WINDOWS + L2HAL_SSD1683_GHOSTING_TILES_COUNT];
+	uint8_t PendingWindowsCount;
+
+	/**
+	 * Called from L2HAL_SSD1683_MarkRefreshAsCompleted() (i.e. from interrupt context), could be NULL
+	 */
+	void (*RefreshCompletedCallback)(void);
 }
 L2HAL_SSD1683_ContextStruct;
 
@@ -110,11 +231,20 @@ void L2HAL_SSD1683_Init
 
 	FMGL_API_ColorStruct initColor,
 
-	bool isAutoFullRefresh,
-
-	uint8_t autoFullRefreshFramesCount
+	L2HAL_SSD1683_RefreshPolicyStruct refreshPolicy
 );
 
+/**
+ * Change refresh policy
+ */
+void L2HAL_SSD1683_SetRefreshPolicy(L2HAL_SSD1683_ContextStruct* context, L2HAL_SSD1683_RefreshPolicyStruct refreshPolicy);
+
+/**
+ * Call it periodically when there is nothing to draw. If display is idle (see L2HAL_SSD1683_RefreshPolicyStruct), cleans
+ * ghosted tiles. Returns true if cleaning was started
+ */
+bool L2HAL_SSD1683_CleanOnIdle(L2HAL_SSD1683_ContextStruct* context);
+
 /**
  * Get display width
  */
@@ -131,7 +261,7 @@ uint16_t L2HAL_SSD1683_GetHeight(void);
 void L2HAL_SSD1683_SetActiveColor(L2HAL_SSD1683_ContextStruct* context, FMGL_API_ColorStruct color);
 
 /**
- * Draw pixel
+ * Draw pixel. Coordinates aren't checked, FMGL clips everything before drawing.
  */
 void L2HAL_SSD1683_DrawPixel(L2HAL_SSD1683_ContextStruct* context, uint16_t x, uint16_t y);
 
@@ -140,6 +270,32 @@ void L2HAL_SSD1683_DrawPixel(L2HAL_SSD1683_ContextStruct* context, uint16_t x, u
  */
 FMGL_API_ColorStruct L2HAL_SSD1683_GetPixel(L2HAL_SSD1683_ContextStruct* context, uint16_t x, uint16_t y);
 
+/**
+ * Fill horizontal span [x1; x2] with active color. Coordinates must be on screen, x1 <= x2
+ */
+void L2HAL_SSD1683_FillSpan(L2HAL_SSD1683_ContextStruct* context, uint16_t x1, uint16_t x2, uint16_t y);
+
+/**
+ * Fill rectangle with active color. Coordinates must be on screen, x1 <= x2, y1 <= y2
+ */
+void L2HAL_SSD1683_FillRect(L2HAL_SSD1683_ContextStruct* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+/**
+ * Render top left width x height part of XBM image at (x, y). Rendered part must be on screen, active color is not changed
+ */
+void L2HAL_SSD1683_BlitMono1bpp
+(
+	L2HAL_SSD1683_ContextStruct* context,
+	uint16_t x,
+	uint16_t y,
+	FMGL_API_XBMImage* image,
+	uint16_t width,
+	uint16_t height,
+	FMGL_API_ColorStruct activeColor,
+	FMGL_API_ColorStruct inactiveColor,
+	FMGL_API_XBMTransparencyMode transparency
+);
+
 /**
  * Fill framebuffer with active color
  */
@@ -151,15 +307,116 @@ void L2HAL_SSD1683_ClearFramebuffer(L2HAL_SSD1683_ContextStruct* context, FMGL_A
 void L2HAL_SSD1683_PushFramebufferFull(L2HAL_SSD1683_ContextStruct* context);
 
 /**
- * Push framebuffer to display (partial update)
+ * Push framebuffer to display (partial update). Framebuffer is compared with shown image (back buffer, or rows hashes
+ * if there is no back buffer), only changed rows spans are sent. Nothing is done if image is the same
  */
 void L2HAL_SSD1683_PushFramebufferPartial(L2HAL_SSD1683_ContextStruct* context);
 
+/**
+ * Push given framebuffer regions to display (partial update). Only byte-aligned RAM windows, covering regions, are sent,
+ * close windows are merged. Tiles, which spent ghosting budget, are cleaned during the same update (or full refresh is done
+ * if there are too many of them)
+ */
+void L2HAL_SSD1683_PushRegionsPartial(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* regions, uint8_t regionsCount);
+
+/**
+ * Attach back buffer (L2HAL_SSD1683_FRAMEBUFFER_SIZE bytes), making asynchronous refresh possible
+ */
+void L2HAL_SSD1683_AttachBackBuffer(L2HAL_SSD1683_ContextStruct* context, uint8_t* backBuffer);
+
+/**
+ * Set callback, called (from interrupt context) when asynchronous refresh is completed. Could be NULL
+ */
+void L2HAL_SSD1683_SetRefreshCompletedCallback(L2HAL_SSD1683_ContextStruct* context, void (*callback)(void));
+
+/**
+ * Start full refresh and return immediately. Framebuffer could be changed during refresh, next push will wait for
+ * refresh completion. Requires back buffer
+ */
+void L2HAL_SSD1683_PushFramebufferFullAsync(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Asynchronous version of L2HAL_SSD1683_PushFramebufferPartial(), see L2HAL_SSD1683_PushFramebufferFullAsync()
+ */
+void L2HAL_SSD1683_PushFramebufferPartialAsync(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Asynchronous version of L2HAL_SSD1683_PushRegionsPartial(), see L2HAL_SSD1683_PushFramebufferFullAsync()
+ */
+void L2HAL_SSD1683_PushRegionsPartialAsync(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* regions, uint8_t regionsCount);
+
+/**
+ * Returns true while display is refreshing
+ */
+bool L2HAL_SSD1683_IsRefreshInProgress(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Hang till display refresh completed and finish it (update previous image RAM)
+ */
+void L2HAL_SSD1683_WaitForRefreshCompletion(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Set ambient temperature (Celsius), display will use it instead of built-in sensor. Takes effect at next update
+ */
+void L2HAL_SSD1683_SetTemperature(L2HAL_SSD1683_ContextStruct* context, float temperature);
+
+/**
+ * Set waveform for partial updates (L2HAL_SSD1683_WAVEFORM_SIZE bytes, must live while used), NULL - use waveform from OTP.
+ * Full refreshes always use OTP waveform. Takes effect at next update
+ */
+void L2HAL_SSD1683_SetPartialWaveform(L2HAL_SSD1683_ContextStruct* context, uint8_t* waveform);
+
+/**
+ * Attach greyscale framebuffer (L2HAL_SSD1683_GREYSCALE_FRAMEBUFFER_SIZE bytes) and greyscale waveform (L2HAL_SSD1683_WAVEFORM_SIZE bytes),
+ * both must live while used. Framebuffer is cleared to white. Attach FMGL to greyscale functions to draw into it
+ */
+void L2HAL_SSD1683_AttachGreyscaleFramebuffer(L2HAL_SSD1683_ContextStruct* context, uint8_t* framebuffer, uint8_t* waveform);
+
+/**
+ * Set color what will be used for drawing into greyscale framebuffer
+ */
+void L2HAL_SSD1683_SetGreyscaleActiveColor(L2HAL_SSD1683_ContextStruct* context, FMGL_API_ColorStruct color);
+
+/**
+ * Draw pixel in greyscale framebuffer
+ */
+void L2HAL_SSD1683_DrawPixelGreyscale(L2HAL_SSD1683_ContextStruct* context, uint16_t x, uint16_t y);
+
+/**
+ * Get pixel color from greyscale framebuffer
+ */
+FMGL_API_ColorStruct L2HAL_SSD1683_GetPixelGreyscale(L2HAL_SSD1683_ContextStruct* context, uint16_t x, uint16_t y);
+
+/**
+ * Fill horizontal span [x1; x2] of greyscale framebuffer with active color. Coordinates must be on screen, x1 <= x2
+ */
+void L2HAL_SSD1683_FillSpanGreyscale(L2HAL_SSD1683_ContextStruct* context, uint16_t x1, uint16_t x2, uint16_t y);
+
+/**
+ * Fill greyscale framebuffer with given color
+ */
+void L2HAL_SSD1683_ClearGreyscaleFramebuffer(L2HAL_SSD1683_ContextStruct* context, FMGL_API_ColorStruct clearColor);
+
+/**
+ * Show greyscale framebuffer (full refresh with greyscale waveform). Next monochrome push will be full refresh too
+ */
+void L2HAL_SSD1683_PushGreyscaleFramebuffer(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Start greyscale refresh and return immediately (greyscale framebuffer could be changed right after return)
+ */
+void L2HAL_SSD1683_PushGreyscaleFramebufferAsync(L2HAL_SSD1683_ContextStruct* context);
+
 /**
  * Mark transfer as completed (call it from DMA IRQ)
  */
 void L2HAL_SSD1683_MarkDataTransferAsCompleted(L2HAL_SSD1683_ContextStruct *context);
 
+/**
+ * Mark refresh as completed (call it from BUSY pin falling edge IRQ)
+ */
+void L2HAL_SSD1683_MarkRefreshAsCompleted(L2HAL_SSD1683_ContextStruct *context);
+
 /**
  * Save framebuffer to external memory
  */
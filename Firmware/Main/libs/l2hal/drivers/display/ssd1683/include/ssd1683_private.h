@@ -25,6 +25,48 @@
  */
 #define L2HAL_SSD1683_DISPLAY_BOOT_TIME 120
 
+/**
+ * Transfers up to this size are blocking, bigger ones use DMA (its setup and completion interrupt cost more than few bytes)
+ */
+#define L2HAL_SSD1683_MAX_BLOCKING_TRANSFER_SIZE 8
+
+/**
+ * Framebuffer line is compared by 32-bit words, remaining bytes are compared one by one
+ */
+#define L2HAL_SSD1683_LINE_WORDS (L2HAL_SSD1683_DISPLAY_LINE_SIZE / 4)
+
+/**
+ * FNV-1a parameters for rows hashes
+ */
+#define L2HAL_SSD1683_HASH_OFFSET 2166136261U
+#define L2HAL_SSD1683_HASH_PRIME 16777619U
+
+/**
+ * Waveform layout
+ */
+#define L2HAL_SSD1683_WAVEFORM_LUT_SIZE 227
+#define L2HAL_SSD1683_WAVEFORM_END_OPTION_OFFSET 227
+#define L2HAL_SSD1683_WAVEFORM_GATE_VOLTAGE_OFFSET 228
+#define L2HAL_SSD1683_WAVEFORM_SOURCE_VOLTAGES_OFFSET 229
+#define L2HAL_SSD1683_WAVEFORM_SOURCE_VOLTAGES_SIZE 3
+#define L2HAL_SSD1683_WAVEFORM_VCOM_OFFSET 232
+
+/**
+ * Greyscale framebuffer is converted to bit planes by chunks of this lines count
+ */
+#define L2HAL_SSD1683_GREYSCALE_CHUNK_LINES 10
+
+/**
+ * Timeout for blocking transfers
+ */
+#define L2HAL_SSD1683_IO_TIMEOUT 100U
+
+/**
+ * Cost of setting up RAM window (commands and their parameters), in data bytes. Windows are merged if it is cheaper to push
+ * their union than to push them separately
+ */
+#define L2HAL_SSD1683_WINDOW_OVERHEAD 16
+
 /* Predefined white color */
 FMGL_API_ColorStruct WhiteColor =
 {
@@ -71,6 +113,21 @@ void L2HAL_SSD1683_WaitForDataTransferCompletion(L2HAL_SSD1683_ContextStruct *co
  */
 void L2HAL_SSD1683_WriteCommand(L2HAL_SSD1683_ContextStruct *context, uint8_t command);
 
+/**
+ * Write command with parameters as one transaction (DC is switched while chip is selected)
+ */
+void L2HAL_SSD1683_WriteCommandSequence(L2HAL_SSD1683_ContextStruct *context, uint8_t command, uint8_t *parameters, uint8_t parametersCount);
+
+/**
+ * Switch DC line: true - data, false - command. Allowed only between transfers
+ */
+void L2HAL_SSD1683_SetDataMode(L2HAL_SSD1683_ContextStruct *context, bool isData);
+
+/**
+ * Send bytes to selected chip and wait for completion. Small payloads are sent without DMA
+ */
+void L2HAL_SSD1683_Transmit(L2HAL_SSD1683_ContextStruct *context, uint8_t *data, uint16_t dataSize);
+
 /**
  * Write 1 byte of data
  */
@@ -97,15 +154,107 @@ void L2HAL_SSD1683_SetPosition(L2HAL_SSD1683_ContextStruct *context, uint16_t x,
 void L2HAL_SSD1683_SetRange(L2HAL_SSD1683_ContextStruct *context, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
 
 /**
- * Update display
+ * Start display update, don't wait for its completion
  */
 void L2HAL_SSD1683_Update(L2HAL_SSD1683_ContextStruct *context);
 
 /**
- * Update display partially (not spatial, but "weak update")
+ * Start partial display update (not spatial, but "weak update"), don't wait for its completion
  */
 void L2HAL_SSD1683_PartialUpdate(L2HAL_SSD1683_ContextStruct *context);
 
+/**
+ * Send temperature to display if it was changed
+ */
+void L2HAL_SSD1683_SendTemperature(L2HAL_SSD1683_ContextStruct *context);
+
+/**
+ * Write waveform to display registers
+ */
+void L2HAL_SSD1683_LoadWaveform(L2HAL_SSD1683_ContextStruct *context, uint8_t* waveform);
+
+/**
+ * Start greyscale display update, don't wait for its completion
+ */
+void L2HAL_SSD1683_GreyscaleUpdate(L2HAL_SSD1683_ContextStruct *context);
+
+/**
+ * Start update with given display update sequence
+ */
+void L2HAL_SSD1683_StartUpdate(L2HAL_SSD1683_ContextStruct *context, uint8_t sequence);
+
+/**
+ * Push framebuffer to display RAM and start full update
+ */
+void L2HAL_SSD1683_StartFullRefresh(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Push RAM windows to display RAM and start partial update. Windows are copied to previous image RAM after refresh completion.
+ * Given tiles are cleaned: previous image RAM gets inverted image there, so every pixel of tile is driven
+ */
+void L2HAL_SSD1683_StartPartialRefresh(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* windows, uint8_t windowsCount,
+		FMGL_API_RegionStruct* tiles, uint8_t tilesCount);
+
+/**
+ * Remember, that RAM windows of framebuffer are shown now: copy them to back buffer (if attached) or update rows hashes
+ */
+void L2HAL_SSD1683_RememberShownWindows(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* windows, uint8_t windowsCount);
+
+/**
+ * Compare framebuffer with shown image and find regions (changed rows spans) to push. Returns regions count, 0 if nothing is changed
+ */
+uint8_t L2HAL_SSD1683_FindChangedRegions(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* regions);
+
+/**
+ * Find first and last changed bytes of framebuffer row (comparing with back buffer). Returns false if row isn't changed
+ */
+bool L2HAL_SSD1683_FindRowChanges(L2HAL_SSD1683_ContextStruct* context, uint16_t y, uint16_t* firstByte, uint16_t* lastByte);
+
+/**
+ * Hash of framebuffer row
+ */
+uint32_t L2HAL_SSD1683_HashRow(L2HAL_SSD1683_ContextStruct* context, uint16_t y);
+
+/**
+ * Read (possibly unaligned) 32-bit word
+ */
+uint32_t L2HAL_SSD1683_ReadWord(uint8_t* address);
+
+/**
+ * Partial push of regions, common for synchronous and asynchronous versions. Doesn't wait for refresh completion
+ */
+void L2HAL_SSD1683_PushRegionsPartialInternal(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* regions, uint8_t regionsCount);
+
+/**
+ * Asynchronous refresh is impossible without back buffer
+ */
+void L2HAL_SSD1683_CheckBackBuffer(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Greyscale drawing is impossible without greyscale framebuffer
+ */
+void L2HAL_SSD1683_CheckGreyscaleFramebuffer(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Push greyscale framebuffer planes to display RAM and start greyscale update
+ */
+void L2HAL_SSD1683_StartGreyscaleRefresh(L2HAL_SSD1683_ContextStruct* context);
+
+/**
+ * Push bit plane (0 - low bits, 1 - high bits) of greyscale framebuffer with given command (internal use only)
+ */
+void L2HAL_SSD1683_PushGreyscalePlaneInternal(L2HAL_SSD1683_ContextStruct* context, uint8_t command, uint8_t plane);
+
+/**
+ * Convert color to grey level, 0 - black, 3 - white
+ */
+uint8_t L2HAL_SSD1683_GetGreyLevel(FMGL_API_ColorStruct color);
+
+/**
+ * Get window, covering whole display
+ */
+FMGL_API_RegionStruct L2HAL_SSD1683_GetFullScreenWindow(void);
+
 /**
  * If color is not fully black will return 0xFF, otherwise 0x00
  */
@@ -116,6 +265,43 @@ uint8_t L2HAL_SSD1683_BinarizeColor(FMGL_API_ColorStruct color);
 */
 void L2HAL_SSD1683_PushFramebufferInternal(L2HAL_SSD1683_ContextStruct* context, uint8_t command);
 
+/**
+* Push region of given buffer with given command, X coordinates are aligned to bytes (internal use only)
+*/
+void L2HAL_SSD1683_PushRegionInternal(L2HAL_SSD1683_ContextStruct* context, uint8_t command, uint8_t* buffer, FMGL_API_RegionStruct region);
+
+/**
+ * Convert regions to byte-aligned RAM windows, merging them when it reduces amount of data to send. Returns windows count
+ */
+uint8_t L2HAL_SSD1683_PrepareWindows(FMGL_API_RegionStruct* regions, uint8_t regionsCount, FMGL_API_RegionStruct* windows);
+
+/**
+ * Cost of pushing RAM window (in data bytes), see L2HAL_SSD1683_WINDOW_OVERHEAD
+ */
+uint32_t L2HAL_SSD1683_GetWindowCost(FMGL_API_RegionStruct window);
+
+/**
+ * Add pixels, which will be toggled by pushing windows, to tiles ghosting. Call it before windows are remembered as shown.
+ * Without back buffer toggled pixels are unknown and all pixels of windows are counted
+ */
+void L2HAL_SSD1683_AccumulateGhosting(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* windows, uint8_t windowsCount);
+
+/**
+ * Find tiles with ghosting not less than threshold (0 - no tiles). Returns tiles count
+ */
+uint8_t L2HAL_SSD1683_FindTilesToClean(L2HAL_SSD1683_ContextStruct* context, uint32_t threshold, FMGL_API_RegionStruct* tiles);
+
+/**
+ * Start partial refresh of windows with cleaning of given tiles, or full refresh if there are too many tiles
+ */
+void L2HAL_SSD1683_StartRefresh(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* windows, uint8_t windowsCount,
+		FMGL_API_RegionStruct* tiles, uint8_t tilesCount);
+
+/**
+* Push inverted region of framebuffer with given command (internal use only)
+*/
+void L2HAL_SSD1683_PushInvertedRegionInternal(L2HAL_SSD1683_ContextStruct* context, uint8_t command, FMGL_API_RegionStruct region);
+
 /**
  * Power display on
  */
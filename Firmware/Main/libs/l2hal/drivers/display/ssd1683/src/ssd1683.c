@@ -7,6 +7,8 @@
 
 #include "../include/ssd1683.h"
 #include "../include/ssd1683_private.h"
+#include "../../../../fmgl/include/fmgl_pixel_formats.h"
+#include "../../../../include/l2hal_aux.h"
 
 void L2HAL_SSD1683_Init
 (
@@ -27,9 +29,7 @@ void L2HAL_SSD1683_Init
 
 	FMGL_API_ColorStruct initColor,
 
-	bool isAutoFullRefresh,
-
-	uint8_t autoFullRefreshFramesCount
+	L2HAL_SSD1683_RefreshPolicyStruct refreshPolicy
 )
 {
 	context->SPIHandle = spiHandle;
@@ -48,10 +48,26 @@ void L2HAL_SSD1683_Init
 
 	context->IsDataTransferInProgress = true;
 
-	/* Auto full refresh */
-	context->IsAutoFullRefresh = isAutoFullRefresh;
-	context->AutoFullRefreshFramesCount = autoFullRefreshFramesCount;
-	context->FramesTillFullRefresh = autoFullRefreshFramesCount - 1;
+	/* Waveforms */
+	context->PartialWaveform = NULL;
+	context->IsPartialWaveformLoaded = false;
+	context->IsExternalTemperature = false;
+	context->IsTemperatureChanged = false;
+
+	/* Greyscale */
+	context->GreyscaleFramebuffer = NULL;
+	context->GreyscaleWaveform = NULL;
+	context->IsGreyscaleShown = false;
+
+	/* Ghosting control */
+	context->RefreshPolicy = refreshPolicy;
+	memset(context->TilesGhosting, 0x00, sizeof(context->TilesGhosting));
+
+	/* Asynchronous refresh */
+	context->IsRefreshInProgress = false;
+	context->BackBuffer = NULL;
+	context->PendingWindowsCount = 0;
+	context->RefreshCompletedCallback = NULL;
 
 	L2HAL_SSD1683_ResetDisplay(context);
 
@@ -61,21 +77,17 @@ void L2HAL_SSD1683_Init
 	HAL_Delay(L2HAL_SSD1683_DISPLAY_BOOT_TIME);
 	L2HAL_SSD1683_WaitForReadiness(context);
 
-	L2HAL_SSD1683_WriteCommand(context, 0x01); /* Set MUX as 300 */
-	L2HAL_SSD1683_WriteDataByte(context, 0x2B);
-	L2HAL_SSD1683_WriteDataByte(context, 0x01);
-	L2HAL_SSD1683_WriteDataByte(context, 0x00);
+	uint8_t mux[] = { 0x2B, 0x01, 0x00 };
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x01, mux, sizeof(mux)); /* Set MUX as 300 */
 
+	uint8_t borderWaveform = 0x01;
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x3C, &borderWaveform, 1); /* Border waveform */
 
-	L2HAL_SSD1683_WriteCommand(context, 0x3C); /* Border waveform */
-	L2HAL_SSD1683_WriteDataByte(context, 0x01);
+	uint8_t temperatureSensor = 0x80;
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x18, &temperatureSensor, 1); /* Read built-in temperature sensor */
 
-	L2HAL_SSD1683_WriteCommand(context, 0x18); /* Read built-in temperature sensor */
-	L2HAL_SSD1683_WriteDataByte(context, 0x80);
-
-
-	L2HAL_SSD1683_WriteCommand(context, 0x11); /* Data entry mode */
-	L2HAL_SSD1683_WriteDataByte(context, 0x03); /* X-mode */
+	uint8_t dataEntryMode = 0x03;
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x11, &dataEntryMode, 1); /* Data entry mode: X-mode */
 
 	/* Power on */
 	L2HAL_SSD1683_PowerOn(context);
@@ -140,19 +152,25 @@ void L2HAL_SSD1683_MarkDataTransferAsCompleted(L2HAL_SSD1683_ContextStruct *cont
  */
 void L2HAL_SSD1683_WriteCommand(L2HAL_SSD1683_ContextStruct *context, uint8_t command)
 {
-	context->IsDataTransferInProgress = true;
-
-	HAL_GPIO_WritePin(context->DataCommandPort, context->DataCommandPin, GPIO_PIN_RESET); /* 0 - Command */
+	L2HAL_SSD1683_WriteCommandSequence(context, command, NULL, 0);
+}
 
+/**
+ * Write command with parameters as one transaction (DC is switched while chip is selected)
+ */
+void L2HAL_SSD1683_WriteCommandSequence(L2HAL_SSD1683_ContextStruct *context, uint8_t command, uint8_t *parameters, uint8_t parametersCount)
+{
 	L2HAL_SSD1683_SelectChip(context, true);
 
-	if (HAL_SPI_Transmit_DMA(context->SPIHandle, &command, 1) != HAL_OK)
+	L2HAL_SSD1683_SetDataMode(context, false);
+	L2HAL_SSD1683_Transmit(context, &command, 1);
+
+	if (parametersCount > 0)
 	{
-		L2HAL_Error(Generic);
+		L2HAL_SSD1683_SetDataMode(context, true);
+		L2HAL_SSD1683_Transmit(context, parameters, parametersCount);
 	}
 
-	L2HAL_SSD1683_WaitForDataTransferCompletion(context);
-
 	L2HAL_SSD1683_SelectChip(context, false);
 }
 
@@ -161,11 +179,38 @@ void L2HAL_SSD1683_WriteCommand(L2HAL_SSD1683_ContextStruct *context, uint8_t co
  */
 void L2HAL_SSD1683_WriteData(L2HAL_SSD1683_ContextStruct *context, uint8_t *data, uint16_t dataSize)
 {
-	context->IsDataTransferInProgress = true;
+	L2HAL_SSD1683_SelectChip(context, true);
 
-	HAL_GPIO_WritePin(context->DataCommandPort, context->DataCommandPin, GPIO_PIN_SET); /* 1 - Data */
+	L2HAL_SSD1683_SetDataMode(context, true);
+	L2HAL_SSD1683_Transmit(context, data, dataSize);
 
-	L2HAL_SSD1683_SelectChip(context, true);
+	L2HAL_SSD1683_SelectChip(context, false);
+}
+
+/**
+ * Switch DC line: true - data, false - command. Allowed only between transfers
+ */
+void L2HAL_SSD1683_SetDataMode(L2HAL_SSD1683_ContextStruct *context, bool isData)
+{
+	HAL_GPIO_WritePin(context->DataCommandPort, context->DataCommandPin, isData ? GPIO_PIN_SET : GPIO_PIN_RESET); /* 1 - Data, 0 - Command */
+}
+
+/**
+ * Send bytes to selected chip and wait for completion. Small payloads are sent without DMA, DMA setup costs more than them
+ */
+void L2HAL_SSD1683_Transmit(L2HAL_SSD1683_ContextStruct *context, uint8_t *data, uint16_t dataSize)
+{
+	if (dataSize <= L2HAL_SSD1683_MAX_BLOCKING_TRANSFER_SIZE)
+	{
+		if (HAL_SPI_Transmit(context->SPIHandle, data, dataSize, L2HAL_SSD1683_IO_TIMEOUT) != HAL_OK)
+		{
+			L2HAL_Error(Generic);
+		}
+
+		return;
+	}
+
+	context->IsDataTransferInProgress = true;
 
 	if (HAL_SPI_Transmit_DMA(context->SPIHandle, data, dataSize) != HAL_OK)
 	{
@@ -173,8 +218,6 @@ void L2HAL_SSD1683_WriteData(L2HAL_SSD1683_ContextStruct *context, uint8_t *data
 	}
 
 	L2HAL_SSD1683_WaitForDataTransferCompletion(context);
-
-	L2HAL_SSD1683_SelectChip(context, false);
 }
 
 /**
@@ -190,58 +233,135 @@ void L2HAL_SSD1683_WriteDataByte(L2HAL_SSD1683_ContextStruct *context, uint8_t d
  */
 void L2HAL_SSD1683_SetPosition(L2HAL_SSD1683_ContextStruct *context, uint16_t x, uint16_t y)
 {
-	L2HAL_SSD1683_WriteCommand(context, 0x4E);
-	L2HAL_SSD1683_WriteDataByte(context, x >> 3);
+	uint8_t xAddress = x >> 3;
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x4E, &xAddress, 1);
 
-	L2HAL_SSD1683_WriteCommand(context, 0x4F);
-	L2HAL_SSD1683_WriteDataByte(context, y & 0xFF);
-	L2HAL_SSD1683_WriteDataByte(context, (y >> 8) & 0x01);
+	uint8_t yAddress[] = { y & 0xFF, (y >> 8) & 0x01 };
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x4F, yAddress, sizeof(yAddress));
 }
 
 void L2HAL_SSD1683_SetRange(L2HAL_SSD1683_ContextStruct *context, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
 {
-	L2HAL_SSD1683_WriteCommand(context, 0x11); // set ram entry mode
-	L2HAL_SSD1683_WriteDataByte(context, 0x03);    // x increase, y increase : normal mode
-
-	L2HAL_SSD1683_WriteCommand(context, 0x44);
-	L2HAL_SSD1683_WriteDataByte(context, x / 8);
-	L2HAL_SSD1683_WriteDataByte(context, (x + width - 1) / 8);
+	uint8_t entryMode = 0x03; // x increase, y increase : normal mode
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x11, &entryMode, 1); // set ram entry mode
 
-	L2HAL_SSD1683_WriteCommand(context, 0x45);
-	L2HAL_SSD1683_WriteDataByte(context, y % 256);
-	L2HAL_SSD1683_WriteDataByte(context, y / 256);
-	L2HAL_SSD1683_WriteDataByte(context, (y + height - 1) % 256);
-	L2HAL_SSD1683_WriteDataByte(context, (y + height - 1) / 256);
+	uint8_t xRange[] = { x / 8, (x + width - 1) / 8 };
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x44, xRange, sizeof(xRange));
 
-	L2HAL_SSD1683_WriteCommand(context, 0x4E);
-	L2HAL_SSD1683_WriteDataByte(context, x / 8);
+	uint8_t yRange[] = { y % 256, y / 256, (y + height - 1) % 256, (y + height - 1) / 256 };
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x45, yRange, sizeof(yRange));
 
-	L2HAL_SSD1683_WriteCommand(context, 0x4F);
-	L2HAL_SSD1683_WriteDataByte(context, y % 256);
-	L2HAL_SSD1683_WriteDataByte(context, y / 256);
+	L2HAL_SSD1683_SetPosition(context, x, y);
 }
 
 void L2HAL_SSD1683_Update(L2HAL_SSD1683_ContextStruct *context)
 {
-	L2HAL_SSD1683_WriteCommand(context, 0x22);
-	L2HAL_SSD1683_WriteDataByte(context, 0xF7);
+	L2HAL_SSD1683_SendTemperature(context);
 
-	L2HAL_SSD1683_WriteCommand(context, 0x20);
+	/* Full refresh loads waveform from OTP into LUT register */
+	context->IsPartialWaveformLoaded = false;
 
-	L2HAL_SSD1683_WaitForReadiness(context);
+	/* Without temperature loading (0x20 bit) display uses temperature, written to its register */
+	L2HAL_SSD1683_StartUpdate(context, context->IsExternalTemperature ? 0xD7 : 0xF7);
 }
 
 /**
- * Update display partially (not spatial, but "weak update")
+ * Start partial display update (not spatial, but "weak update"), don't wait for its completion
  */
 void L2HAL_SSD1683_PartialUpdate(L2HAL_SSD1683_ContextStruct *context)
 {
-	L2HAL_SSD1683_WriteCommand(context, 0x22);
-	L2HAL_SSD1683_WriteDataByte(context, 0xFF);
+	L2HAL_SSD1683_SendTemperature(context);
+
+	if (NULL == context->PartialWaveform)
+	{
+		L2HAL_SSD1683_StartUpdate(context, context->IsExternalTemperature ? 0xDF : 0xFF);
+		return;
+	}
+
+	if (!context->IsPartialWaveformLoaded)
+	{
+		L2HAL_SSD1683_LoadWaveform(context, context->PartialWaveform);
+		context->IsPartialWaveformLoaded = true;
+	}
+
+	/* Neither temperature nor LUT are loaded, custom waveform is used as is */
+	L2HAL_SSD1683_StartUpdate(context, 0xCF);
+}
+
+/**
+ * Start greyscale display update, don't wait for its completion
+ */
+void L2HAL_SSD1683_GreyscaleUpdate(L2HAL_SSD1683_ContextStruct *context)
+{
+	L2HAL_SSD1683_SendTemperature(context);
+
+	L2HAL_SSD1683_LoadWaveform(context, context->GreyscaleWaveform);
+	context->IsPartialWaveformLoaded = false;
+
+	L2HAL_SSD1683_StartUpdate(context, 0xCF);
+}
+
+/**
+ * Send temperature to display if it was changed
+ */
+void L2HAL_SSD1683_SendTemperature(L2HAL_SSD1683_ContextStruct *context)
+{
+	if (!context->IsTemperatureChanged)
+	{
+		return;
+	}
+
+	/* 12 bits, two's complement */
+	uint8_t temperature[] = { ((uint16_t)context->Temperature >> 4) & 0xFF, ((uint16_t)context->Temperature & 0x0F) << 4 };
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x1A, temperature, sizeof(temperature));
+
+	context->IsTemperatureChanged = false;
+}
+
+/**
+ * Write waveform to display registers
+ */
+void L2HAL_SSD1683_LoadWaveform(L2HAL_SSD1683_ContextStruct *context, uint8_t* waveform)
+{
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x32, waveform, L2HAL_SSD1683_WAVEFORM_LUT_SIZE);
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x3F, &waveform[L2HAL_SSD1683_WAVEFORM_END_OPTION_OFFSET], 1);
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x03, &waveform[L2HAL_SSD1683_WAVEFORM_GATE_VOLTAGE_OFFSET], 1);
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x04, &waveform[L2HAL_SSD1683_WAVEFORM_SOURCE_VOLTAGES_OFFSET],
+			L2HAL_SSD1683_WAVEFORM_SOURCE_VOLTAGES_SIZE);
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x2C, &waveform[L2HAL_SSD1683_WAVEFORM_VCOM_OFFSET], 1);
+}
+
+/**
+ * Set ambient temperature (Celsius), display will use it instead of built-in sensor. Takes effect at next update
+ */
+void L2HAL_SSD1683_SetTemperature(L2HAL_SSD1683_ContextStruct* context, float temperature)
+{
+	/* Commands are ignored while display is busy, so temperature is sent right before update */
+	context->Temperature = (int16_t)(temperature * 16.0f);
+	context->IsTemperatureChanged = true;
+	context->IsExternalTemperature = true;
+}
+
+/**
+ * Set waveform for partial updates, NULL - use waveform from OTP. Takes effect at next update
+ */
+void L2HAL_SSD1683_SetPartialWaveform(L2HAL_SSD1683_ContextStruct* context, uint8_t* waveform)
+{
+	context->PartialWaveform = waveform;
+	context->IsPartialWaveformLoaded = false;
+}
 
+/**
+ * Start update with given display update sequence
+ */
+void L2HAL_SSD1683_StartUpdate(L2HAL_SSD1683_ContextStruct *context, uint8_t sequence)
+{
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x22, &sequence, 1);
 	L2HAL_SSD1683_WriteCommand(context, 0x20);
 
-	L2HAL_SSD1683_WaitForReadiness(context);
+	/* BUSY rises shortly after activation and stays high for whole refresh, so its falling edge can't be missed here */
+	context->IsRefreshInProgress = true;
+	context->LastUpdateTime = HAL_GetTick();
 }
 
 /**
@@ -288,39 +408,625 @@ void L2HAL_SSD1683_ClearFramebuffer(L2HAL_SSD1683_ContextStruct* context, FMGL_A
  * Push framebuffer to display
  */
 void L2HAL_SSD1683_PushFramebufferFull(L2HAL_SSD1683_ContextStruct* context)
+{
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+
+	L2HAL_SSD1683_StartFullRefresh(context);
+
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+}
+
+/**
+ * Push framebuffer to display (partial update). Framebuffer is compared with shown image (back buffer, or rows hashes
+ * if there is no back buffer), only changed rows spans are sent. Nothing is done if image is the same
+ */
+void L2HAL_SSD1683_PushFramebufferPartial(L2HAL_SSD1683_ContextStruct* context)
+{
+	FMGL_API_RegionStruct regions[L2HAL_SSD1683_MAX_WINDOWS];
+	uint8_t regionsCount = L2HAL_SSD1683_FindChangedRegions(context, regions);
+
+	if (0 == regionsCount)
+	{
+		return;
+	}
+
+	L2HAL_SSD1683_PushRegionsPartial(context, regions, regionsCount);
+}
+
+/**
+ * Push given framebuffer regions to display (partial update). Only byte-aligned RAM windows, covering regions, are sent,
+ * close windows are merged. Auto full refresh pushes whole framebuffer
+ */
+void L2HAL_SSD1683_PushRegionsPartial(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* regions, uint8_t regionsCount)
+{
+	L2HAL_SSD1683_PushRegionsPartialInternal(context, regions, regionsCount);
+
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+}
+
+/**
+ * Attach back buffer (L2HAL_SSD1683_FRAMEBUFFER_SIZE bytes), making asynchronous refresh possible
+ */
+void L2HAL_SSD1683_AttachBackBuffer(L2HAL_SSD1683_ContextStruct* context, uint8_t* backBuffer)
+{
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+
+	/* Framebuffer is shown after each refresh */
+	memcpy(backBuffer, context->Framebuffer, L2HAL_SSD1683_FRAMEBUFFER_SIZE);
+
+	context->BackBuffer = backBuffer;
+}
+
+/**
+ * Set callback, called (from interrupt context) when asynchronous refresh is completed. Could be NULL
+ */
+void L2HAL_SSD1683_SetRefreshCompletedCallback(L2HAL_SSD1683_ContextStruct* context, void (*callback)(void))
+{
+	context->RefreshCompletedCallback = callback;
+}
+
+/**
+ * Start full refresh and return immediately
+ */
+void L2HAL_SSD1683_PushFramebufferFullAsync(L2HAL_SSD1683_ContextStruct* context)
+{
+	L2HAL_SSD1683_CheckBackBuffer(context);
+
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+
+	L2HAL_SSD1683_StartFullRefresh(context);
+}
+
+/**
+ * Asynchronous version of L2HAL_SSD1683_PushFramebufferPartial()
+ */
+void L2HAL_SSD1683_PushFramebufferPartialAsync(L2HAL_SSD1683_ContextStruct* context)
+{
+	FMGL_API_RegionStruct regions[L2HAL_SSD1683_MAX_WINDOWS];
+	uint8_t regionsCount = L2HAL_SSD1683_FindChangedRegions(context, regions);
+
+	if (0 == regionsCount)
+	{
+		return;
+	}
+
+	L2HAL_SSD1683_PushRegionsPartialAsync(context, regions, regionsCount);
+}
+
+/**
+ * Asynchronous version of L2HAL_SSD1683_PushRegionsPartial()
+ */
+void L2HAL_SSD1683_PushRegionsPartialAsync(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* regions, uint8_t regionsCount)
+{
+	L2HAL_SSD1683_CheckBackBuffer(context);
+
+	L2HAL_SSD1683_PushRegionsPartialInternal(context, regions, regionsCount);
+}
+
+/**
+ * Returns true while display is refreshing
+ */
+bool L2HAL_SSD1683_IsRefreshInProgress(L2HAL_SSD1683_ContextStruct* context)
+{
+	return context->IsRefreshInProgress;
+}
+
+/**
+ * Hang till display refresh completed and finish it (update previous image RAM)
+ */
+void L2HAL_SSD1683_WaitForRefreshCompletion(L2HAL_SSD1683_ContextStruct* context)
+{
+	/* BUSY is polled directly, so it works even if BUSY interrupt isn't set up */
+	L2HAL_SSD1683_WaitForReadiness(context);
+	context->IsRefreshInProgress = false;
+
+	/* Partial update compares new image with previous one, so previous image RAM must match the displayed one.
+	 * It is updated only where image was changed */
+	uint8_t* shownImage = (NULL != context->BackBuffer) ? context->BackBuffer : context->Framebuffer;
+
+	for (uint8_t i = 0; i < context->PendingWindowsCount; i++)
+	{
+		L2HAL_SSD1683_PushRegionInternal(context, 0x26, shownImage, context->PendingWindows[i]);
+	}
+
+	context->PendingWindowsCount = 0;
+}
+
+/**
+ * Mark refresh as completed (call it from BUSY pin falling edge IRQ)
+ */
+void L2HAL_SSD1683_MarkRefreshAsCompleted(L2HAL_SSD1683_ContextStruct *context)
+{
+	/* BUSY also pulses after some commands, ignoring edges when refresh isn't running */
+	if (!context->IsRefreshInProgress || GPIO_PIN_SET == HAL_GPIO_ReadPin(context->BusyPort, context->BusyPin))
+	{
+		return;
+	}
+
+	context->IsRefreshInProgress = false;
+
+	if (NULL != context->RefreshCompletedCallback)
+	{
+		context->RefreshCompletedCallback();
+	}
+}
+
+/**
+ * Partial push of regions, common for synchronous and asynchronous versions. Doesn't wait for refresh completion
+ */
+void L2HAL_SSD1683_PushRegionsPartialInternal(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* regions, uint8_t regionsCount)
+{
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+
+	if (context->IsGreyscaleShown)
+	{
+		/* Display RAM contains greyscale planes, partial update would be meaningless */
+		L2HAL_SSD1683_StartFullRefresh(context);
+		return;
+	}
+
+	FMGL_API_RegionStruct windows[L2HAL_SSD1683_MAX_WINDOWS];
+	uint8_t windowsCount = L2HAL_SSD1683_PrepareWindows(regions, regionsCount, windows);
+
+	L2HAL_SSD1683_AccumulateGhosting(context, windows, windowsCount);
+
+	FMGL_API_RegionStruct tiles[L2HAL_SSD1683_GHOSTING_TILES_COUNT];
+	uint8_t tilesCount = L2HAL_SSD1683_FindTilesToClean(context, context->RefreshPolicy.TileGhostingBudget, tiles);
+
+	L2HAL_SSD1683_StartRefresh(context, windows, windowsCount, tiles, tilesCount);
+}
+
+/**
+ * Change refresh policy
+ */
+void L2HAL_SSD1683_SetRefreshPolicy(L2HAL_SSD1683_ContextStruct* context, L2HAL_SSD1683_RefreshPolicyStruct refreshPolicy)
+{
+	context->RefreshPolicy = refreshPolicy;
+}
+
+/**
+ * Call it periodically when there is nothing to draw. If display is idle, cleans ghosted tiles. Returns true if cleaning was started
+ */
+bool L2HAL_SSD1683_CleanOnIdle(L2HAL_SSD1683_ContextStruct* context)
+{
+	if
+	(
+		context->IsRefreshInProgress
+		||
+		context->IsGreyscaleShown
+		||
+		HAL_GetTick() - context->LastUpdateTime < context->RefreshPolicy.IdleTimeout
+	)
+	{
+		return false;
+	}
+
+	uint32_t threshold = (uint64_t)context->RefreshPolicy.TileGhostingBudget * context->RefreshPolicy.IdleCleaningPercent / 100U;
+
+	FMGL_API_RegionStruct tiles[L2HAL_SSD1683_GHOSTING_TILES_COUNT];
+	uint8_t tilesCount = L2HAL_SSD1683_FindTilesToClean(context, threshold, tiles);
+
+	if (0 == tilesCount)
+	{
+		return false;
+	}
+
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+
+	L2HAL_SSD1683_StartRefresh(context, NULL, 0, tiles, tilesCount);
+
+	if (NULL == context->BackBuffer)
+	{
+		/* Without back buffer previous image RAM is updated from framebuffer, it must not be changed till then */
+		L2HAL_SSD1683_WaitForRefreshCompletion(context);
+	}
+
+	return true;
+}
+
+/**
+ * Start partial refresh of windows with cleaning of given tiles, or full refresh if there are too many tiles
+ */
+void L2HAL_SSD1683_StartRefresh(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* windows, uint8_t windowsCount,
+		FMGL_API_RegionStruct* tiles, uint8_t tilesCount)
+{
+	if (tilesCount > 0 && tilesCount >= context->RefreshPolicy.FullRefreshTilesCount)
+	{
+		L2HAL_SSD1683_StartFullRefresh(context);
+	}
+	else
+	{
+		L2HAL_SSD1683_StartPartialRefresh(context, windows, windowsCount, tiles, tilesCount);
+	}
+}
+
+/**
+ * Push framebuffer to display RAM and start full update
+ */
+void L2HAL_SSD1683_StartFullRefresh(L2HAL_SSD1683_ContextStruct* context)
 {
 	L2HAL_SSD1683_PushFramebufferInternal(context, 0x26);
 	L2HAL_SSD1683_PushFramebufferInternal(context, 0x24);
 
+	FMGL_API_RegionStruct window = L2HAL_SSD1683_GetFullScreenWindow();
+	L2HAL_SSD1683_RememberShownWindows(context, &window, 1);
+
+	/* Full refresh removes all ghosting */
+	memset(context->TilesGhosting, 0x00, sizeof(context->TilesGhosting));
+	context->IsGreyscaleShown = false;
+
 	L2HAL_SSD1683_Update(context);
 }
 
 /**
- * Push framebuffer to display (partial update)
+ * Push greyscale framebuffer planes to display RAM and start greyscale update
  */
-void L2HAL_SSD1683_PushFramebufferPartial(L2HAL_SSD1683_ContextStruct* context)
+void L2HAL_SSD1683_StartGreyscaleRefresh(L2HAL_SSD1683_ContextStruct* context)
+{
+	/* Levels are set by pair of bits: high ones go to new image RAM, low ones to previous image RAM */
+	L2HAL_SSD1683_PushGreyscalePlaneInternal(context, 0x24, 1);
+	L2HAL_SSD1683_PushGreyscalePlaneInternal(context, 0x26, 0);
+
+	/* It is full refresh */
+	memset(context->TilesGhosting, 0x00, sizeof(context->TilesGhosting));
+	context->IsGreyscaleShown = true;
+
+	L2HAL_SSD1683_GreyscaleUpdate(context);
+}
+
+/**
+ * Push RAM windows to display RAM and start partial update. Windows are copied to previous image RAM after refresh completion.
+ * Given tiles are cleaned: previous image RAM gets inverted image there, so every pixel of tile is driven
+ */
+void L2HAL_SSD1683_StartPartialRefresh(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* windows, uint8_t windowsCount,
+		FMGL_API_RegionStruct* tiles, uint8_t tilesCount)
 {
-	if (context->IsAutoFullRefresh)
+	context->PendingWindowsCount = 0;
+
+	for (uint8_t i = 0; i < windowsCount; i++)
+	{
+		L2HAL_SSD1683_PushRegionInternal(context, 0x24, context->Framebuffer, windows[i]);
+
+		context->PendingWindows[context->PendingWindowsCount] = windows[i];
+		context->PendingWindowsCount ++;
+	}
+
+	L2HAL_SSD1683_RememberShownWindows(context, windows, windowsCount);
+
+	for (uint8_t i = 0; i < tilesCount; i++)
 	{
-		if (context->FramesTillFullRefresh > 0)
+		L2HAL_SSD1683_PushRegionInternal(context, 0x24, context->Framebuffer, tiles[i]);
+		L2HAL_SSD1683_PushInvertedRegionInternal(context, 0x26, tiles[i]);
+
+		context->TilesGhosting[(tiles[i].Y1 / L2HAL_SSD1683_GHOSTING_TILE_HEIGHT) * L2HAL_SSD1683_GHOSTING_TILES_PER_ROW
+			+ tiles[i].X1 / L2HAL_SSD1683_GHOSTING_TILE_WIDTH] = 0;
+
+		context->PendingWindows[context->PendingWindowsCount] = tiles[i];
+		context->PendingWindowsCount ++;
+	}
+
+	L2HAL_SSD1683_RememberShownWindows(context, tiles, tilesCount);
+
+	L2HAL_SSD1683_PartialUpdate(context);
+}
+
+/**
+ * Add pixels, which will be toggled by pushing windows, to tiles ghosting. Call it before windows are remembered as shown
+ */
+void L2HAL_SSD1683_AccumulateGhosting(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* windows, uint8_t windowsCount)
+{
+	for (uint8_t i = 0; i < windowsCount; i++)
+	{
+		for (uint16_t y = windows[i].Y1; y <= windows[i].Y2; y++)
 		{
-			context->FramesTillFullRefresh --;
+			uint32_t* tilesRow = &context->TilesGhosting[(y / L2HAL_SSD1683_GHOSTING_TILE_HEIGHT) * L2HAL_SSD1683_GHOSTING_TILES_PER_ROW];
+
+			for (uint16_t index = windows[i].X1 >> 3; index <= windows[i].X2 >> 3; index++)
+			{
+				uint32_t offset = y * L2HAL_SSD1683_DISPLAY_LINE_SIZE + index;
 
-			L2HAL_SSD1683_PushFramebufferInternal(context, 0x24);
-			L2HAL_SSD1683_PartialUpdate(context);
+				tilesRow[index / L2HAL_SSD1683_GHOSTING_TILE_LINE_SIZE] += (NULL != context->BackBuffer)
+					? (uint32_t)__builtin_popcount(context->Framebuffer[offset] ^ context->BackBuffer[offset])
+					: 8U;
+			}
+		}
+	}
+}
+
+/**
+ * Find tiles with ghosting not less than threshold (0 - no tiles). Returns tiles count
+ */
+uint8_t L2HAL_SSD1683_FindTilesToClean(L2HAL_SSD1683_ContextStruct* context, uint32_t threshold, FMGL_API_RegionStruct* tiles)
+{
+	if (0 == threshold)
+	{
+		return 0;
+	}
+
+	uint8_t tilesCount = 0;
+
+	for (uint8_t tile = 0; tile < L2HAL_SSD1683_GHOSTING_TILES_COUNT; tile++)
+	{
+		if (context->TilesGhosting[tile] < threshold)
+		{
+			continue;
+		}
+
+		tiles[tilesCount].X1 = (tile % L2HAL_SSD1683_GHOSTING_TILES_PER_ROW) * L2HAL_SSD1683_GHOSTING_TILE_WIDTH;
+		tiles[tilesCount].Y1 = (tile / L2HAL_SSD1683_GHOSTING_TILES_PER_ROW) * L2HAL_SSD1683_GHOSTING_TILE_HEIGHT;
+		tiles[tilesCount].X2 = tiles[tilesCount].X1 + L2HAL_SSD1683_GHOSTING_TILE_WIDTH - 1;
+		tiles[tilesCount].Y2 = tiles[tilesCount].Y1 + L2HAL_SSD1683_GHOSTING_TILE_HEIGHT - 1;
+
+		tilesCount ++;
+	}
+
+	return tilesCount;
+}
+
+/**
+ * Remember, that RAM windows of framebuffer are shown now: copy them to back buffer (if attached) or update rows hashes
+ */
+void L2HAL_SSD1683_RememberShownWindows(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* windows, uint8_t windowsCount)
+{
+	for (uint8_t i = 0; i < windowsCount; i++)
+	{
+		uint16_t firstByte = windows[i].X1 >> 3;
+		uint16_t bytesCount = (windows[i].X2 >> 3) - firstByte + 1;
+
+		for (uint16_t y = windows[i].Y1; y <= windows[i].Y2; y++)
+		{
+			if (NULL == context->BackBuffer)
+			{
+				context->RowsHashes[y] = L2HAL_SSD1683_HashRow(context, y);
+				continue;
+			}
+
+			uint32_t offset = y * L2HAL_SSD1683_DISPLAY_LINE_SIZE + firstByte;
+			memcpy(&context->BackBuffer[offset], &context->Framebuffer[offset], bytesCount);
+		}
+	}
+}
+
+/**
+ * Compare framebuffer with shown image and find regions (changed rows spans) to push. Returns regions count, 0 if nothing is changed
+ */
+uint8_t L2HAL_SSD1683_FindChangedRegions(L2HAL_SSD1683_ContextStruct* context, FMGL_API_RegionStruct* regions)
+{
+	if (context->IsGreyscaleShown)
+	{
+		/* Everything differs from greyscale image */
+		regions[0] = L2HAL_SSD1683_GetFullScreenWindow();
+		return 1;
+	}
+
+	uint8_t regionsCount = 0;
+	bool isPreviousRowChanged = false;
+
+	for (uint16_t y = 0; y < L2HAL_SSD1683_DISPLAY_HEIGHT; y++)
+	{
+		uint16_t firstByte = 0;
+		uint16_t lastByte = L2HAL_SSD1683_DISPLAY_LINE_SIZE - 1;
+
+		bool isChanged = (NULL != context->BackBuffer)
+			? L2HAL_SSD1683_FindRowChanges(context, y, &firstByte, &lastByte)
+			: context->RowsHashes[y] != L2HAL_SSD1683_HashRow(context, y);
+
+		if (!isChanged)
+		{
+			isPreviousRowChanged = false;
+			continue;
+		}
+
+		uint16_t x1 = firstByte * 8;
+		uint16_t x2 = lastByte * 8 + 7;
+
+		/* Adjacent changed rows form one span. If there are too many spans, the last one grows */
+		if (isPreviousRowChanged || L2HAL_SSD1683_MAX_WINDOWS == regionsCount)
+		{
+			FMGL_API_RegionStruct* region = &regions[regionsCount - 1];
+
+			region->X1 = MIN(region->X1, x1);
+			region->X2 = MAX(region->X2, x2);
+			region->Y2 = y;
 		}
 		else
 		{
-			context->FramesTillFullRefresh = context->AutoFullRefreshFramesCount - 1;
+			regions[regionsCount].X1 = x1;
+			regions[regionsCount].Y1 = y;
+			regions[regionsCount].X2 = x2;
+			regions[regionsCount].Y2 = y;
 
-			L2HAL_SSD1683_PushFramebufferFull(context);
+			regionsCount ++;
 		}
+
+		isPreviousRowChanged = true;
 	}
-	else
+
+	return regionsCount;
+}
+
+/**
+ * Find first and last changed bytes of framebuffer row (comparing with back buffer). Returns false if row isn't changed
+ */
+bool L2HAL_SSD1683_FindRowChanges(L2HAL_SSD1683_ContextStruct* context, uint16_t y, uint16_t* firstByte, uint16_t* lastByte)
+{
+	uint8_t* row = &context->Framebuffer[y * L2HAL_SSD1683_DISPLAY_LINE_SIZE];
+	uint8_t* shownRow = &context->BackBuffer[y * L2HAL_SSD1683_DISPLAY_LINE_SIZE];
+
+	bool isChanged = false;
+
+	/* Words are XORed, only in changed words bytes are checked */
+	for (uint16_t word = 0; word < L2HAL_SSD1683_LINE_WORDS; word++)
 	{
-		L2HAL_SSD1683_PushFramebufferInternal(context, 0x24);
-		L2HAL_SSD1683_PartialUpdate(context);
+		if (0 == (L2HAL_SSD1683_ReadWord(&row[word * 4]) ^ L2HAL_SSD1683_ReadWord(&shownRow[word * 4])))
+		{
+			continue;
+		}
+
+		for (uint16_t index = word * 4; index < word * 4 + 4; index++)
+		{
+			if (row[index] == shownRow[index])
+			{
+				continue;
+			}
+
+			if (!isChanged)
+			{
+				*firstByte = index;
+				isChanged = true;
+			}
+
+			*lastByte = index;
+		}
 	}
+
+	for (uint16_t index = L2HAL_SSD1683_LINE_WORDS * 4; index < L2HAL_SSD1683_DISPLAY_LINE_SIZE; index++)
+	{
+		if (row[index] == shownRow[index])
+		{
+			continue;
+		}
+
+		if (!isChanged)
+		{
+			*firstByte = index;
+			isChanged = true;
+		}
+
+		*lastByte = index;
+	}
+
+	return isChanged;
+}
+
+/**
+ * Hash of framebuffer row
+ */
+uint32_t L2HAL_SSD1683_HashRow(L2HAL_SSD1683_ContextStruct* context, uint16_t y)
+{
+	uint8_t* row = &context->Framebuffer[y * L2HAL_SSD1683_DISPLAY_LINE_SIZE];
+	uint32_t hash = L2HAL_SSD1683_HASH_OFFSET;
+
+	for (uint16_t word = 0; word < L2HAL_SSD1683_LINE_WORDS; word++)
+	{
+		hash = (hash ^ L2HAL_SSD1683_ReadWord(&row[word * 4])) * L2HAL_SSD1683_HASH_PRIME;
+	}
+
+	for (uint16_t index = L2HAL_SSD1683_LINE_WORDS * 4; index < L2HAL_SSD1683_DISPLAY_LINE_SIZE; index++)
+	{
+		hash = (hash ^ row[index]) * L2HAL_SSD1683_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+/**
+ * Read (possibly unaligned) 32-bit word
+ */
+uint32_t L2HAL_SSD1683_ReadWord(uint8_t* address)
+{
+	uint32_t word;
+	memcpy(&word, address, sizeof(uint32_t)); /* Compiled to single load, Cortex-M4 allows unaligned access */
+
+	return word;
+}
+
+/**
+ * Get window, covering whole display
+ */
+FMGL_API_RegionStruct L2HAL_SSD1683_GetFullScreenWindow(void)
+{
+	FMGL_API_RegionStruct window;
+
+	window.X1 = 0;
+	window.Y1 = 0;
+	window.X2 = L2HAL_SSD1683_DISPLAY_WIDTH - 1;
+	window.Y2 = L2HAL_SSD1683_DISPLAY_HEIGHT - 1;
+
+	return window;
+}
+
+/**
+ * Asynchronous refresh is impossible without back buffer
+ */
+void L2HAL_SSD1683_CheckBackBuffer(L2HAL_SSD1683_ContextStruct* context)
+{
+	if (NULL == context->BackBuffer)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+}
+
+/**
+ * Greyscale drawing is impossible without greyscale framebuffer
+ */
+void L2HAL_SSD1683_CheckGreyscaleFramebuffer(L2HAL_SSD1683_ContextStruct* context)
+{
+	if (NULL == context->GreyscaleFramebuffer)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+}
+
+/**
+ * Convert regions to byte-aligned RAM windows, merging them when it reduces amount of data to send. Returns windows count
+ */
+uint8_t L2HAL_SSD1683_PrepareWindows(FMGL_API_RegionStruct* regions, uint8_t regionsCount, FMGL_API_RegionStruct* windows)
+{
+	if (regionsCount > L2HAL_SSD1683_MAX_WINDOWS)
+	{
+		windows[0] = L2HAL_SSD1683_GetFullScreenWindow();
+		return 1;
+	}
+
+	for (uint8_t i = 0; i < regionsCount; i++)
+	{
+		windows[i] = regions[i];
+		windows[i].X1 &= ~0x07U;
+		windows[i].X2 |= 0x07U;
+	}
+
+	uint8_t windowsCount = regionsCount;
+
+	/* Merging pairs while it makes pushing cheaper */
+	uint8_t i = 0;
+	while (i < windowsCount)
+	{
+		bool isMerged = false;
+
+		for (uint8_t j = i + 1; j < windowsCount; j++)
+		{
+			FMGL_API_RegionStruct merged;
+			merged.X1 = MIN(windows[i].X1, windows[j].X1);
+			merged.Y1 = MIN(windows[i].Y1, windows[j].Y1);
+			merged.X2 = MAX(windows[i].X2, windows[j].X2);
+			merged.Y2 = MAX(windows[i].Y2, windows[j].Y2);
+
+			if (L2HAL_SSD1683_GetWindowCost(merged) <= L2HAL_SSD1683_GetWindowCost(windows[i]) + L2HAL_SSD1683_GetWindowCost(windows[j]))
+			{
+				windows[i] = merged;
+
+				windowsCount --;
+				windows[j] = windows[windowsCount];
+
+				isMerged = true;
+				break;
+			}
+		}
+
+		/* Grown window may be worth merging with already checked ones */
+		i = isMerged ? 0 : i + 1;
+	}
+
+	return windowsCount;
+}
+
+/**
+ * Cost of pushing RAM window (in data bytes), see L2HAL_SSD1683_WINDOW_OVERHEAD
+ */
+uint32_t L2HAL_SSD1683_GetWindowCost(FMGL_API_RegionStruct window)
+{
+	return (uint32_t)((window.X2 - window.X1 + 1) >> 3) * (window.Y2 - window.Y1 + 1) + L2HAL_SSD1683_WINDOW_OVERHEAD;
 }
 
 /**
@@ -333,6 +1039,94 @@ void L2HAL_SSD1683_PushFramebufferInternal(L2HAL_SSD1683_ContextStruct* context,
 	L2HAL_SSD1683_WriteData(context, context->Framebuffer, L2HAL_SSD1683_DISPLAY_LINE_SIZE * L2HAL_SSD1683_DISPLAY_HEIGHT);
 }
 
+/**
+* Push bit plane (0 - low bits, 1 - high bits) of greyscale framebuffer with given command (internal use only)
+*/
+void L2HAL_SSD1683_PushGreyscalePlaneInternal(L2HAL_SSD1683_ContextStruct* context, uint8_t command, uint8_t plane)
+{
+	uint8_t chunk[L2HAL_SSD1683_GREYSCALE_CHUNK_LINES * L2HAL_SSD1683_DISPLAY_LINE_SIZE];
+
+	L2HAL_SSD1683_SetRange(context, 0, 0, L2HAL_SSD1683_DISPLAY_WIDTH, L2HAL_SSD1683_DISPLAY_HEIGHT);
+	L2HAL_SSD1683_WriteCommand(context, command);
+
+	L2HAL_SSD1683_SelectChip(context, true);
+	L2HAL_SSD1683_SetDataMode(context, true);
+
+	for (uint16_t y = 0; y < L2HAL_SSD1683_DISPLAY_HEIGHT; y += L2HAL_SSD1683_GREYSCALE_CHUNK_LINES)
+	{
+		uint16_t linesCount = MIN(L2HAL_SSD1683_GREYSCALE_CHUNK_LINES, L2HAL_SSD1683_DISPLAY_HEIGHT - y);
+
+		for (uint16_t line = 0; line < linesCount; line++)
+		{
+			FMGL_PF_Grey2ExtractPlane(&context->GreyscaleFramebuffer[(y + line) * L2HAL_SSD1683_GREYSCALE_LINE_SIZE],
+					L2HAL_SSD1683_DISPLAY_WIDTH, plane, &chunk[line * L2HAL_SSD1683_DISPLAY_LINE_SIZE]);
+		}
+
+		L2HAL_SSD1683_Transmit(context, chunk, linesCount * L2HAL_SSD1683_DISPLAY_LINE_SIZE);
+	}
+
+	L2HAL_SSD1683_SelectChip(context, false);
+}
+
+/**
+* Push inverted region of framebuffer with given command (internal use only)
+*/
+void L2HAL_SSD1683_PushInvertedRegionInternal(L2HAL_SSD1683_ContextStruct* context, uint8_t command, FMGL_API_RegionStruct region)
+{
+	uint16_t firstByte = region.X1 >> 3;
+	uint16_t bytesCount = (region.X2 >> 3) - firstByte + 1;
+	uint8_t row[L2HAL_SSD1683_DISPLAY_LINE_SIZE];
+
+	L2HAL_SSD1683_SetRange(context, firstByte * 8, region.Y1, bytesCount * 8, region.Y2 - region.Y1 + 1);
+	L2HAL_SSD1683_WriteCommand(context, command);
+
+	L2HAL_SSD1683_SelectChip(context, true);
+	L2HAL_SSD1683_SetDataMode(context, true);
+
+	for (uint16_t y = region.Y1; y <= region.Y2; y++)
+	{
+		for (uint16_t index = 0; index < bytesCount; index++)
+		{
+			row[index] = ~context->Framebuffer[y * L2HAL_SSD1683_DISPLAY_LINE_SIZE + firstByte + index];
+		}
+
+		L2HAL_SSD1683_Transmit(context, row, bytesCount);
+	}
+
+	L2HAL_SSD1683_SelectChip(context, false);
+}
+
+/**
+* Push region of given buffer with given command, X coordinates are aligned to bytes (internal use only)
+*/
+void L2HAL_SSD1683_PushRegionInternal(L2HAL_SSD1683_ContextStruct* context, uint8_t command, uint8_t* buffer, FMGL_API_RegionStruct region)
+{
+	uint16_t firstByte = region.X1 >> 3;
+	uint16_t bytesCount = (region.X2 >> 3) - firstByte + 1;
+	uint16_t height = region.Y2 - region.Y1 + 1;
+
+	L2HAL_SSD1683_SetRange(context, firstByte * 8, region.Y1, bytesCount * 8, height);
+	L2HAL_SSD1683_WriteCommand(context, command);
+
+	if (L2HAL_SSD1683_DISPLAY_LINE_SIZE == bytesCount)
+	{
+		/* Full-width lines are continuous in framebuffer */
+		L2HAL_SSD1683_WriteData(context, &buffer[region.Y1 * L2HAL_SSD1683_DISPLAY_LINE_SIZE], bytesCount * height);
+		return;
+	}
+
+	/* Rows are sent within one transaction */
+	L2HAL_SSD1683_SelectChip(context, true);
+	L2HAL_SSD1683_SetDataMode(context, true);
+
+	for (uint16_t y = region.Y1; y <= region.Y2; y++)
+	{
+		L2HAL_SSD1683_Transmit(context, &buffer[y * L2HAL_SSD1683_DISPLAY_LINE_SIZE + firstByte], bytesCount);
+	}
+
+	L2HAL_SSD1683_SelectChip(context, false);
+}
+
 /**
  * Draw pixel
  */
@@ -355,12 +1149,48 @@ FMGL_API_ColorStruct L2HAL_SSD1683_GetPixel(L2HAL_SSD1683_ContextStruct* context
 {
 	uint32_t index = (y * L2HAL_SSD1683_DISPLAY_LINE_SIZE + (x >> 3));
 
-	uint8_t bitNumber = x % 8;
+	uint8_t bitNumber = 7 - x % 8;
 
 	return (0 != (context->Framebuffer[index] & (1 << bitNumber))) ? WhiteColor : BlackColor;
 
 }
 
+/**
+ * Fill horizontal span [x1; x2] with active color. Coordinates must be on screen, x1 <= x2
+ */
+void L2HAL_SSD1683_FillSpan(L2HAL_SSD1683_ContextStruct* context, uint16_t x1, uint16_t x2, uint16_t y)
+{
+	FMGL_PF_Mono1FillSpan(&context->Framebuffer[y * L2HAL_SSD1683_DISPLAY_LINE_SIZE], x1, x2, context->BinarizedActiveColor, true);
+}
+
+/**
+ * Fill rectangle with active color. Coordinates must be on screen, x1 <= x2, y1 <= y2
+ */
+void L2HAL_SSD1683_FillRect(L2HAL_SSD1683_ContextStruct* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	FMGL_PF_Mono1FillRect(context->Framebuffer, L2HAL_SSD1683_DISPLAY_LINE_SIZE, x1, y1, x2, y2, context->BinarizedActiveColor, true);
+}
+
+/**
+ * Render top left width x height part of XBM image at (x, y). Rendered part must be on screen, active color is not changed
+ */
+void L2HAL_SSD1683_BlitMono1bpp
+(
+	L2HAL_SSD1683_ContextStruct* context,
+	uint16_t x,
+	uint16_t y,
+	FMGL_API_XBMImage* image,
+	uint16_t width,
+	uint16_t height,
+	FMGL_API_ColorStruct activeColor,
+	FMGL_API_ColorStruct inactiveColor,
+	FMGL_API_XBMTransparencyMode transparency
+)
+{
+	FMGL_PF_Mono1Blit(context->Framebuffer, L2HAL_SSD1683_DISPLAY_LINE_SIZE, x, y, image, width, height,
+			L2HAL_SSD1683_BinarizeColor(activeColor), L2HAL_SSD1683_BinarizeColor(inactiveColor), transparency, true);
+}
+
 /**
  * Save framebuffer to external memory
  */
@@ -389,13 +1219,108 @@ void L2HAL_SSD1683_LoadFramebuffer
 	FramebufferMemoryReadFunctionPtr(RAMContext, loadAddress, L2HAL_SSD1683_FRAMEBUFFER_SIZE, context->Framebuffer);
 }
 
+/**
+ * Attach greyscale framebuffer and greyscale waveform
+ */
+void L2HAL_SSD1683_AttachGreyscaleFramebuffer(L2HAL_SSD1683_ContextStruct* context, uint8_t* framebuffer, uint8_t* waveform)
+{
+	context->GreyscaleFramebuffer = framebuffer;
+	context->GreyscaleWaveform = waveform;
+
+	memset(context->GreyscaleFramebuffer, 0xFF, L2HAL_SSD1683_GREYSCALE_FRAMEBUFFER_SIZE);
+	context->GreyscaleActiveLevel = 0x00;
+}
+
+/**
+ * Set color what will be used for drawing into greyscale framebuffer
+ */
+void L2HAL_SSD1683_SetGreyscaleActiveColor(L2HAL_SSD1683_ContextStruct* context, FMGL_API_ColorStruct color)
+{
+	context->GreyscaleActiveLevel = L2HAL_SSD1683_GetGreyLevel(color);
+}
+
+/**
+ * Convert color to grey level, 0 - black, 3 - white
+ */
+uint8_t L2HAL_SSD1683_GetGreyLevel(FMGL_API_ColorStruct color)
+{
+	/* Luminance (BT.601 weights, sum is 256) */
+	uint32_t luminance = ((uint32_t)color.R * 77U + (uint32_t)color.G * 150U + (uint32_t)color.B * 29U) >> 8;
+
+	return (uint8_t)(luminance >> 6);
+}
+
+/**
+ * Draw pixel in greyscale framebuffer
+ */
+void L2HAL_SSD1683_DrawPixelGreyscale(L2HAL_SSD1683_ContextStruct* context, uint16_t x, uint16_t y)
+{
+	FMGL_PF_Grey2WritePixel(&context->GreyscaleFramebuffer[y * L2HAL_SSD1683_GREYSCALE_LINE_SIZE], x, context->GreyscaleActiveLevel);
+}
+
+/**
+ * Get pixel color from greyscale framebuffer
+ */
+FMGL_API_ColorStruct L2HAL_SSD1683_GetPixelGreyscale(L2HAL_SSD1683_ContextStruct* context, uint16_t x, uint16_t y)
+{
+	FMGL_API_ColorStruct result;
+
+	result.R = FMGL_PF_Grey2ReadPixel(&context->GreyscaleFramebuffer[y * L2HAL_SSD1683_GREYSCALE_LINE_SIZE], x)
+		* (FMGL_API_MAX_CHANNEL_BRIGHTNESS / 3U);
+	result.G = result.R;
+	result.B = result.R;
+
+	return result;
+}
+
+/**
+ * Fill horizontal span [x1; x2] of greyscale framebuffer with active color
+ */
+void L2HAL_SSD1683_FillSpanGreyscale(L2HAL_SSD1683_ContextStruct* context, uint16_t x1, uint16_t x2, uint16_t y)
+{
+	FMGL_PF_Grey2FillSpan(&context->GreyscaleFramebuffer[y * L2HAL_SSD1683_GREYSCALE_LINE_SIZE], x1, x2, context->GreyscaleActiveLevel);
+}
+
+/**
+ * Fill greyscale framebuffer with given color
+ */
+void L2HAL_SSD1683_ClearGreyscaleFramebuffer(L2HAL_SSD1683_ContextStruct* context, FMGL_API_ColorStruct clearColor)
+{
+	L2HAL_SSD1683_CheckGreyscaleFramebuffer(context);
+
+	memset(context->GreyscaleFramebuffer, L2HAL_SSD1683_GetGreyLevel(clearColor) * 0x55U, L2HAL_SSD1683_GREYSCALE_FRAMEBUFFER_SIZE);
+}
+
+/**
+ * Show greyscale framebuffer
+ */
+void L2HAL_SSD1683_PushGreyscaleFramebuffer(L2HAL_SSD1683_ContextStruct* context)
+{
+	L2HAL_SSD1683_PushGreyscaleFramebufferAsync(context);
+
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+}
+
+/**
+ * Start greyscale refresh and return immediately
+ */
+void L2HAL_SSD1683_PushGreyscaleFramebufferAsync(L2HAL_SSD1683_ContextStruct* context)
+{
+	L2HAL_SSD1683_CheckGreyscaleFramebuffer(context);
+
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+
+	/* Planes are in display RAM before return, there is nothing to sync after refresh */
+	L2HAL_SSD1683_StartGreyscaleRefresh(context);
+}
+
 /**
  * Power display on
  */
 void L2HAL_SSD1683_PowerOn(L2HAL_SSD1683_ContextStruct *context)
 {
-	L2HAL_SSD1683_WriteCommand(context, 0x22);
-	L2HAL_SSD1683_WriteDataByte(context, 0xE0);
+	uint8_t sequence = 0xE0;
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x22, &sequence, 1);
 	L2HAL_SSD1683_WriteCommand(context, 0x20);
 
 	L2HAL_SSD1683_WaitForReadiness(context);
@@ -406,9 +1331,11 @@ void L2HAL_SSD1683_PowerOn(L2HAL_SSD1683_ContextStruct *context)
  */
 void L2HAL_SSD1683_PowerOff(L2HAL_SSD1683_ContextStruct *context)
 {
-	L2HAL_SSD1683_WriteCommand(context, 0x22);
-	L2HAL_SSD1683_WriteDataByte(context, 0x83);
-	L2HAL_SSD1683_WriteDataByte(context, 0x20);
+	L2HAL_SSD1683_WaitForRefreshCompletion(context);
+
+	uint8_t sequence = 0x83;
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x22, &sequence, 1);
+	L2HAL_SSD1683_WriteCommand(context, 0x20); /* Master activation is a command, not a parameter */
 
 	L2HAL_SSD1683_WaitForReadiness(context);
 }
@@ -420,6 +1347,6 @@ void L2HAL_SSD1683_EnterDeepSleep(L2HAL_SSD1683_ContextStruct *context, bool isR
 {
 	L2HAL_SSD1683_PowerOff(context);
 
-	L2HAL_SSD1683_WriteCommand(context, 0x10);
-	L2HAL_SSD1683_WriteDataByte(context, isRetainRam ? 0x01 : 0x03);
+	uint8_t mode = isRetainRam ? 0x01 : 0x03;
+	L2HAL_SSD1683_WriteCommandSequence(context, 0x10, &mode, 1);
 }
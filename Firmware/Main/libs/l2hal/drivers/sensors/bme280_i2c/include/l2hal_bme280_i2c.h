@@ -24,6 +24,27 @@
 
 #define L2HAL_BME280_I2C_ZERO_CELSIUS_IN_KELVINS (273.15)
 
+/**
+ * Zero Celsius in hundredths of Kelvin (fixed-point temperature unit)
+ */
+#define L2HAL_BME280_I2C_ZERO_CELSIUS_IN_CENTIKELVINS 27315
+
+/**
+ * Fractional bits of fixed-point humidity and pressure
+ */
+#define L2HAL_BME280_I2C_FIXED_POINT_HUMIDITY_FRACTIONAL_BITS 10U
+#define L2HAL_BME280_I2C_FIXED_POINT_PRESSURE_FRACTIONAL_BITS 8U
+
+/**
+ * Size of data registers block (pressure, temperature, humidity)
+ */
+#define L2HAL_BME280_I2C_DATA_SIZE 8U
+
+/**
+ * Humidity control value, measurement control register address and measurement control value
+ */
+#define L2HAL_BME280_I2C_TRIGGER_BUFFER_SIZE 3U
+
 /**
  * Oversampling modes for all three subsensors
  */
@@ -37,6 +58,90 @@ enum L2HAL_BME280_I2C_OVERSAMPLING_MODE
 	L2HAL_BME280_I2C_OVERSAMPLING_16 = 0b101,
 };
 
+/**
+ * Inactive duration between measurements in normal mode
+ */
+enum L2HAL_BME280_I2C_STANDBY_TIME
+{
+	L2HAL_BME280_I2C_STANDBY_0_5_MS = 0b000,
+	L2HAL_BME280_I2C_STANDBY_10_MS = 0b110,
+	L2HAL_BME280_I2C_STANDBY_20_MS = 0b111,
+	L2HAL_BME280_I2C_STANDBY_62_5_MS = 0b001,
+	L2HAL_BME280_I2C_STANDBY_125_MS = 0b010,
+	L2HAL_BME280_I2C_STANDBY_250_MS = 0b011,
+	L2HAL_BME280_I2C_STANDBY_500_MS = 0b100,
+	L2HAL_BME280_I2C_STANDBY_1000_MS = 0b101,
+};
+
+/**
+ * IIR filter coefficient (filters temperature and pressure, humidity is not filtered)
+ */
+enum L2HAL_BME280_I2C_FILTER
+{
+	L2HAL_BME280_I2C_FILTER_OFF = 0b000,
+	L2HAL_BME280_I2C_FILTER_2 = 0b001,
+	L2HAL_BME280_I2C_FILTER_4 = 0b010,
+	L2HAL_BME280_I2C_FILTER_8 = 0b011,
+	L2HAL_BME280_I2C_FILTER_16 = 0b100,
+};
+
+/**
+ * Temperature compensation data (raw)
+ */
+typedef struct
+{
+	uint16_t T1;
+
+	int16_t T2;
+
+	int16_t T3;
+
+} L2HAL_BME280_I2C_TemperatureCompensationRawStruct;
+
+/**
+ * Pressure compensation data (raw)
+ */
+typedef struct
+{
+	uint16_t P1;
+
+	int16_t P2;
+
+	int16_t P3;
+
+	int16_t P4;
+
+	int16_t P5;
+
+	int16_t P6;
+
+	int16_t P7;
+
+	int16_t P8;
+
+	int16_t P9;
+
+} L2HAL_BME280_I2C_PressureCompensationRawStruct;
+
+/**
+ * Humidity compensation data (raw)
+ */
+typedef struct
+{
+	uint8_t H1;
+
+	int16_t H2;
+
+	uint8_t H3;
+
+	int16_t H4;
+
+	int16_t H5;
+
+	int8_t H6;
+
+} L2HAL_BME280_I2C_HumidityCompensationRawStruct;
+
 /**
  * Temperature compensation data
  */
@@ -102,6 +207,54 @@ typedef struct
 
 } L2HAL_BME280_I2C_HumidityCompensationStruct;
 
+/**
+ * Raw measurements
+ */
+typedef struct
+{
+	/**
+	 * Raw temperature (always shifted to 20 bits-wide)
+	 */
+	int32_t Temperature;
+
+	/**
+	 * Raw humidity
+	 */
+	uint16_t Humidity;
+
+	/**
+	 * Raw pressure (always shifted to 20 bits-wide)
+	 */
+	uint32_t Pressure;
+
+} L2HAL_BME280_I2C_RawMeasurementsStruct;
+
+/**
+ * Asynchronous measurement states
+ */
+enum L2HAL_BME280_I2C_ASYNC_STATE
+{
+	/**
+	 * No asynchronous measurement in progress
+	 */
+	L2HAL_BME280_I2C_ASYNC_IDLE,
+
+	/**
+	 * Control registers are being written (measurement start)
+	 */
+	L2HAL_BME280_I2C_ASYNC_TRIGGERING,
+
+	/**
+	 * Sensor is converting, we are waiting for conversion time to pass
+	 */
+	L2HAL_BME280_I2C_ASYNC_CONVERTING,
+
+	/**
+	 * Data registers are being read
+	 */
+	L2HAL_BME280_I2C_ASYNC_READING
+};
+
 /**
  * Sensor context
  */
@@ -132,29 +285,52 @@ typedef struct
 	 */
 	L2HAL_BME280_I2C_PressureCompensationStruct PressureCompensationData;
 
-} L2HAL_BME280_I2C_ContextStruct;
+	/**
+	 * Data for temperature compensation, as stored in sensor (for fixed-point compensation)
+	 */
+	L2HAL_BME280_I2C_TemperatureCompensationRawStruct TemperatureCompensationRawData;
 
-/**
- * Raw measurements
- */
-typedef struct
-{
 	/**
-	 * Raw temperature (always shifted to 20 bits-wide)
+	 * Data for humidity compensation, as stored in sensor
 	 */
-	int32_t Temperature;
+	L2HAL_BME280_I2C_HumidityCompensationRawStruct HumidityCompensationRawData;
 
 	/**
-	 * Raw humidity
+	 * Data for pressure compensation, as stored in sensor
 	 */
-	uint16_t Humidity;
+	L2HAL_BME280_I2C_PressureCompensationRawStruct PressureCompensationRawData;
 
 	/**
-	 * Raw pressure (always shifted to 20 bits-wide)
+	 * Asynchronous measurement state
 	 */
-	uint32_t Pressure;
+	volatile enum L2HAL_BME280_I2C_ASYNC_STATE AsyncState;
 
-} L2HAL_BME280_I2C_RawMeasurementsStruct;
+	/**
+	 * How many milliseconds left till conversion completion
+	 */
+	volatile uint16_t ConversionTimeLeft;
+
+	/**
+	 * Conversion time for current asynchronous measurement in milliseconds
+	 */
+	uint16_t ConversionTime;
+
+	/**
+	 * Control registers writes (register address - value pairs, first register address is sent as memory address)
+	 */
+	uint8_t TriggerBuffer[L2HAL_BME280_I2C_TRIGGER_BUFFER_SIZE];
+
+	/**
+	 * Data registers are read here
+	 */
+	uint8_t DataBuffer[L2HAL_BME280_I2C_DATA_SIZE];
+
+	/**
+	 * Called (from interrupt context) when asynchronous measurement is completed
+	 */
+	void (*MeasurementCompletedCallback)(L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements);
+
+} L2HAL_BME280_I2C_ContextStruct;
 
 /**
  * Creature-readable values
@@ -173,7 +349,29 @@ typedef struct
 L2HAL_BME280_I2C_CreatureReadableMeasurementsStruct;
 
 /**
- * Initialize sensor (we support only forced mode for now)
+ * Fixed-point values (calculated without floating point at all)
+ */
+typedef struct
+{
+	/**
+	 * Temperature in hundredths of Kelvin
+	 */
+	int32_t Temperature;
+
+	/**
+	 * Relative humidity in percents, Q22.10
+	 */
+	uint32_t Humidity;
+
+	/**
+	 * Pressure in Pascals, Q24.8
+	 */
+	uint32_t Pressure;
+}
+L2HAL_BME280_I2C_FixedPointMeasurementsStruct;
+
+/**
+ * Initialize sensor (it will be in sleep mode)
  */
 void L2HAL_BME280_I2C_Init(L2HAL_BME280_I2C_ContextStruct* context, I2C_HandleTypeDef* bus, uint8_t address);
 
@@ -193,6 +391,37 @@ void L2HAL_BME280_I2C_StartForcedMeasurement
 	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling
 );
 
+/**
+ * Start continuous measurements (normal mode): sensor measures, then sleeps for standby time and so on.
+ * Latest (filtered) measurement could be read at any time by L2HAL_BME280_I2C_GetMeasurementRaw() or
+ * L2HAL_BME280_I2C_ReadLatestMeasurementAsync(), nothing needs to be triggered
+ */
+void L2HAL_BME280_I2C_StartNormalMode
+(
+	L2HAL_BME280_I2C_ContextStruct* context,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE temperatureOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE humidityOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling,
+	enum L2HAL_BME280_I2C_STANDBY_TIME standbyTime,
+	enum L2HAL_BME280_I2C_FILTER filter
+);
+
+/**
+ * Stop continuous measurements, sensor goes to sleep mode
+ */
+void L2HAL_BME280_I2C_EnterSleepMode(L2HAL_BME280_I2C_ContextStruct* context);
+
+/**
+ * Maximal measurement time (in milliseconds, rounded up) for given oversampling modes. Forced measurement
+ * is guaranteed to be completed after this time, so there is no need to poll sensor status
+ */
+uint16_t L2HAL_BME280_I2C_GetMeasurementTime
+(
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE temperatureOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE humidityOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling
+);
+
 /**
  * Call it after L2HAL_BME280_I2C_StartForcedMeasurement to check if measurement completed
  */
@@ -203,6 +432,59 @@ bool L2HAL_BME280_I2C_IsMeasurementCompleted(L2HAL_BME280_I2C_ContextStruct* con
  */
 L2HAL_BME280_I2C_RawMeasurementsStruct L2HAL_BME280_I2C_GetMeasurementRaw(L2HAL_BME280_I2C_ContextStruct* context);
 
+/**
+ * Start forced measurement without blocking. Control registers are written via interrupt, then driver waits
+ * for datasheet maximal conversion time (call L2HAL_BME280_I2C_OnTick() each millisecond), then data is read
+ * via DMA (call L2HAL_BME280_I2C_ProcessAsyncMeasurement() from main loop to start reading) and callback
+ * is called with raw measurements (from interrupt context).
+ * Call L2HAL_BME280_I2C_MarkWriteAsCompleted() and L2HAL_BME280_I2C_MarkReadAsCompleted() from I2C memory
+ * TX and RX completion callbacks.
+ */
+void L2HAL_BME280_I2C_StartForcedMeasurementAsync
+(
+	L2HAL_BME280_I2C_ContextStruct* context,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE temperatureOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE humidityOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling,
+	void (*measurementCompletedCallback)(L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements)
+);
+
+/**
+ * Read latest measurement via DMA without triggering anything (use it in normal mode), callback is called
+ * with raw measurements (from interrupt context). Call it from main loop, not from SysTick handler
+ */
+void L2HAL_BME280_I2C_ReadLatestMeasurementAsync
+(
+	L2HAL_BME280_I2C_ContextStruct* context,
+	void (*measurementCompletedCallback)(L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements)
+);
+
+/**
+ * Returns true if asynchronous measurement is in progress
+ */
+bool L2HAL_BME280_I2C_IsAsyncMeasurementInProgress(L2HAL_BME280_I2C_ContextStruct* context);
+
+/**
+ * Call it from SysTick handler (each millisecond), it only counts conversion time down
+ */
+void L2HAL_BME280_I2C_OnTick(L2HAL_BME280_I2C_ContextStruct* context);
+
+/**
+ * Call it from main loop. Starts data reading when conversion time is passed (not from SysTick handler,
+ * because HAL sends register address in blocking mode, counting timeout with SysTick)
+ */
+void L2HAL_BME280_I2C_ProcessAsyncMeasurement(L2HAL_BME280_I2C_ContextStruct* context);
+
+/**
+ * Call it from HAL_I2C_MemTxCpltCallback() for sensor I2C instance
+ */
+void L2HAL_BME280_I2C_MarkWriteAsCompleted(L2HAL_BME280_I2C_ContextStruct* context);
+
+/**
+ * Call it from HAL_I2C_MemRxCpltCallback() for sensor I2C instance
+ */
+void L2HAL_BME280_I2C_MarkReadAsCompleted(L2HAL_BME280_I2C_ContextStruct* context);
+
 /**
  * Get creature-readable values
  */
@@ -212,5 +494,15 @@ L2HAL_BME280_I2C_CreatureReadableMeasurementsStruct L2HAL_BME280_I2C_GetCreature
 	L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements
 );
 
+/**
+ * Get fixed-point values (Bosch datasheet 32-bit and 64-bit integer compensation). Much faster than
+ * L2HAL_BME280_I2C_GetCreatureReadableValues() on MCUs without double precision FPU
+ */
+L2HAL_BME280_I2C_FixedPointMeasurementsStruct L2HAL_BME280_I2C_GetFixedPointValues
+(
+	L2HAL_BME280_I2C_ContextStruct* context,
+	L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements
+);
+
 
 #endif /* DRIVERS_SENSORS_BME280_I2C_INCLUDE_L2HAL_BME280_I2C_H_ */
@@ -31,9 +31,24 @@
 #define L2HAL_BME280_I2C_REGISTER_HUMIDITY_CONTROL 0xF2
 #define L2HAL_BME280_I2C_REGISTER_STATUS 0xF3
 #define L2HAL_BME280_I2C_REGISTER_MEASUREMENT_CONTROL 0xF4
+#define L2HAL_BME280_I2C_REGISTER_CONFIG 0xF5
 #define L2HAL_BME280_I2C_REGISTER_BASE_DATA_REGISTER 0xF7
 
 
+/**
+ * Sensor modes (measurement control register bits 1:0)
+ */
+#define L2HAL_BME280_I2C_MODE_SLEEP 0b00
+#define L2HAL_BME280_I2C_MODE_FORCED 0b01
+#define L2HAL_BME280_I2C_MODE_NORMAL 0b11
+
+/**
+ * Measurement time constants from datasheet (appendix B), in microseconds
+ */
+#define L2HAL_BME280_I2C_MEASUREMENT_TIME_BASE 1250U
+#define L2HAL_BME280_I2C_MEASUREMENT_TIME_PER_SAMPLE 2300U
+#define L2HAL_BME280_I2C_MEASUREMENT_TIME_PRESSURE_HUMIDITY_OVERHEAD 575U
+
 /**
  * Expected device ID
  */
@@ -45,51 +60,33 @@
 #define L2HAL_BME280_I2C_RESET_COMMAND 0xB6
 
 /**
- * Temperature compensation data (raw)
+ * Read data from count registers starting from baseAddress into buffer
  */
-typedef struct
-{
-	uint16_t T1;
-
-	int16_t T2;
-
-	int16_t T3;
-
-} L2HAL_BME280_I2C_TemperatureCompensationRawStruct;
+void L2HAL_BME280_I2C_ReadRegisters(L2HAL_BME280_I2C_ContextStruct* context, uint8_t baseAddress, uint8_t* buffer, uint8_t count);
 
 /**
- * Pressure compensation data (raw)
+ * Write value to register
  */
-typedef struct
-{
-	uint16_t P1;
-
-	int16_t P2;
-
-	int16_t P3;
-
-	int16_t P4;
-
-	int16_t P5;
-
-	int16_t P6;
-
-	int16_t P7;
-
-	int16_t P8;
-
-	int16_t P9;
+void L2HAL_BME280_I2C_WriteRegister(L2HAL_BME280_I2C_ContextStruct* context, uint8_t address, uint8_t value);
 
-} L2HAL_BME280_I2C_PressureCompensationRawStruct;
+/**
+ * Measurement control register value
+ */
+uint8_t L2HAL_BME280_I2C_GetMeasurementControl
+(
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE temperatureOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling,
+	uint8_t mode
+);
 
 /**
- * Read data from count registers starting from baseAddress into buffer
+ * Start data registers reading via DMA
  */
-void L2HAL_BME280_I2C_ReadRegisters(L2HAL_BME280_I2C_ContextStruct* context, uint8_t baseAddress, uint8_t* buffer, uint8_t count);
+void L2HAL_BME280_I2C_StartDataReading(L2HAL_BME280_I2C_ContextStruct* context);
 
 /**
- * Write value to register
+ * Parse contents of data registers
  */
-void L2HAL_BME280_I2C_WriteRegister(L2HAL_BME280_I2C_ContextStruct* context, uint8_t address, uint8_t value);
+L2HAL_BME280_I2C_RawMeasurementsStruct L2HAL_BME280_I2C_ParseData(uint8_t* data);
 
 #endif /* DRIVERS_SENSORS_BME280_I2C_INCLUDE_L2HAL_BME280_I2C_PRIVATE_H_ */
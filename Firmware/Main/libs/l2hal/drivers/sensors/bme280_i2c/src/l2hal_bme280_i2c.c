@@ -13,6 +13,8 @@ void L2HAL_BME280_I2C_Init(L2HAL_BME280_I2C_ContextStruct* context, I2C_HandleTy
 {
 	context->I2CHandle = bus;
 	context->BusAddress = address;
+	context->AsyncState = L2HAL_BME280_I2C_ASYNC_IDLE;
+	context->MeasurementCompletedCallback = NULL;
 
 	if (HAL_OK != HAL_I2C_IsDeviceReady(context->I2CHandle, context->BusAddress, 1, L2HAL_BME280_I2C_DETECTION_TIMEOUT))
 	{
@@ -34,39 +36,47 @@ void L2HAL_BME280_I2C_Init(L2HAL_BME280_I2C_ContextStruct* context, I2C_HandleTy
 	while (!L2HAL_BME280_I2C_IsMeasurementCompleted(context)) {}
 
 	/* Reading temperature compensation */
-	L2HAL_BME280_I2C_TemperatureCompensationRawStruct temperatureCompensationRaw;
-	L2HAL_BME280_I2C_ReadRegisters(context, L2HAL_BME280_I2C_REGISTER_BASE_TEMPERATURE_COMPENSATION, (uint8_t*)&temperatureCompensationRaw, sizeof(temperatureCompensationRaw));
+	L2HAL_BME280_I2C_TemperatureCompensationRawStruct* temperatureCompensationRaw = &context->TemperatureCompensationRawData;
+	L2HAL_BME280_I2C_ReadRegisters(context, L2HAL_BME280_I2C_REGISTER_BASE_TEMPERATURE_COMPENSATION, (uint8_t*)temperatureCompensationRaw, sizeof(*temperatureCompensationRaw));
 
-	context->TemperatureCompensationData.T1_DIV_1K = (double)temperatureCompensationRaw.T1 / 1024.0;
-	context->TemperatureCompensationData.T1_DIV_8K = (double)temperatureCompensationRaw.T1 / 8192.0;
-	context->TemperatureCompensationData.T2 = (double)temperatureCompensationRaw.T2;
-	context->TemperatureCompensationData.T3 = (double)temperatureCompensationRaw.T3;
+	context->TemperatureCompensationData.T1_DIV_1K = (double)temperatureCompensationRaw->T1 / 1024.0;
+	context->TemperatureCompensationData.T1_DIV_8K = (double)temperatureCompensationRaw->T1 / 8192.0;
+	context->TemperatureCompensationData.T2 = (double)temperatureCompensationRaw->T2;
+	context->TemperatureCompensationData.T3 = (double)temperatureCompensationRaw->T3;
 
-	/* Reading humidity compensation */
+	/* Reading humidity compensation (H4 and H5 are 12-bit signed, sharing one register) */
 	uint8_t humidityCompensationBytes[8];
 	L2HAL_BME280_I2C_ReadRegisters(context, 0xA1, (uint8_t*)&humidityCompensationBytes[0], 1);
 	L2HAL_BME280_I2C_ReadRegisters(context, 0xE1, (uint8_t*)&humidityCompensationBytes[1], 7);
 
-	context->HumidityCompensationData.H1 = (double)((uint8_t)humidityCompensationBytes[0]) / 524288.0;
-	context->HumidityCompensationData.H2 = (double)((int16_t)((humidityCompensationBytes[2] << 8) | humidityCompensationBytes[1])) / 65536.0;
-	context->HumidityCompensationData.H3 = (double)((uint8_t)(humidityCompensationBytes[3])) / 67108864.0;
-	context->HumidityCompensationData.H4 = (double)((int16_t)((humidityCompensationBytes[4] << 4) | (humidityCompensationBytes[5] & 0b1111))) * 64.0;
-	context->HumidityCompensationData.H5 = (double)((int16_t)(((humidityCompensationBytes[5] & 0b11110000) >> 4) | (humidityCompensationBytes[6] << 4))) / 16384.0;
-	context->HumidityCompensationData.H6 = (double)((int8_t)humidityCompensationBytes[7]) / 67108864.0;
+	L2HAL_BME280_I2C_HumidityCompensationRawStruct* humidityCompensationRaw = &context->HumidityCompensationRawData;
+	humidityCompensationRaw->H1 = humidityCompensationBytes[0];
+	humidityCompensationRaw->H2 = (int16_t)((humidityCompensationBytes[2] << 8) | humidityCompensationBytes[1]);
+	humidityCompensationRaw->H3 = humidityCompensationBytes[3];
+	humidityCompensationRaw->H4 = (int16_t)(((int8_t)humidityCompensationBytes[4] * 16) | (humidityCompensationBytes[5] & 0b1111));
+	humidityCompensationRaw->H5 = (int16_t)(((int8_t)humidityCompensationBytes[6] * 16) | ((humidityCompensationBytes[5] & 0b11110000) >> 4));
+	humidityCompensationRaw->H6 = (int8_t)humidityCompensationBytes[7];
+
+	context->HumidityCompensationData.H1 = (double)humidityCompensationRaw->H1 / 524288.0;
+	context->HumidityCompensationData.H2 = (double)humidityCompensationRaw->H2 / 65536.0;
+	context->HumidityCompensationData.H3 = (double)humidityCompensationRaw->H3 / 67108864.0;
+	context->HumidityCompensationData.H4 = (double)humidityCompensationRaw->H4 * 64.0;
+	context->HumidityCompensationData.H5 = (double)humidityCompensationRaw->H5 / 16384.0;
+	context->HumidityCompensationData.H6 = (double)humidityCompensationRaw->H6 / 67108864.0;
 
 	/* Reading pressure compensation */
-	L2HAL_BME280_I2C_PressureCompensationRawStruct pressureCompensationRaw;
-	L2HAL_BME280_I2C_ReadRegisters(context, L2HAL_BME280_I2C_REGISTER_BASE_PRESSURE_COMPENSATION, (uint8_t*)&pressureCompensationRaw, sizeof(pressureCompensationRaw));
-
-	context->PressureCompensationData.P1 = (double)pressureCompensationRaw.P1;
-	context->PressureCompensationData.P2 = (double)pressureCompensationRaw.P2 / 524288.0;
-	context->PressureCompensationData.P3 = (double)pressureCompensationRaw.P3 / (524288.0 * 524288.0);
-	context->PressureCompensationData.P4 = (double)pressureCompensationRaw.P4 * 65536.0;
-	context->PressureCompensationData.P5 = (double)pressureCompensationRaw.P5 * 2.0;
-	context->PressureCompensationData.P6 = (double)pressureCompensationRaw.P6 / 32768.0;
-	context->PressureCompensationData.P7 = (double)pressureCompensationRaw.P7;
-	context->PressureCompensationData.P8 = (double)pressureCompensationRaw.P8 / 32768.0;
-	context->PressureCompensationData.P9 = (double)pressureCompensationRaw.P9 / 2147483648.0;
+	L2HAL_BME280_I2C_PressureCompensationRawStruct* pressureCompensationRaw = &context->PressureCompensationRawData;
+	L2HAL_BME280_I2C_ReadRegisters(context, L2HAL_BME280_I2C_REGISTER_BASE_PRESSURE_COMPENSATION, (uint8_t*)pressureCompensationRaw, sizeof(*pressureCompensationRaw));
+
+	context->PressureCompensationData.P1 = (double)pressureCompensationRaw->P1;
+	context->PressureCompensationData.P2 = (double)pressureCompensationRaw->P2 / 524288.0;
+	context->PressureCompensationData.P3 = (double)pressureCompensationRaw->P3 / (524288.0 * 524288.0);
+	context->PressureCompensationData.P4 = (double)pressureCompensationRaw->P4 * 65536.0;
+	context->PressureCompensationData.P5 = (double)pressureCompensationRaw->P5 * 2.0;
+	context->PressureCompensationData.P6 = (double)pressureCompensationRaw->P6 / 32768.0;
+	context->PressureCompensationData.P7 = (double)pressureCompensationRaw->P7;
+	context->PressureCompensationData.P8 = (double)pressureCompensationRaw->P8 / 32768.0;
+	context->PressureCompensationData.P9 = (double)pressureCompensationRaw->P9 / 2147483648.0;
 }
 
 void L2HAL_BME280_I2C_ReadRegisters(L2HAL_BME280_I2C_ContextStruct* context, uint8_t baseAddress, uint8_t* buffer, uint8_t count)
@@ -102,7 +112,191 @@ void L2HAL_BME280_I2C_StartForcedMeasurement
 	L2HAL_BME280_I2C_WriteRegister(context, L2HAL_BME280_I2C_REGISTER_HUMIDITY_CONTROL, humidityOversampling);
 
 	/* Control temperature and pressure and run measurement */
-	L2HAL_BME280_I2C_WriteRegister(context, L2HAL_BME280_I2C_REGISTER_MEASUREMENT_CONTROL, (temperatureOversampling << 5) | (pressureOversampling << 2) | 0b01);
+	L2HAL_BME280_I2C_WriteRegister(context, L2HAL_BME280_I2C_REGISTER_MEASUREMENT_CONTROL,
+			L2HAL_BME280_I2C_GetMeasurementControl(temperatureOversampling, pressureOversampling, L2HAL_BME280_I2C_MODE_FORCED));
+}
+
+void L2HAL_BME280_I2C_StartNormalMode
+(
+	L2HAL_BME280_I2C_ContextStruct* context,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE temperatureOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE humidityOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling,
+	enum L2HAL_BME280_I2C_STANDBY_TIME standbyTime,
+	enum L2HAL_BME280_I2C_FILTER filter
+)
+{
+	/* Config register writes may be ignored in normal mode, so going to sleep first */
+	L2HAL_BME280_I2C_EnterSleepMode(context);
+
+	L2HAL_BME280_I2C_WriteRegister(context, L2HAL_BME280_I2C_REGISTER_CONFIG, (standbyTime << 5) | (filter << 2));
+
+	/* Humidity control takes effect after measurement control write */
+	L2HAL_BME280_I2C_WriteRegister(context, L2HAL_BME280_I2C_REGISTER_HUMIDITY_CONTROL, humidityOversampling);
+
+	L2HAL_BME280_I2C_WriteRegister(context, L2HAL_BME280_I2C_REGISTER_MEASUREMENT_CONTROL,
+			L2HAL_BME280_I2C_GetMeasurementControl(temperatureOversampling, pressureOversampling, L2HAL_BME280_I2C_MODE_NORMAL));
+}
+
+void L2HAL_BME280_I2C_EnterSleepMode(L2HAL_BME280_I2C_ContextStruct* context)
+{
+	L2HAL_BME280_I2C_WriteRegister(context, L2HAL_BME280_I2C_REGISTER_MEASUREMENT_CONTROL, L2HAL_BME280_I2C_MODE_SLEEP);
+}
+
+uint8_t L2HAL_BME280_I2C_GetMeasurementControl
+(
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE temperatureOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling,
+	uint8_t mode
+)
+{
+	return (temperatureOversampling << 5) | (pressureOversampling << 2) | mode;
+}
+
+uint16_t L2HAL_BME280_I2C_GetMeasurementTime
+(
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE temperatureOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE humidityOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling
+)
+{
+	uint32_t time = L2HAL_BME280_I2C_MEASUREMENT_TIME_BASE;
+
+	/* Disabled subsensor takes no time, otherwise each sample takes the same time */
+	if (L2HAL_BME280_I2C_OVERSAMPLING_DISABLE_SENSOR != temperatureOversampling)
+	{
+		time += L2HAL_BME280_I2C_MEASUREMENT_TIME_PER_SAMPLE * (1U << (temperatureOversampling - 1));
+	}
+
+	if (L2HAL_BME280_I2C_OVERSAMPLING_DISABLE_SENSOR != pressureOversampling)
+	{
+		time += L2HAL_BME280_I2C_MEASUREMENT_TIME_PER_SAMPLE * (1U << (pressureOversampling - 1))
+				+ L2HAL_BME280_I2C_MEASUREMENT_TIME_PRESSURE_HUMIDITY_OVERHEAD;
+	}
+
+	if (L2HAL_BME280_I2C_OVERSAMPLING_DISABLE_SENSOR != humidityOversampling)
+	{
+		time += L2HAL_BME280_I2C_MEASUREMENT_TIME_PER_SAMPLE * (1U << (humidityOversampling - 1))
+				+ L2HAL_BME280_I2C_MEASUREMENT_TIME_PRESSURE_HUMIDITY_OVERHEAD;
+	}
+
+	/* Rounding up, plus one more millisecond, because first tick may come right after start */
+	return (uint16_t)((time + 999U) / 1000U + 1U);
+}
+
+void L2HAL_BME280_I2C_StartForcedMeasurementAsync
+(
+	L2HAL_BME280_I2C_ContextStruct* context,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE temperatureOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE humidityOversampling,
+	enum L2HAL_BME280_I2C_OVERSAMPLING_MODE pressureOversampling,
+	void (*measurementCompletedCallback)(L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements)
+)
+{
+	if (L2HAL_BME280_I2C_ASYNC_IDLE != context->AsyncState)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	context->MeasurementCompletedCallback = measurementCompletedCallback;
+	context->ConversionTime = L2HAL_BME280_I2C_GetMeasurementTime(temperatureOversampling, humidityOversampling, pressureOversampling);
+
+	/* Sensor doesn't auto-increment address on write, so we are sending register address - value pairs.
+	 * Humidity control takes effect only after measurement control write, so order matters */
+	context->TriggerBuffer[0] = humidityOversampling;
+	context->TriggerBuffer[1] = L2HAL_BME280_I2C_REGISTER_MEASUREMENT_CONTROL;
+	context->TriggerBuffer[2] = L2HAL_BME280_I2C_GetMeasurementControl(temperatureOversampling, pressureOversampling, L2HAL_BME280_I2C_MODE_FORCED);
+
+	context->AsyncState = L2HAL_BME280_I2C_ASYNC_TRIGGERING;
+
+	if (HAL_OK != HAL_I2C_Mem_Write_IT(context->I2CHandle, context->BusAddress, L2HAL_BME280_I2C_REGISTER_HUMIDITY_CONTROL, I2C_MEMADD_SIZE_8BIT,
+			context->TriggerBuffer, L2HAL_BME280_I2C_TRIGGER_BUFFER_SIZE))
+	{
+		L2HAL_Error(Generic);
+	}
+}
+
+bool L2HAL_BME280_I2C_IsAsyncMeasurementInProgress(L2HAL_BME280_I2C_ContextStruct* context)
+{
+	return L2HAL_BME280_I2C_ASYNC_IDLE != context->AsyncState;
+}
+
+void L2HAL_BME280_I2C_OnTick(L2HAL_BME280_I2C_ContextStruct* context)
+{
+	if (L2HAL_BME280_I2C_ASYNC_CONVERTING != context->AsyncState)
+	{
+		return;
+	}
+
+	if (context->ConversionTimeLeft > 0)
+	{
+		context->ConversionTimeLeft --;
+	}
+}
+
+void L2HAL_BME280_I2C_ProcessAsyncMeasurement(L2HAL_BME280_I2C_ContextStruct* context)
+{
+	if (L2HAL_BME280_I2C_ASYNC_CONVERTING != context->AsyncState || context->ConversionTimeLeft > 0)
+	{
+		return;
+	}
+
+	L2HAL_BME280_I2C_StartDataReading(context);
+}
+
+void L2HAL_BME280_I2C_ReadLatestMeasurementAsync
+(
+	L2HAL_BME280_I2C_ContextStruct* context,
+	void (*measurementCompletedCallback)(L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements)
+)
+{
+	if (L2HAL_BME280_I2C_ASYNC_IDLE != context->AsyncState)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	context->MeasurementCompletedCallback = measurementCompletedCallback;
+
+	L2HAL_BME280_I2C_StartDataReading(context);
+}
+
+void L2HAL_BME280_I2C_StartDataReading(L2HAL_BME280_I2C_ContextStruct* context)
+{
+	context->AsyncState = L2HAL_BME280_I2C_ASYNC_READING;
+
+	if (HAL_OK != HAL_I2C_Mem_Read_DMA(context->I2CHandle, context->BusAddress, L2HAL_BME280_I2C_REGISTER_BASE_DATA_REGISTER, I2C_MEMADD_SIZE_8BIT,
+			context->DataBuffer, L2HAL_BME280_I2C_DATA_SIZE))
+	{
+		L2HAL_Error(Generic);
+	}
+}
+
+void L2HAL_BME280_I2C_MarkWriteAsCompleted(L2HAL_BME280_I2C_ContextStruct* context)
+{
+	if (L2HAL_BME280_I2C_ASYNC_TRIGGERING != context->AsyncState)
+	{
+		return;
+	}
+
+	context->ConversionTimeLeft = context->ConversionTime;
+	context->AsyncState = L2HAL_BME280_I2C_ASYNC_CONVERTING;
+}
+
+void L2HAL_BME280_I2C_MarkReadAsCompleted(L2HAL_BME280_I2C_ContextStruct* context)
+{
+	if (L2HAL_BME280_I2C_ASYNC_READING != context->AsyncState)
+	{
+		return;
+	}
+
+	L2HAL_BME280_I2C_RawMeasurementsStruct result = L2HAL_BME280_I2C_ParseData(context->DataBuffer);
+
+	context->AsyncState = L2HAL_BME280_I2C_ASYNC_IDLE;
+
+	if (NULL != context->MeasurementCompletedCallback)
+	{
+		context->MeasurementCompletedCallback(result);
+	}
 }
 
 bool L2HAL_BME280_I2C_IsMeasurementCompleted(L2HAL_BME280_I2C_ContextStruct* context)
@@ -115,10 +309,16 @@ bool L2HAL_BME280_I2C_IsMeasurementCompleted(L2HAL_BME280_I2C_ContextStruct* con
 
 L2HAL_BME280_I2C_RawMeasurementsStruct L2HAL_BME280_I2C_GetMeasurementRaw(L2HAL_BME280_I2C_ContextStruct* context)
 {
-	L2HAL_BME280_I2C_RawMeasurementsStruct result;
-	uint8_t data[8];
+	uint8_t data[L2HAL_BME280_I2C_DATA_SIZE];
+
+	L2HAL_BME280_I2C_ReadRegisters(context, L2HAL_BME280_I2C_REGISTER_BASE_DATA_REGISTER, data, L2HAL_BME280_I2C_DATA_SIZE);
 
-	L2HAL_BME280_I2C_ReadRegisters(context, L2HAL_BME280_I2C_REGISTER_BASE_DATA_REGISTER, data, 8);
+	return L2HAL_BME280_I2C_ParseData(data);
+}
+
+L2HAL_BME280_I2C_RawMeasurementsStruct L2HAL_BME280_I2C_ParseData(uint8_t* data)
+{
+	L2HAL_BME280_I2C_RawMeasurementsStruct result;
 
 	uint32_t data_msb;
 	uint32_t data_lsb;
@@ -201,3 +401,74 @@ L2HAL_BME280_I2C_CreatureReadableMeasurementsStruct L2HAL_BME280_I2C_GetCreature
 	return result;
 }
 
+L2HAL_BME280_I2C_FixedPointMeasurementsStruct L2HAL_BME280_I2C_GetFixedPointValues
+(
+	L2HAL_BME280_I2C_ContextStruct* context,
+	L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements
+)
+{
+	L2HAL_BME280_I2C_FixedPointMeasurementsStruct result;
+
+	L2HAL_BME280_I2C_TemperatureCompensationRawStruct* t = &context->TemperatureCompensationRawData;
+	L2HAL_BME280_I2C_HumidityCompensationRawStruct* h = &context->HumidityCompensationRawData;
+	L2HAL_BME280_I2C_PressureCompensationRawStruct* p = &context->PressureCompensationRawData;
+
+	/* Temperature */
+	int32_t rawTemperature = rawMeasurements.Temperature;
+
+	int32_t t_var1 = ((((rawTemperature >> 3) - ((int32_t)t->T1 << 1))) * (int32_t)t->T2) >> 11;
+
+	int32_t t_var2 = (rawTemperature >> 4) - (int32_t)t->T1;
+	t_var2 = (((t_var2 * t_var2) >> 12) * (int32_t)t->T3) >> 14;
+
+	int32_t t_fine = t_var1 + t_var2;
+
+	/* Datasheet gives hundredths of Celsius */
+	result.Temperature = ((t_fine * 5 + 128) >> 8) + L2HAL_BME280_I2C_ZERO_CELSIUS_IN_CENTIKELVINS;
+
+	/* Humidity */
+	int32_t h_var = t_fine - (int32_t)76800;
+
+	h_var = (((((int32_t)rawMeasurements.Humidity << 14) - ((int32_t)h->H4 << 20) - ((int32_t)h->H5 * h_var)) + (int32_t)16384) >> 15)
+			* (((((((h_var * (int32_t)h->H6) >> 10) * (((h_var * (int32_t)h->H3) >> 11) + (int32_t)32768)) >> 10) + (int32_t)2097152)
+			* (int32_t)h->H2 + 8192) >> 14);
+
+	h_var = h_var - (((((h_var >> 15) * (h_var >> 15)) >> 7) * (int32_t)h->H1) >> 4);
+
+	if (h_var < 0)
+	{
+		h_var = 0;
+	}
+	else if (h_var > 419430400)
+	{
+		/* 100% */
+		h_var = 419430400;
+	}
+
+	result.Humidity = (uint32_t)(h_var >> 12);
+
+	/* Pressure */
+	int64_t p_var1 = (int64_t)t_fine - 128000;
+	int64_t p_var2 = p_var1 * p_var1 * (int64_t)p->P6;
+	p_var2 = p_var2 + ((p_var1 * (int64_t)p->P5) << 17);
+	p_var2 = p_var2 + ((int64_t)p->P4 << 35);
+	p_var1 = ((p_var1 * p_var1 * (int64_t)p->P3) >> 8) + ((p_var1 * (int64_t)p->P2) << 12);
+	p_var1 = ((((int64_t)1 << 47) + p_var1) * (int64_t)p->P1) >> 33;
+
+	if (0 == p_var1)
+	{
+		/* Avoiding division by zero */
+		result.Pressure = 0;
+		return result;
+	}
+
+	int64_t pressure = 1048576 - (int64_t)rawMeasurements.Pressure;
+	pressure = (((pressure << 31) - p_var2) * 3125) / p_var1;
+	p_var1 = ((int64_t)p->P9 * (pressure >> 13) * (pressure >> 13)) >> 25;
+	p_var2 = ((int64_t)p->P8 * pressure) >> 19;
+	pressure = ((pressure + p_var1 + p_var2) >> 8) + ((int64_t)p->P7 << 4);
+
+	result.Pressure = (uint32_t)pressure;
+
+	return result;
+}
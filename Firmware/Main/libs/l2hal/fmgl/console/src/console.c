@@ -22,7 +22,7 @@ FMGL_Console_ContextStruct FMGL_ConsoleInit
 	context.FontSettings = fontSettings;
 
 	memset(context.LinesBuffer, 0x00, FMGL_CONSOLE_LINES_BUFFER_SIZE * FMGL_CONSOLE_MAX_LINE_LENGTH);
-	memset(context.LinesIndexes, 0x00, FMGL_CONSOLE_LINES_BUFFER_SIZE);
+	memset(context.LinesIndexes, 0x00, FMGL_CONSOLE_LINES_BUFFER_SIZE * sizeof(uint16_t));
 
 	context.LinesCount = 0;
 	context.LinesBufferNewestLineIndex = 0;
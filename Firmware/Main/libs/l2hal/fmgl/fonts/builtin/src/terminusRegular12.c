@@ -27,19 +27,47 @@
 
 #include "../include/terminusRegular12.h"
 
-uint16_t FMGL_FontTerminusRegular12GetCharacterWidth (void* context, uint8_t character)
+uint16_t FMGL_FontTerminusRegular12GetCharacterWidth (void* context, uint32_t character)
 {
 	return FMGL_FONT_TERMINUS_REGULAR_12_CHARACTER_WIDTH;
 }
 
-const uint8_t* FMGL_FontTerminusRegular12GetCharacterRaster(void* context, uint8_t character)
+const uint8_t* FMGL_FontTerminusRegular12GetCharacterRaster(void* context, uint32_t character)
 {
 	if (character < FMGL_FONT_TERMINUS_REGULAR_12_FIRST_CHARACTER_CODE)
 	{
 		return FMGL_FontTerminusRegular12_WrongCharacterCode;
 	}
 
-	return FMGL_FontTerminusRegular12Characters[character - FMGL_FONT_TERMINUS_REGULAR_12_FIRST_CHARACTER_CODE];
+	if (character < FMGL_FONT_TERMINUS_REGULAR_12_FIRST_NON_ASCII_CHARACTER_CODE)
+	{
+		return FMGL_FontTerminusRegular12Characters[character - FMGL_FONT_TERMINUS_REGULAR_12_FIRST_CHARACTER_CODE];
+	}
+
+	/* Binary search in Unicode -> KOI8-R table */
+	int32_t left = 0;
+	int32_t right = FMGL_FONT_TERMINUS_REGULAR_12_UNICODE_TABLE_LENGTH - 1;
+
+	while (left <= right)
+	{
+		int32_t middle = (left + right) / 2;
+		uint16_t codePoint = FMGL_FontTerminusRegular12UnicodeToKoi8R[middle].CodePoint;
+
+		if (codePoint == character)
+		{
+			return FMGL_FontTerminusRegular12Characters[FMGL_FontTerminusRegular12UnicodeToKoi8R[middle].Code - FMGL_FONT_TERMINUS_REGULAR_12_FIRST_CHARACTER_CODE];
+		}
+		else if (codePoint < character)
+		{
+			left = middle + 1;
+		}
+		else
+		{
+			right = middle - 1;
+		}
+	}
+
+	return FMGL_FontTerminusRegular12_WrongCharacterCode;
 }
 
 FMGL_API_Font FMGL_FontTerminusRegular12Init(void)
@@ -49,7 +77,8 @@ FMGL_API_Font FMGL_FontTerminusRegular12Init(void)
 	font.Height = FMGL_FONT_TERMINUS_REGULAR_12_CHARACTER_HEIGHT;
 	font.GetCharacterWidth = &FMGL_FontTerminusRegular12GetCharacterWidth;
 	font.GetCharacterRaster = &FMGL_FontTerminusRegular12GetCharacterRaster;
-	font.IsLoadable = false;
+	font.IsMSBFirst = false;
+	font.GetKerning = NULL;
 	font.Context = NULL;
 
 	return font;
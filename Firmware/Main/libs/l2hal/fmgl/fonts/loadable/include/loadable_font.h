@@ -9,12 +9,148 @@
 #define FMGL_FONTS_LOADABLE_INCLUDE_LOADABLE_FONT_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "../../../include/fmgl.h"
 
 /*
- * We are able to load not more than this number of characters
+ * SRAM budget for glyph metrics (in bytes, each glyph takes 8 bytes). If font metrics table fits into it, the whole
+ * table is kept in SRAM, otherwise budget is used as set-associative cache of metrics table, stored in memory
  */
-#define FMGL_LOADABLE_FONT_MAX_CHARACTERS_COUNT 256
+#ifndef FMGL_LOADABLE_FONT_METRICS_SRAM_SIZE
+	#define FMGL_LOADABLE_FONT_METRICS_SRAM_SIZE 2816
+#endif
+
+/*
+ * Metrics cache associativity. Glyph may be cached in any entry of set (glyph index % sets count)
+ */
+#ifndef FMGL_LOADABLE_FONT_METRICS_CACHE_WAYS
+	#define FMGL_LOADABLE_FONT_METRICS_CACHE_WAYS 4
+#endif
+
+/*
+ * How many glyphs metrics fit into SRAM budget
+ */
+#define FMGL_LOADABLE_FONT_METRICS_SRAM_ITEMS (FMGL_LOADABLE_FONT_METRICS_SRAM_SIZE / sizeof(FMGL_LoadableFont_CharacterMetricsStruct))
+
+/*
+ * Metrics cache sets count
+ */
+#define FMGL_LOADABLE_FONT_METRICS_CACHE_SETS (FMGL_LOADABLE_FONT_METRICS_SRAM_ITEMS / FMGL_LOADABLE_FONT_METRICS_CACHE_WAYS)
+
+/*
+ * Font can't have more than this number of contiguous code points ranges
+ */
+#ifndef FMGL_LOADABLE_FONT_MAX_CODE_RANGES
+	#define FMGL_LOADABLE_FONT_MAX_CODE_RANGES 64
+#endif
+
+/*
+ * Not more than this number of kerning pairs is loaded (each one takes 6 bytes of SRAM), extra pairs are ignored
+ */
+#ifndef FMGL_LOADABLE_FONT_MAX_KERNING_PAIRS
+	#define FMGL_LOADABLE_FONT_MAX_KERNING_PAIRS 128
+#endif
+
+/*
+ * Invalid glyph index. Font can't have more than FMGL_LOADABLE_FONT_NO_GLYPH characters
+ */
+#define FMGL_LOADABLE_FONT_NO_GLYPH 0xFFFF
+
+/*
+ * Glyph for code point 0 is shown instead of missing characters, it is always the first one
+ */
+#define FMGL_LOADABLE_FONT_MISSING_CHARACTER_GLYPH 0
+
+/*
+ * Glyph rasters cache size (in bytes). Cache is split into equal slots, each slot is big enough to store the largest
+ * raster of the font
+ */
+#ifndef FMGL_LOADABLE_FONT_RASTER_CACHE_SIZE
+	#define FMGL_LOADABLE_FONT_RASTER_CACHE_SIZE 4096
+#endif
+
+/*
+ * Cache will not have more than this number of slots, even if budget allows it
+ */
+#define FMGL_LOADABLE_FONT_RASTER_CACHE_MAX_SLOTS 64
+
+/*
+ * Cache slot value for glyphs, which are not cached
+ */
+#define FMGL_LOADABLE_FONT_NO_SLOT 0xFF
+
+/**
+ * Range of consecutive code points with consecutive glyphs
+ */
+typedef struct
+{
+	/**
+	 * First code point of range
+	 */
+	uint32_t FirstCode;
+
+	/**
+	 * Glyph index of first code point
+	 */
+	uint16_t FirstGlyph;
+
+	/**
+	 * How many code points range have
+	 */
+	uint16_t Count;
+}
+FMGL_LoadableFont_CodeRangeStruct;
+
+/**
+ * Glyph metrics. Metrics table (item per glyph) is stored in memory right before rasters, and is either copied to
+ * SRAM as a whole or, for large fonts, recently used items are cached in SRAM
+ */
+typedef struct
+{
+	/**
+	 * Address of glyph raster in memory
+	 */
+	uint32_t RasterAddress;
+
+	/**
+	 * Glyph raster size in memory (in bytes). If it is less than unpacked raster size (((Width + 7) / 8) * Height),
+	 * then raster is RLE-packed
+	 */
+	uint16_t RasterSize;
+
+	/**
+	 * Glyph raster width
+	 */
+	uint8_t Width;
+
+	/**
+	 * Glyph raster height
+	 */
+	uint8_t Height;
+}
+FMGL_LoadableFont_CharacterMetricsStruct;
+
+/**
+ * Kerning pair
+ */
+typedef struct
+{
+	/**
+	 * Left glyph index
+	 */
+	uint16_t LeftGlyph;
+
+	/**
+	 * Right glyph index
+	 */
+	uint16_t RightGlyph;
+
+	/**
+	 * Adjustment of distance between glyphs (in pixels)
+	 */
+	int16_t Value;
+}
+FMGL_LoadableFont_KerningPairStruct;
 
 /**
  * Loadable font context (characters data and so on are stored here)
@@ -55,14 +191,106 @@ typedef struct
 	uint32_t CharactersCount;
 
 	/**
-	 * Character code -> Character data address
+	 * How many bytes of memory, starting from BaseAddress, font occupies (metrics table and rasters)
+	 */
+	uint32_t MemorySize;
+
+	/**
+	 * Font must fit into this number of bytes, starting from BaseAddress
+	 */
+	uint32_t MaxMemorySize;
+
+	/**
+	 * Code point ranges, sorted by code point. Used to find glyph index by code point
+	 */
+	FMGL_LoadableFont_CodeRangeStruct CodeRanges[FMGL_LOADABLE_FONT_MAX_CODE_RANGES];
+
+	/**
+	 * How many code point ranges font have
+	 */
+	uint16_t CodeRangesCount;
+
+	/**
+	 * If true, Metrics contains the whole metrics table, otherwise it is metrics cache
+	 */
+	bool IsMetricsResident;
+
+	/**
+	 * Glyphs metrics: either metrics table (item per glyph) or cache. Cache is split into sets of
+	 * FMGL_LOADABLE_FONT_METRICS_CACHE_WAYS entries, entries of set are ordered from most to least recently used
+	 */
+	FMGL_LoadableFont_CharacterMetricsStruct Metrics[FMGL_LOADABLE_FONT_METRICS_SRAM_ITEMS];
+
+	/**
+	 * Metrics cache entry -> Glyph index, which metrics are stored in entry (or FMGL_LOADABLE_FONT_NO_GLYPH)
+	 */
+	uint16_t MetricsCacheGlyphs[FMGL_LOADABLE_FONT_METRICS_SRAM_ITEMS];
+
+	/**
+	 * Kerning pairs, sorted by left glyph, then by right glyph
+	 */
+	FMGL_LoadableFont_KerningPairStruct KerningPairs[FMGL_LOADABLE_FONT_MAX_KERNING_PAIRS];
+
+	/**
+	 * How many kerning pairs font have
 	 */
-	uint32_t CharacterDataAddresses[FMGL_LOADABLE_FONT_MAX_CHARACTERS_COUNT];
+	uint16_t KerningPairsCount;
+
+	/**
+	 * Cached rasters are stored here
+	 */
+	uint8_t RasterCache[FMGL_LOADABLE_FONT_RASTER_CACHE_SIZE];
+
+	/**
+	 * Size of one cache slot (size of largest unpacked raster)
+	 */
+	uint16_t RasterCacheSlotSize;
+
+	/**
+	 * How many slots cache have
+	 */
+	uint8_t RasterCacheSlotsCount;
+
+	/**
+	 * How many slots are pinned
+	 */
+	uint8_t RasterCachePinnedSlotsCount;
+
+	/**
+	 * Cache slot -> Glyph index, stored in slot (or FMGL_LOADABLE_FONT_NO_GLYPH)
+	 */
+	uint16_t RasterCacheSlotsGlyphs[FMGL_LOADABLE_FONT_RASTER_CACHE_MAX_SLOTS];
+
+	/**
+	 * If true, slot will never be evicted
+	 */
+	bool RasterCacheSlotsPinned[FMGL_LOADABLE_FONT_RASTER_CACHE_MAX_SLOTS];
+
+	/**
+	 * Cache slot -> Value of RasterCacheUseCounter at last slot access, used to find least recently used slot
+	 */
+	uint32_t RasterCacheSlotsLastUse[FMGL_LOADABLE_FONT_RASTER_CACHE_MAX_SLOTS];
+
+	/**
+	 * Incremented on each raster request
+	 */
+	uint32_t RasterCacheUseCounter;
+
+	/**
+	 * How many raster requests were served from cache
+	 */
+	uint32_t RasterCacheHits;
+
+	/**
+	 * How many raster requests required external memory read
+	 */
+	uint32_t RasterCacheMisses;
 }
 FMGL_LoadableFont_ContextStruct;
 
 /**
- * Load font from file
+ * Load font from file. Font occupies not more than maxMemorySize bytes of memory, starting from baseAddress,
+ * L2HAL_Error() is called if it doesn't fit
  */
 FMGL_API_Font FMGL_LoadableFont_Init
 (
@@ -76,23 +304,47 @@ FMGL_API_Font FMGL_LoadableFont_Init
 
 	void (*memoryReadFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*),
 
-	uint32_t baseAddress
+	uint32_t baseAddress,
+
+	uint32_t maxMemorySize
 );
 
 /**
- * Get character width by character code
+ * Get character width by character code (Unicode code point)
  */
-uint16_t FMGL_LoadableFont_GetCharacterWidth(FMGL_LoadableFont_ContextStruct* context, uint8_t character);
+uint16_t FMGL_LoadableFont_GetCharacterWidth(FMGL_LoadableFont_ContextStruct* context, uint32_t character);
 
 /**
  * Get character height by character code
  */
-uint16_t FMGL_LoadableFont_GetCharacterHeight(FMGL_LoadableFont_ContextStruct* context, uint8_t character);
+uint16_t FMGL_LoadableFont_GetCharacterHeight(FMGL_LoadableFont_ContextStruct* context, uint32_t character);
+
+/**
+ * Get kerning (distance adjustment in pixels) for pair of characters, 0 if font have no such pair
+ */
+int16_t FMGL_LoadableFont_GetKerning(FMGL_LoadableFont_ContextStruct* context, uint32_t left, uint32_t right);
+
+/**
+ * Get character raster by code. Raster is owned by font cache, DO NOT FREE IT. Pointer is valid only till next
+ * FMGL_LoadableFont_GetCharacterRaster() call (unless character is pinned)
+ */
+const uint8_t* FMGL_LoadableFont_GetCharacterRaster(FMGL_LoadableFont_ContextStruct* context, uint32_t character);
+
+/**
+ * Load character raster into cache and keep it here forever (till FMGL_LoadableFont_UnpinCharacter() call).
+ * Returns false if character can't be pinned (at least one cache slot must stay unpinned)
+ */
+bool FMGL_LoadableFont_PinCharacter(FMGL_LoadableFont_ContextStruct* context, uint32_t character);
+
+/**
+ * Allow character raster to be evicted from cache
+ */
+void FMGL_LoadableFont_UnpinCharacter(FMGL_LoadableFont_ContextStruct* context, uint32_t character);
 
 /**
- * Get character raster by code. DO NOT FORGET TO FREE THE POINTER AFTER USE
+ * Reset cache hits / misses counters
  */
-uint8_t* FMGL_LoadableFont_GetCharacterRaster(FMGL_LoadableFont_ContextStruct* context, uint8_t character);
+void FMGL_LoadableFont_ResetCacheStatistics(FMGL_LoadableFont_ContextStruct* context);
 
 
 #endif /* FMGL_FONTS_LOADABLE_INCLUDE_LOADABLE_FONT_H_ */
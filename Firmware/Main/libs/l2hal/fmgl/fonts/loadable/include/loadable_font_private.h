@@ -9,9 +9,43 @@
 #define FMGL_FONTS_LOADABLE_INCLUDE_LOADABLE_FONT_PRIVATE_H_
 
 #include <stdint.h>
+#include "../../../../../fatfs/ff.h"
+
+/*
+ * Font file format versions
+ */
+#define FMGL_LOADABLE_FONT_VERSION_1 1
+#define FMGL_LOADABLE_FONT_VERSION_2 2
+
+/*
+ * Version 2 glyph flags
+ */
+#define FMGL_LOADABLE_FONT_GLYPH_FLAG_RLE 0x0001
+
+/*
+ * Rasters are copied to memory by chunks of this size
+ */
+#define FMGL_LOADABLE_FONT_COPY_CHUNK_SIZE 512
+
+/*
+ * Characters table / metrics block is processed by this number of items at once
+ */
+#define FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS 16
+
+/*
+ * RLE-packed rasters are read from memory by chunks of this size
+ */
+#define FMGL_LOADABLE_FONT_UNPACK_CHUNK_SIZE 32
+
+/*
+ * RLE control byte: if MSB is set, next byte is repeated (control & 0x7F) + 2 times, otherwise (control + 1) literal bytes follow
+ */
+#define FMGL_LOADABLE_FONT_RLE_REPEAT_FLAG 0x80
+#define FMGL_LOADABLE_FONT_RLE_COUNT_MASK 0x7F
+#define FMGL_LOADABLE_FONT_RLE_MIN_REPEAT 2
 
 /**
- * Loadable font file header struct
+ * Loadable font file header struct (common for all versions)
  */
 typedef struct
 {
@@ -34,7 +68,7 @@ FMGL_LoadableFont_FileHeaderStruct;
 
 
 /**
- * Loadable font file character table item
+ * Version 1 loadable font file character table item
  */
 typedef struct
 {
@@ -52,7 +86,7 @@ FMGL_LoadableFont_FileCharacterTableItemStruct;
 
 
 /**
- * Loadable font file character data
+ * Version 1 loadable font file character data. Raster rows are LSB-first
  */
 typedef struct
 {
@@ -79,9 +113,179 @@ typedef struct
 FMGL_LoadableFont_FileCharacterDataStruct;
 
 /**
- * Get character data by character code. Will not load raster
+ * Size of version 1 character data header (width, height, raster size) in file
+ */
+#define FMGL_LOADABLE_FONT_CHARACTER_DATA_HEADER_SIZE (3 * sizeof(uint32_t))
+
+
+/**
+ * Version 2 header, follows common header. Version 2 file is:
+ * common header, version 2 header, metrics block (CharactersCount items), rasters block (RastersSize bytes),
+ * optional kerning block (pairs count (uint32), then pairs, sorted by left code, then by right code).
+ * Rasters are MSB-first, rows are byte-aligned, each raster starts at 4-bytes aligned offset
+ */
+typedef struct
+{
+	/**
+	 * Size of rasters block (in bytes)
+	 */
+	uint32_t RastersSize;
+}
+FMGL_LoadableFont_FileHeaderV2Struct;
+
+/**
+ * Version 2 metrics block item
+ */
+typedef struct
+{
+	/**
+	 * Character code
+	 */
+	uint32_t Code;
+
+	/**
+	 * Offset of raster from beginning of rasters block
+	 */
+	uint32_t RasterOffset;
+
+	/**
+	 * Raster size in file (packed size for RLE-packed rasters)
+	 */
+	uint16_t RasterSize;
+
+	/**
+	 * FMGL_LOADABLE_FONT_GLYPH_FLAG_xxx
+	 */
+	uint16_t Flags;
+
+	/**
+	 * Character raster width
+	 */
+	uint16_t Width;
+
+	/**
+	 * Character raster height
+	 */
+	uint16_t Height;
+}
+FMGL_LoadableFont_FileMetricsItemV2Struct;
+
+
+/**
+ * Version 2 kerning block item
+ */
+typedef struct
+{
+	/**
+	 * Left character code
+	 */
+	uint32_t Left;
+
+	/**
+	 * Right character code
+	 */
+	uint32_t Right;
+
+	/**
+	 * Adjustment of distance between characters (in pixels)
+	 */
+	int16_t Value;
+
+	/**
+	 * Reserved, must be 0
+	 */
+	uint16_t Reserved;
+}
+FMGL_LoadableFont_FileKerningPairV2Struct;
+
+
+/**
+ * Load version 1 font (file position must be right after common header)
+ */
+void FMGL_LoadableFont_LoadV1(FMGL_LoadableFont_ContextStruct* context, FIL* file);
+
+/**
+ * Load version 2 font (file position must be right after common header)
+ */
+void FMGL_LoadableFont_LoadV2(FMGL_LoadableFont_ContextStruct* context, FIL* file);
+
+/**
+ * Load version 2 kerning block (if file has it), file position must be right after rasters block
+ */
+void FMGL_LoadableFont_LoadKerningV2(FMGL_LoadableFont_ContextStruct* context, FIL* file);
+
+/**
+ * Read exactly given amount of bytes from file, L2HAL_Error() on failure
+ */
+void FMGL_LoadableFont_ReadFile(FIL* file, void* buffer, uint32_t size);
+
+/**
+ * Map character code to glyph index. Characters must be added in code ascending order, glyphs - in index ascending order
+ */
+void FMGL_LoadableFont_AddCharacter(FMGL_LoadableFont_ContextStruct* context, uint32_t code, uint32_t glyph);
+
+/**
+ * Find glyph index by character code, FMGL_LOADABLE_FONT_MISSING_CHARACTER_GLYPH if font have no such character
+ */
+uint16_t FMGL_LoadableFont_GetGlyph(FMGL_LoadableFont_ContextStruct* context, uint32_t character);
+
+/**
+ * Call L2HAL_Error() if font data [offset; offset + size) doesn't fit into font memory
+ */
+void FMGL_LoadableFont_CheckMemorySize(FMGL_LoadableFont_ContextStruct* context, uint32_t offset, uint32_t size);
+
+/**
+ * Address of glyph metrics in memory. Metrics table starts at BaseAddress, rasters follow it
+ */
+uint32_t FMGL_LoadableFont_GetMetricsAddress(FMGL_LoadableFont_ContextStruct* context, uint32_t glyph);
+
+/**
+ * Set glyph metrics, checking them. Raster cache slot size is adjusted to fit the glyph
+ */
+void FMGL_LoadableFont_SetMetrics(FMGL_LoadableFont_ContextStruct* context, FMGL_LoadableFont_CharacterMetricsStruct* metrics,
+		uint32_t width, uint32_t height, uint32_t rasterSize, bool isPacked);
+
+/**
+ * Unpacked raster size for given glyph
+ */
+uint16_t FMGL_LoadableFont_GetUnpackedRasterSize(const FMGL_LoadableFont_CharacterMetricsStruct* metrics);
+
+/**
+ * Read RLE-packed raster from memory, unpacking it into destination
+ */
+void FMGL_LoadableFont_UnpackRaster(FMGL_LoadableFont_ContextStruct* context, const FMGL_LoadableFont_CharacterMetricsStruct* metrics, uint8_t* destination);
+
+/**
+ * Reverse bits order in each byte of buffer (LSB-first <-> MSB-first)
+ */
+void FMGL_LoadableFont_ReverseBits(uint8_t* buffer, uint32_t size);
+
+/**
+ * Get glyph metrics by glyph index, reading them from memory if they aren't cached. Pointer is valid only till
+ * next metrics request
+ */
+const FMGL_LoadableFont_CharacterMetricsStruct* FMGL_LoadableFont_GetGlyphMetrics(FMGL_LoadableFont_ContextStruct* context, uint16_t glyph);
+
+/**
+ * Get character metrics by character code. Nonexistent characters are mapped to character with code 0
+ */
+const FMGL_LoadableFont_CharacterMetricsStruct* FMGL_LoadableFont_GetCharacterMetrics(FMGL_LoadableFont_ContextStruct* context, uint32_t character);
+
+/**
+ * Copy metrics table to SRAM (if it fits) or prepare empty metrics cache, then prepare empty rasters cache.
+ * Call it after metrics for all glyphs are loaded
+ */
+void FMGL_LoadableFont_InitCache(FMGL_LoadableFont_ContextStruct* context);
+
+/**
+ * Returns cache slot, containing raster of given glyph, or FMGL_LOADABLE_FONT_NO_SLOT if glyph isn't cached
+ */
+uint8_t FMGL_LoadableFont_FindCacheSlot(FMGL_LoadableFont_ContextStruct* context, uint16_t glyph);
+
+/**
+ * Returns cache slot with raster of given character. Loads raster from memory (evicting least recently used slot) if needed
  */
-FMGL_LoadableFont_FileCharacterDataStruct FMGL_LoadableFont_GetCharacterData(FMGL_LoadableFont_ContextStruct* context, uint8_t character);
+uint8_t FMGL_LoadableFont_GetCacheSlot(FMGL_LoadableFont_ContextStruct* context, uint32_t character);
 
 
 #endif /* FMGL_FONTS_LOADABLE_INCLUDE_LOADABLE_FONT_PRIVATE_H_ */
@@ -8,7 +8,7 @@
 #include "../include/loadable_font.h"
 #include "../include/loadable_font_private.h"
 #include "../../../../include/l2hal_errors.h"
-#include "../../../../../fatfs/ff.h"
+#include "../../../../include/l2hal_aux.h"
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
@@ -25,16 +25,18 @@ FMGL_API_Font FMGL_LoadableFont_Init
 
 	void (*memoryReadFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*),
 
-	uint32_t baseAddress
+	uint32_t baseAddress,
+
+	uint32_t maxMemorySize
 )
 {
 	context->MemoryDriverContext = memoryDriverContext;
 	context->MemoryWriteFunctionPtr = memoryWriteFunctionPtr;
 	context->MemoryReadFunctionPtr = memoryReadFunctionPtr;
 	context->BaseAddress = baseAddress;
+	context->MaxMemorySize = maxMemorySize;
 
 	FIL file;
-	size_t bytesRead;
 	FRESULT fResult = f_open(&file, path, FA_READ);
 	if (fResult != FR_OK)
 	{
@@ -44,162 +46,682 @@ FMGL_API_Font FMGL_LoadableFont_Init
 
 	/* Reading header */
 	FMGL_LoadableFont_FileHeaderStruct header;
+	FMGL_LoadableFont_ReadFile(&file, &header, sizeof(header));
 
-	fResult = f_read(&file, &header, sizeof(header), &bytesRead);
-	if (fResult != FR_OK)
+	/* Signature check */
+	if (0 != memcmp(header.Signature, "FMGLFONT", 8))
 	{
 		L2HAL_Error(Generic);
 	}
 
-	if (sizeof(header) != bytesRead)
+	context->CharactersCount = header.CharactersCount;
+
+	if (0 == context->CharactersCount || context->CharactersCount >= FMGL_LOADABLE_FONT_NO_GLYPH)
 	{
 		L2HAL_Error(Generic);
 	}
 
-	/* Signature check */
-	if (0 != memcmp(header.Signature, "FMGLFONT", 8))
+	/* Metrics table */
+	FMGL_LoadableFont_CheckMemorySize(context, 0, context->CharactersCount * sizeof(FMGL_LoadableFont_CharacterMetricsStruct));
+
+	context->CodeRangesCount = 0;
+	context->KerningPairsCount = 0;
+	context->RasterCacheSlotSize = 0;
+
+	/* Version check */
+	switch (header.Version)
 	{
-		L2HAL_Error(Generic);
+		case FMGL_LOADABLE_FONT_VERSION_1:
+			FMGL_LoadableFont_LoadV1(context, &file);
+			break;
+
+		case FMGL_LOADABLE_FONT_VERSION_2:
+			FMGL_LoadableFont_LoadV2(context, &file);
+			break;
+
+		default:
+			L2HAL_Error(Generic);
 	}
 
-	/* Version check */
-	if (1 != header.Version)
+	/* Nonexistent characters are mapped to character with code 0 */
+	if (0 != context->CodeRanges[0].FirstCode)
 	{
 		L2HAL_Error(Generic);
 	}
 
-	context->CharactersCount = header.CharactersCount;
-
-	if (context->CharactersCount > 255)
+	/* Done */
+	fResult = f_close(&file);
+	if (fResult != FR_OK)
 	{
-		/* Multibyte encodings aren't supported yet */
 		L2HAL_Error(Generic);
 	}
 
+	FMGL_LoadableFont_InitCache(context);
 
-	/* Reading characters table items to get offsets */
-	memset(context->CharacterDataAddresses, 0, FMGL_LOADABLE_FONT_MAX_CHARACTERS_COUNT);
+	FMGL_API_Font font;
+	font.Height = FMGL_LoadableFont_GetCharacterHeight(context, ' '); /* Use space as height base */
+	font.GetCharacterWidth = (uint16_t (*)(void *, uint32_t))&FMGL_LoadableFont_GetCharacterWidth;
+	font.GetCharacterRaster = (const uint8_t* (*)(void *, uint32_t))&FMGL_LoadableFont_GetCharacterRaster;
+	font.IsMSBFirst = true; /* Version 1 rasters are converted during load */
+	font.GetKerning = (int16_t (*)(void *, uint32_t, uint32_t))&FMGL_LoadableFont_GetKerning;
+	font.Context = context;
 
+	return font;
+}
+
+void FMGL_LoadableFont_LoadV1(FMGL_LoadableFont_ContextStruct* context, FIL* file)
+{
+	FMGL_LoadableFont_CharacterMetricsStruct metrics[FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS];
+
+	/* Reading characters table items to get offsets. Raster address temporarily contains character data offset in file */
 	FMGL_LoadableFont_FileCharacterTableItemStruct characterTableItem;
-	for (uint32_t i = 0; i < context->CharactersCount; i++)
+	for (uint32_t i = 0; i < context->CharactersCount; i += FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS)
 	{
-		fResult = f_read(&file, &characterTableItem, sizeof(characterTableItem), &bytesRead);
-		if (fResult != FR_OK)
+		uint32_t itemsCount = MIN(FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS, context->CharactersCount - i);
+
+		for (uint32_t item = 0; item < itemsCount; item++)
 		{
-			L2HAL_Error(Generic);
+			FMGL_LoadableFont_ReadFile(file, &characterTableItem, sizeof(characterTableItem));
+
+			FMGL_LoadableFont_AddCharacter(context, characterTableItem.Code, i + item);
+			metrics[item].RasterAddress = characterTableItem.Offset;
 		}
 
-		if (sizeof(characterTableItem) != bytesRead)
+		context->MemoryWriteFunctionPtr(context->MemoryDriverContext, FMGL_LoadableFont_GetMetricsAddress(context, i),
+				itemsCount * sizeof(metrics[0]), (uint8_t*)metrics);
+	}
+
+	/* Reading characters data, only rasters are stored in memory */
+	uint32_t nextRasterAddress = FMGL_LoadableFont_GetMetricsAddress(context, context->CharactersCount);
+
+	FMGL_LoadableFont_FileCharacterDataStruct characterData;
+	for (uint32_t i = 0; i < context->CharactersCount; i += FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS)
+	{
+		uint32_t itemsCount = MIN(FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS, context->CharactersCount - i);
+
+		context->MemoryReadFunctionPtr(context->MemoryDriverContext, FMGL_LoadableFont_GetMetricsAddress(context, i),
+				itemsCount * sizeof(metrics[0]), (uint8_t*)metrics);
+
+		for (uint32_t item = 0; item < itemsCount; item++)
 		{
-			L2HAL_Error(Generic);
+			/* Characters data must follow in the same order as characters table items */
+			if (metrics[item].RasterAddress != f_tell(file))
+			{
+				L2HAL_Error(Generic);
+			}
+
+			/* Width, height, raster size */
+			FMGL_LoadableFont_ReadFile(file, &characterData, FMGL_LOADABLE_FONT_CHARACTER_DATA_HEADER_SIZE);
+
+			FMGL_LoadableFont_SetMetrics(context, &metrics[item], characterData.Width, characterData.Height, characterData.RasterSize, false);
+			metrics[item].RasterAddress = nextRasterAddress;
+
+			FMGL_LoadableFont_CheckMemorySize(context, nextRasterAddress - context->BaseAddress, characterData.RasterSize);
+
+			/* Raster, converting it to MSB-first */
+			characterData.Raster = malloc(characterData.RasterSize);
+
+			FMGL_LoadableFont_ReadFile(file, characterData.Raster, characterData.RasterSize);
+			FMGL_LoadableFont_ReverseBits(characterData.Raster, characterData.RasterSize);
+
+			context->MemoryWriteFunctionPtr(context->MemoryDriverContext, nextRasterAddress, characterData.RasterSize, characterData.Raster);
+
+			free(characterData.Raster);
+
+			nextRasterAddress += characterData.RasterSize;
 		}
 
-		if (characterTableItem.Code > 255)
+		context->MemoryWriteFunctionPtr(context->MemoryDriverContext, FMGL_LoadableFont_GetMetricsAddress(context, i),
+				itemsCount * sizeof(metrics[0]), (uint8_t*)metrics);
+	}
+
+	context->MemorySize = nextRasterAddress - context->BaseAddress;
+}
+
+void FMGL_LoadableFont_LoadV2(FMGL_LoadableFont_ContextStruct* context, FIL* file)
+{
+	FMGL_LoadableFont_FileHeaderV2Struct header;
+	FMGL_LoadableFont_ReadFile(file, &header, sizeof(header));
+
+	/* Rasters follow metrics table */
+	uint32_t rastersAddress = FMGL_LoadableFont_GetMetricsAddress(context, context->CharactersCount);
+	FMGL_LoadableFont_CheckMemorySize(context, rastersAddress - context->BaseAddress, header.RastersSize);
+
+	/* Metrics block */
+	FMGL_LoadableFont_FileMetricsItemV2Struct items[FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS];
+	FMGL_LoadableFont_CharacterMetricsStruct metrics[FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS];
+	for (uint32_t i = 0; i < context->CharactersCount; i += FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS)
+	{
+		uint32_t itemsCount = MIN(FMGL_LOADABLE_FONT_METRICS_CHUNK_ITEMS, context->CharactersCount - i);
+
+		FMGL_LoadableFont_ReadFile(file, items, itemsCount * sizeof(items[0]));
+
+		for (uint32_t item = 0; item < itemsCount; item++)
 		{
-			/* Multibyte encodings aren't supported yet */
-			L2HAL_Error(Generic);
+			uint32_t glyph = i + item;
+
+			FMGL_LoadableFont_AddCharacter(context, items[item].Code, glyph);
+
+			FMGL_LoadableFont_SetMetrics
+			(
+				context,
+				&metrics[item],
+				items[item].Width,
+				items[item].Height,
+				items[item].RasterSize,
+				0 != (items[item].Flags & FMGL_LOADABLE_FONT_GLYPH_FLAG_RLE)
+			);
+
+			if (items[item].RasterOffset + items[item].RasterSize > header.RastersSize)
+			{
+				L2HAL_Error(Generic);
+			}
+
+			metrics[item].RasterAddress = rastersAddress + items[item].RasterOffset;
 		}
 
-		/* We have no header and characters table in external memory, so -16 - 8 * CharactersCount */
-		context->CharacterDataAddresses[characterTableItem.Code] = context->BaseAddress + characterTableItem.Offset - 16 - 8 * context->CharactersCount;
+		context->MemoryWriteFunctionPtr(context->MemoryDriverContext, FMGL_LoadableFont_GetMetricsAddress(context, i),
+				itemsCount * sizeof(metrics[0]), (uint8_t*)metrics);
+	}
+
+	/* Rasters block is copied as is */
+	uint8_t* buffer = malloc(FMGL_LOADABLE_FONT_COPY_CHUNK_SIZE);
+
+	for (uint32_t offset = 0; offset < header.RastersSize; offset += FMGL_LOADABLE_FONT_COPY_CHUNK_SIZE)
+	{
+		uint32_t chunkSize = MIN(FMGL_LOADABLE_FONT_COPY_CHUNK_SIZE, header.RastersSize - offset);
+
+		FMGL_LoadableFont_ReadFile(file, buffer, chunkSize);
+
+		context->MemoryWriteFunctionPtr(context->MemoryDriverContext, rastersAddress + offset, chunkSize, buffer);
+	}
+
+	free(buffer);
+
+	context->MemorySize = rastersAddress - context->BaseAddress + header.RastersSize;
+
+	FMGL_LoadableFont_LoadKerningV2(context, file);
+}
+
+void FMGL_LoadableFont_LoadKerningV2(FMGL_LoadableFont_ContextStruct* context, FIL* file)
+{
+	if (f_eof(file))
+	{
+		/* Font without kerning */
+		return;
 	}
 
-	/* Filling nonexistent characters */
-	for (uint32_t i = 0; i < FMGL_LOADABLE_FONT_MAX_CHARACTERS_COUNT; i++)
+	uint32_t pairsCount;
+	FMGL_LoadableFont_ReadFile(file, &pairsCount, sizeof(pairsCount));
+
+	/* Pairs are sorted by codes, so glyph indexes are sorted too */
+	FMGL_LoadableFont_FileKerningPairV2Struct pair;
+	for (uint32_t i = 0; i < MIN(pairsCount, FMGL_LOADABLE_FONT_MAX_KERNING_PAIRS); i++)
 	{
-		if (0 == context->CharacterDataAddresses[i])
+		FMGL_LoadableFont_ReadFile(file, &pair, sizeof(pair));
+
+		FMGL_LoadableFont_KerningPairStruct* kerningPair = &context->KerningPairs[context->KerningPairsCount];
+		kerningPair->LeftGlyph = FMGL_LoadableFont_GetGlyph(context, pair.Left);
+		kerningPair->RightGlyph = FMGL_LoadableFont_GetGlyph(context, pair.Right);
+		kerningPair->Value = pair.Value;
+
+		if (context->KerningPairsCount > 0)
 		{
-			context->CharacterDataAddresses[i] = context->CharacterDataAddresses[0]; /* Character with code 0 is nonexistent character */
+			FMGL_LoadableFont_KerningPairStruct* previousPair = &context->KerningPairs[context->KerningPairsCount - 1];
+
+			if (kerningPair->LeftGlyph < previousPair->LeftGlyph
+				|| (kerningPair->LeftGlyph == previousPair->LeftGlyph && kerningPair->RightGlyph <= previousPair->RightGlyph))
+			{
+				/* Unsorted pairs or pair for missing character */
+				L2HAL_Error(Generic);
+			}
 		}
+
+		context->KerningPairsCount ++;
 	}
+}
 
-	/* Reading characters data */
-	uint32_t nextCharacterDataAddress = context->BaseAddress;
+void FMGL_LoadableFont_ReadFile(FIL* file, void* buffer, uint32_t size)
+{
+	UINT bytesRead;
+	FRESULT fResult = f_read(file, buffer, size, &bytesRead);
+	if (fResult != FR_OK)
+	{
+		L2HAL_Error(Generic);
+	}
 
-	FMGL_LoadableFont_FileCharacterDataStruct characterData;
-	for (uint32_t i = 0; i < context->CharactersCount; i++)
+	if (size != bytesRead)
+	{
+		L2HAL_Error(Generic);
+	}
+}
+
+void FMGL_LoadableFont_AddCharacter(FMGL_LoadableFont_ContextStruct* context, uint32_t code, uint32_t glyph)
+{
+	if (context->CodeRangesCount > 0)
 	{
-		/* Width, height, raster size */
-		fResult = f_read(&file, &characterData, sizeof(characterData) - sizeof(characterData.Raster), &bytesRead);
-		if (fResult != FR_OK)
+		FMGL_LoadableFont_CodeRangeStruct* lastRange = &context->CodeRanges[context->CodeRangesCount - 1];
+
+		if (code < lastRange->FirstCode + lastRange->Count)
 		{
+			/* Characters must be sorted by code */
 			L2HAL_Error(Generic);
 		}
 
-		if (sizeof(characterData) - sizeof(characterData.Raster) != bytesRead)
+		if (code == lastRange->FirstCode + lastRange->Count && glyph == (uint32_t)lastRange->FirstGlyph + lastRange->Count)
 		{
-			L2HAL_Error(Generic);
+			/* Continuing last range */
+			lastRange->Count ++;
+			return;
 		}
+	}
 
-		context->MemoryWriteFunctionPtr(context->MemoryDriverContext, nextCharacterDataAddress, sizeof(characterData) - sizeof(characterData.Raster), (uint8_t*)&characterData);
+	if (FMGL_LOADABLE_FONT_MAX_CODE_RANGES == context->CodeRangesCount)
+	{
+		/* Font is too sparse */
+		L2HAL_Error(Generic);
+	}
+
+	FMGL_LoadableFont_CodeRangeStruct* range = &context->CodeRanges[context->CodeRangesCount];
+	range->FirstCode = code;
+	range->FirstGlyph = (uint16_t)glyph;
+	range->Count = 1;
+
+	context->CodeRangesCount ++;
+}
+
+uint16_t FMGL_LoadableFont_GetGlyph(FMGL_LoadableFont_ContextStruct* context, uint32_t character)
+{
+	int32_t left = 0;
+	int32_t right = context->CodeRangesCount - 1;
 
-		/* Raster */
-		characterData.Raster = malloc(characterData.RasterSize);
+	while (left <= right)
+	{
+		int32_t middle = (left + right) / 2;
+		const FMGL_LoadableFont_CodeRangeStruct* range = &context->CodeRanges[middle];
 
-		fResult = f_read(&file, characterData.Raster, characterData.RasterSize, &bytesRead);
-		if (fResult != FR_OK)
+		if (character < range->FirstCode)
 		{
-			L2HAL_Error(Generic);
+			right = middle - 1;
+		}
+		else if (character >= range->FirstCode + range->Count)
+		{
+			left = middle + 1;
+		}
+		else
+		{
+			return (uint16_t)(range->FirstGlyph + (character - range->FirstCode));
 		}
+	}
+
+	return FMGL_LOADABLE_FONT_MISSING_CHARACTER_GLYPH;
+}
+
+void FMGL_LoadableFont_CheckMemorySize(FMGL_LoadableFont_ContextStruct* context, uint32_t offset, uint32_t size)
+{
+	if (offset > context->MaxMemorySize || size > context->MaxMemorySize - offset)
+	{
+		/* Font doesn't fit into memory, given to it */
+		L2HAL_Error(Generic);
+	}
+}
+
+uint32_t FMGL_LoadableFont_GetMetricsAddress(FMGL_LoadableFont_ContextStruct* context, uint32_t glyph)
+{
+	return context->BaseAddress + glyph * sizeof(FMGL_LoadableFont_CharacterMetricsStruct);
+}
+
+void FMGL_LoadableFont_SetMetrics(FMGL_LoadableFont_ContextStruct* context, FMGL_LoadableFont_CharacterMetricsStruct* metrics,
+		uint32_t width, uint32_t height, uint32_t rasterSize, bool isPacked)
+{
+	if (width > UINT8_MAX || height > UINT8_MAX || rasterSize > UINT16_MAX)
+	{
+		L2HAL_Error(Generic);
+	}
+
+	metrics->Width = (uint8_t)width;
+	metrics->Height = (uint8_t)height;
+	metrics->RasterSize = (uint16_t)rasterSize;
+
+	/* Packed rasters are always smaller than unpacked ones, it's how we distinguish them later */
+	uint16_t unpackedSize = FMGL_LoadableFont_GetUnpackedRasterSize(metrics);
+	if ((isPacked && rasterSize >= unpackedSize) || (!isPacked && rasterSize != unpackedSize))
+	{
+		L2HAL_Error(Generic);
+	}
+
+	context->RasterCacheSlotSize = MAX(context->RasterCacheSlotSize, unpackedSize);
+}
+
+uint16_t FMGL_LoadableFont_GetUnpackedRasterSize(const FMGL_LoadableFont_CharacterMetricsStruct* metrics)
+{
+	return (uint16_t)(((metrics->Width + 7) / 8) * metrics->Height);
+}
+
+void FMGL_LoadableFont_UnpackRaster(FMGL_LoadableFont_ContextStruct* context, const FMGL_LoadableFont_CharacterMetricsStruct* metrics, uint8_t* destination)
+{
+	uint8_t chunk[FMGL_LOADABLE_FONT_UNPACK_CHUNK_SIZE];
+	uint32_t chunkPosition = FMGL_LOADABLE_FONT_UNPACK_CHUNK_SIZE;
+	uint32_t packedPosition = 0;
 
-		if (characterData.RasterSize != bytesRead)
+	uint16_t unpackedSize = FMGL_LoadableFont_GetUnpackedRasterSize(metrics);
+	uint16_t unpackedPosition = 0;
+
+	uint8_t control = 0;
+	uint16_t runLength = 0;
+	bool isRepeat = false;
+	bool isControlExpected = true;
+
+	while (unpackedPosition < unpackedSize)
+	{
+		if (packedPosition >= metrics->RasterSize)
 		{
+			/* Packed data ended too early */
 			L2HAL_Error(Generic);
 		}
 
-		context->MemoryWriteFunctionPtr(context->MemoryDriverContext, nextCharacterDataAddress + sizeof(characterData) - sizeof(characterData.Raster), characterData.RasterSize, characterData.Raster);
+		/* Refilling chunk */
+		if (chunkPosition == FMGL_LOADABLE_FONT_UNPACK_CHUNK_SIZE)
+		{
+			uint32_t chunkSize = MIN(FMGL_LOADABLE_FONT_UNPACK_CHUNK_SIZE, metrics->RasterSize - packedPosition);
+			context->MemoryReadFunctionPtr(context->MemoryDriverContext, metrics->RasterAddress + packedPosition, chunkSize, chunk);
+			chunkPosition = 0;
+		}
 
-		free(characterData.Raster);
+		uint8_t value = chunk[chunkPosition];
+		chunkPosition ++;
+		packedPosition ++;
 
-		nextCharacterDataAddress += characterData.RasterSize + sizeof(characterData) - sizeof(characterData.Raster);
+		if (isControlExpected)
+		{
+			control = value;
+			isRepeat = (0 != (control & FMGL_LOADABLE_FONT_RLE_REPEAT_FLAG));
+			runLength = isRepeat ? (control & FMGL_LOADABLE_FONT_RLE_COUNT_MASK) + FMGL_LOADABLE_FONT_RLE_MIN_REPEAT : control + 1;
+
+			if (unpackedPosition + runLength > unpackedSize)
+			{
+				L2HAL_Error(Generic);
+			}
+
+			isControlExpected = false;
+			continue;
+		}
+
+		if (isRepeat)
+		{
+			memset(&destination[unpackedPosition], value, runLength);
+			unpackedPosition += runLength;
+			runLength = 0;
+		}
+		else
+		{
+			destination[unpackedPosition] = value;
+			unpackedPosition ++;
+			runLength --;
+		}
+
+		isControlExpected = (0 == runLength);
 	}
+}
 
-	/* Done */
-	fResult = f_close(&file);
-	if (fResult != FR_OK)
+void FMGL_LoadableFont_ReverseBits(uint8_t* buffer, uint32_t size)
+{
+	for (uint32_t i = 0; i < size; i++)
 	{
-		L2HAL_Error(Generic);
+		uint8_t value = buffer[i];
+		value = (uint8_t)(((value & 0xF0) >> 4) | ((value & 0x0F) << 4));
+		value = (uint8_t)(((value & 0xCC) >> 2) | ((value & 0x33) << 2));
+		value = (uint8_t)(((value & 0xAA) >> 1) | ((value & 0x55) << 1));
+		buffer[i] = value;
 	}
+}
 
-	FMGL_API_Font font;
-	font.Height = FMGL_LoadableFont_GetCharacterHeight(context, ' '); /* Use space as height base */
-	font.GetCharacterWidth = (uint16_t (*)(void *, uint8_t))&FMGL_LoadableFont_GetCharacterWidth;
-	font.GetCharacterRaster = (const uint8_t* (*)(void *, uint8_t))&FMGL_LoadableFont_GetCharacterRaster;
-	font.IsLoadable = true;
-	font.Context = context;
+const FMGL_LoadableFont_CharacterMetricsStruct* FMGL_LoadableFont_GetGlyphMetrics(FMGL_LoadableFont_ContextStruct* context, uint16_t glyph)
+{
+	if (context->IsMetricsResident)
+	{
+		return &context->Metrics[glyph];
+	}
 
-	return font;
+	/* Looking for glyph in its set, on miss the least recently used (last) entry is evicted */
+	uint16_t first = (glyph % FMGL_LOADABLE_FONT_METRICS_CACHE_SETS) * FMGL_LOADABLE_FONT_METRICS_CACHE_WAYS;
+	uint16_t way = 0;
+
+	while (way < FMGL_LOADABLE_FONT_METRICS_CACHE_WAYS - 1 && glyph != context->MetricsCacheGlyphs[first + way])
+	{
+		way ++;
+	}
+
+	FMGL_LoadableFont_CharacterMetricsStruct metrics = context->Metrics[first + way];
+
+	if (glyph != context->MetricsCacheGlyphs[first + way])
+	{
+		context->MemoryReadFunctionPtr(context->MemoryDriverContext, FMGL_LoadableFont_GetMetricsAddress(context, glyph),
+				sizeof(metrics), (uint8_t*)&metrics);
+	}
+
+	/* Moving entry to the front of set */
+	memmove(&context->Metrics[first + 1], &context->Metrics[first], way * sizeof(context->Metrics[0]));
+	memmove(&context->MetricsCacheGlyphs[first + 1], &context->MetricsCacheGlyphs[first], way * sizeof(context->MetricsCacheGlyphs[0]));
+
+	context->Metrics[first] = metrics;
+	context->MetricsCacheGlyphs[first] = glyph;
+
+	return &context->Metrics[first];
 }
 
+const FMGL_LoadableFont_CharacterMetricsStruct* FMGL_LoadableFont_GetCharacterMetrics(FMGL_LoadableFont_ContextStruct* context, uint32_t character)
+{
+	return FMGL_LoadableFont_GetGlyphMetrics(context, FMGL_LoadableFont_GetGlyph(context, character));
+}
 
-FMGL_LoadableFont_FileCharacterDataStruct FMGL_LoadableFont_GetCharacterData(FMGL_LoadableFont_ContextStruct* context, uint8_t character)
+uint16_t FMGL_LoadableFont_GetCharacterWidth(FMGL_LoadableFont_ContextStruct* context, uint32_t character)
 {
-	FMGL_LoadableFont_FileCharacterDataStruct characterData;
-	context->MemoryReadFunctionPtr(context->MemoryDriverContext, context->CharacterDataAddresses[character], sizeof(characterData) - sizeof(characterData.Raster), (uint8_t*)&characterData);
+	return FMGL_LoadableFont_GetCharacterMetrics(context, character)->Width;
+}
+
+int16_t FMGL_LoadableFont_GetKerning(FMGL_LoadableFont_ContextStruct* context, uint32_t left, uint32_t right)
+{
+	if (0 == context->KerningPairsCount)
+	{
+		return 0;
+	}
+
+	uint16_t leftGlyph = FMGL_LoadableFont_GetGlyph(context, left);
+	uint16_t rightGlyph = FMGL_LoadableFont_GetGlyph(context, right);
+
+	int32_t first = 0;
+	int32_t last = context->KerningPairsCount - 1;
+
+	while (first <= last)
+	{
+		int32_t middle = (first + last) / 2;
+		const FMGL_LoadableFont_KerningPairStruct* pair = &context->KerningPairs[middle];
 
-	return characterData;
+		if (leftGlyph < pair->LeftGlyph || (leftGlyph == pair->LeftGlyph && rightGlyph < pair->RightGlyph))
+		{
+			last = middle - 1;
+		}
+		else if (leftGlyph > pair->LeftGlyph || rightGlyph > pair->RightGlyph)
+		{
+			first = middle + 1;
+		}
+		else
+		{
+			return pair->Value;
+		}
+	}
+
+	return 0;
 }
 
-uint16_t FMGL_LoadableFont_GetCharacterWidth(FMGL_LoadableFont_ContextStruct* context, uint8_t character)
+uint16_t FMGL_LoadableFont_GetCharacterHeight(FMGL_LoadableFont_ContextStruct* context, uint32_t character)
 {
-	return (uint16_t)FMGL_LoadableFont_GetCharacterData(context, character).Width;
+	return FMGL_LoadableFont_GetCharacterMetrics(context, character)->Height;
 }
 
-uint16_t FMGL_LoadableFont_GetCharacterHeight(FMGL_LoadableFont_ContextStruct* context, uint8_t character)
+void FMGL_LoadableFont_InitCache(FMGL_LoadableFont_ContextStruct* context)
 {
-	return (uint16_t)FMGL_LoadableFont_GetCharacterData(context, character).Height;
+	/* Whole metrics table is kept in SRAM if it fits */
+	context->IsMetricsResident = (context->CharactersCount <= FMGL_LOADABLE_FONT_METRICS_SRAM_ITEMS);
+
+	if (context->IsMetricsResident)
+	{
+		context->MemoryReadFunctionPtr(context->MemoryDriverContext, FMGL_LoadableFont_GetMetricsAddress(context, 0),
+				context->CharactersCount * sizeof(context->Metrics[0]), (uint8_t*)context->Metrics);
+	}
+
+	for (uint16_t i = 0; i < FMGL_LOADABLE_FONT_METRICS_SRAM_ITEMS; i++)
+	{
+		context->MetricsCacheGlyphs[i] = FMGL_LOADABLE_FONT_NO_GLYPH;
+	}
+
+	/* Slot size is the largest unpacked raster size, found during metrics loading */
+	if (0 == context->RasterCacheSlotSize)
+	{
+		context->RasterCacheSlotSize = 1; /* Font of empty glyphs */
+	}
+
+	uint32_t slotsCount = FMGL_LOADABLE_FONT_RASTER_CACHE_SIZE / context->RasterCacheSlotSize;
+	if (0 == slotsCount)
+	{
+		/* Cache budget is too small for this font */
+		L2HAL_Error(Generic);
+	}
+
+	context->RasterCacheSlotsCount = (uint8_t)MIN(slotsCount, FMGL_LOADABLE_FONT_RASTER_CACHE_MAX_SLOTS);
+	context->RasterCachePinnedSlotsCount = 0;
+
+	for (uint8_t i = 0; i < FMGL_LOADABLE_FONT_RASTER_CACHE_MAX_SLOTS; i++)
+	{
+		context->RasterCacheSlotsGlyphs[i] = FMGL_LOADABLE_FONT_NO_GLYPH;
+	}
+	memset(context->RasterCacheSlotsPinned, false, sizeof(context->RasterCacheSlotsPinned));
+	memset(context->RasterCacheSlotsLastUse, 0, sizeof(context->RasterCacheSlotsLastUse));
+
+	context->RasterCacheUseCounter = 0;
+	FMGL_LoadableFont_ResetCacheStatistics(context);
 }
 
-uint8_t* FMGL_LoadableFont_GetCharacterRaster(FMGL_LoadableFont_ContextStruct* context, uint8_t character)
+uint8_t FMGL_LoadableFont_FindCacheSlot(FMGL_LoadableFont_ContextStruct* context, uint16_t glyph)
 {
-	uint32_t characterDataAddress = context->CharacterDataAddresses[character];
+	for (uint8_t i = 0; i < context->RasterCacheSlotsCount; i++)
+	{
+		if (glyph == context->RasterCacheSlotsGlyphs[i])
+		{
+			return i;
+		}
+	}
 
-	FMGL_LoadableFont_FileCharacterDataStruct characterData;
-	context->MemoryReadFunctionPtr(context->MemoryDriverContext, characterDataAddress, sizeof(characterData) - sizeof(characterData.Raster), (uint8_t*)&characterData);
+	return FMGL_LOADABLE_FONT_NO_SLOT;
+}
+
+uint8_t FMGL_LoadableFont_GetCacheSlot(FMGL_LoadableFont_ContextStruct* context, uint32_t character)
+{
+	uint16_t glyph = FMGL_LoadableFont_GetGlyph(context, character);
+	uint8_t slot = FMGL_LoadableFont_FindCacheSlot(context, glyph);
 
-	uint8_t* raster = malloc(characterData.RasterSize);
+	context->RasterCacheUseCounter ++;
 
-	context->MemoryReadFunctionPtr(context->MemoryDriverContext, characterDataAddress + sizeof(characterData) - sizeof(characterData.Raster), characterData.RasterSize, raster);
+	if (FMGL_LOADABLE_FONT_NO_SLOT != slot)
+	{
+		context->RasterCacheHits ++;
+		context->RasterCacheSlotsLastUse[slot] = context->RasterCacheUseCounter;
+
+		return slot;
+	}
 
-	return raster;
+	context->RasterCacheMisses ++;
+
+	/* Looking for free slot or for least recently used unpinned one */
+	for (uint8_t i = 0; i < context->RasterCacheSlotsCount; i++)
+	{
+		if (context->RasterCacheSlotsPinned[i])
+		{
+			continue;
+		}
+
+		if (FMGL_LOADABLE_FONT_NO_GLYPH == context->RasterCacheSlotsGlyphs[i])
+		{
+			slot = i;
+			break;
+		}
+
+		if (FMGL_LOADABLE_FONT_NO_SLOT == slot || context->RasterCacheSlotsLastUse[i] < context->RasterCacheSlotsLastUse[slot])
+		{
+			slot = i;
+		}
+	}
+
+	if (FMGL_LOADABLE_FONT_NO_SLOT == slot)
+	{
+		/* Everything is pinned, must never happen */
+		L2HAL_Error(Generic);
+	}
+
+	/* Loading (evicted glyph, if any, is just overwritten) */
+	const FMGL_LoadableFont_CharacterMetricsStruct* metrics = FMGL_LoadableFont_GetGlyphMetrics(context, glyph);
+	uint8_t* slotRaster = &context->RasterCache[slot * context->RasterCacheSlotSize];
+
+	if (metrics->RasterSize < FMGL_LoadableFont_GetUnpackedRasterSize(metrics))
+	{
+		FMGL_LoadableFont_UnpackRaster(context, metrics, slotRaster);
+	}
+	else
+	{
+		context->MemoryReadFunctionPtr(context->MemoryDriverContext, metrics->RasterAddress, metrics->RasterSize, slotRaster);
+	}
+
+	context->RasterCacheSlotsGlyphs[slot] = glyph;
+	context->RasterCacheSlotsLastUse[slot] = context->RasterCacheUseCounter;
+
+	return slot;
+}
+
+const uint8_t* FMGL_LoadableFont_GetCharacterRaster(FMGL_LoadableFont_ContextStruct* context, uint32_t character)
+{
+	uint8_t slot = FMGL_LoadableFont_GetCacheSlot(context, character);
+
+	return &context->RasterCache[slot * context->RasterCacheSlotSize];
+}
+
+bool FMGL_LoadableFont_PinCharacter(FMGL_LoadableFont_ContextStruct* context, uint32_t character)
+{
+	uint8_t slot = FMGL_LoadableFont_FindCacheSlot(context, FMGL_LoadableFont_GetGlyph(context, character));
+	if (FMGL_LOADABLE_FONT_NO_SLOT != slot && context->RasterCacheSlotsPinned[slot])
+	{
+		/* Already pinned */
+		return true;
+	}
+
+	if (context->RasterCachePinnedSlotsCount + 1 >= context->RasterCacheSlotsCount)
+	{
+		/* At least one slot must stay available for unpinned characters */
+		return false;
+	}
+
+	slot = FMGL_LoadableFont_GetCacheSlot(context, character);
+
+	context->RasterCacheSlotsPinned[slot] = true;
+	context->RasterCachePinnedSlotsCount ++;
+
+	return true;
+}
+
+void FMGL_LoadableFont_UnpinCharacter(FMGL_LoadableFont_ContextStruct* context, uint32_t character)
+{
+	uint8_t slot = FMGL_LoadableFont_FindCacheSlot(context, FMGL_LoadableFont_GetGlyph(context, character));
+	if (FMGL_LOADABLE_FONT_NO_SLOT == slot || !context->RasterCacheSlotsPinned[slot])
+	{
+		return;
+	}
+
+	context->RasterCacheSlotsPinned[slot] = false;
+	context->RasterCachePinnedSlotsCount --;
+}
+
+void FMGL_LoadableFont_ResetCacheStatistics(FMGL_LoadableFont_ContextStruct* context)
+{
+	context->RasterCacheHits = 0;
+	context->RasterCacheMisses = 0;
 }
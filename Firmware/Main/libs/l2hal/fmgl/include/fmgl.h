@@ -58,16 +58,54 @@
 #include <string.h>
 #include <stdbool.h>
 
-/*
- * Each font defines 256 characters (including null-character for 0x00).
- */
-#define FMGL_API_FONT_CHARACTERS_COUNT 256U
-
 /**
  * Maximal brightness for each color channel.
  */
 #define FMGL_API_MAX_CHANNEL_BRIGHTNESS 255U
 
+/**
+ * Malformed UTF-8 sequences are decoded into this character (fonts show it as missing character).
+ */
+#define FMGL_API_INVALID_CHARACTER 0x00U
+
+/**
+ * Maximal number of separate dirty regions, tracked between framebuffer pushes. If more regions are changed, they are
+ * merged together.
+ */
+#ifndef FMGL_API_MAX_DIRTY_REGIONS
+	#define FMGL_API_MAX_DIRTY_REGIONS 8U
+#endif
+
+/**
+ * Maximal number of nested clip regions, see FMGL_API_PushClipRegion().
+ */
+#ifndef FMGL_API_CLIP_STACK_DEPTH
+	#define FMGL_API_CLIP_STACK_DEPTH 4U
+#endif
+
+/**
+ * Number of measured texts layouts, kept in context. When cache is full, oldest entry is replaced.
+ */
+#ifndef FMGL_API_TEXT_LAYOUT_CACHE_SIZE
+	#define FMGL_API_TEXT_LAYOUT_CACHE_SIZE 4U
+#endif
+
+/**
+ * Maximal number of lines, which offsets are stored in text layout. Texts with more lines are still measured,
+ * but lines are searched again during rendering.
+ */
+#ifndef FMGL_API_TEXT_LAYOUT_MAX_LINES
+	#define FMGL_API_TEXT_LAYOUT_MAX_LINES 8U
+#endif
+
+/**
+ * Maximal length (in bytes) of cached text. Layout keeps a copy of text and position of each character, so cached text
+ * is rendered without decoding and measuring it again. Longer texts are still measured, but not cached.
+ */
+#ifndef FMGL_API_TEXT_LAYOUT_MAX_LENGTH
+	#define FMGL_API_TEXT_LAYOUT_MAX_LENGTH 48U
+#endif
+
 /**
  * Possible transparency rendering modes for XBM images.
  */
@@ -78,6 +116,16 @@ typedef enum
 	FMGL_XBMTransparencyModeTransparentActive = 2 /** Active pixels will be transparent. */
 } FMGL_API_XBMTransparencyMode;
 
+/**
+ * Text lines alignment within width budget.
+ */
+typedef enum
+{
+	FMGL_TextAlignmentLeft = 0, /** Lines start at budget left border. */
+	FMGL_TextAlignmentCenter = 1, /** Lines are centered. */
+	FMGL_TextAlignmentRight = 2 /** Lines end at budget right border. */
+} FMGL_API_TextAlignment;
+
 /**
  * Structure, containing color.
  */
@@ -99,6 +147,129 @@ typedef struct
 	uint8_t B;
 } FMGL_API_ColorStruct;
 
+/**
+ * Rectangular screen region, borders are included.
+ */
+typedef struct
+{
+	/**
+	 * Left X coordinate.
+	 */
+	uint16_t X1;
+
+	/**
+	 * Top Y coordinate.
+	 */
+	uint16_t Y1;
+
+	/**
+	 * Right X coordinate.
+	 */
+	uint16_t X2;
+
+	/**
+	 * Bottom Y coordinate.
+	 */
+	uint16_t Y2;
+} FMGL_API_RegionStruct;
+
+/**
+ * Measured text layout. First fields are the key (text is identified by hash, length and its copy), rest of them - measured data.
+ */
+typedef struct
+{
+	/**
+	 * If false, then entry is empty or text isn't cached (it is too long or has too many lines), in the latter case
+	 * only sizes, lines offsets, lengths and widths are valid.
+	 */
+	bool IsValid;
+
+	/**
+	 * Font, used for measurement. Only compared, never dereferenced.
+	 */
+	const void* Font;
+
+	/**
+	 * Font scale.
+	 */
+	uint16_t Scale;
+
+	/**
+	 * Characters spacing.
+	 */
+	uint16_t CharactersSpacing;
+
+	/**
+	 * Lines spacing.
+	 */
+	uint16_t LinesSpacing;
+
+	/**
+	 * Text hash.
+	 */
+	uint32_t TextHash;
+
+	/**
+	 * Text length in bytes.
+	 */
+	uint16_t TextLength;
+
+	/**
+	 * Copy of text (not null-terminated), compared on lookup to rule out hash collisions.
+	 */
+	char Text[FMGL_API_TEXT_LAYOUT_MAX_LENGTH];
+
+	/**
+	 * Width of the widest line.
+	 */
+	uint16_t Width;
+
+	/**
+	 * Text height.
+	 */
+	uint16_t Height;
+
+	/**
+	 * Lines count. If more than FMGL_API_TEXT_LAYOUT_MAX_LINES, then lines offsets and lengths are not stored.
+	 */
+	uint16_t LinesCount;
+
+	/**
+	 * Offsets of lines starts, in bytes.
+	 */
+	uint16_t LinesOffsets[FMGL_API_TEXT_LAYOUT_MAX_LINES];
+
+	/**
+	 * Lines lengths, in bytes (without newlines).
+	 */
+	uint16_t LinesLengths[FMGL_API_TEXT_LAYOUT_MAX_LINES];
+
+	/**
+	 * Lines widths, in pixels.
+	 */
+	uint16_t LinesWidths[FMGL_API_TEXT_LAYOUT_MAX_LINES];
+
+	/**
+	 * Index of first character of each line in Characters.
+	 */
+	uint16_t LinesFirstCharacters[FMGL_API_TEXT_LAYOUT_MAX_LINES];
+
+	/**
+	 * Decoded characters of all lines (newlines aren't stored).
+	 */
+	uint32_t Characters[FMGL_API_TEXT_LAYOUT_MAX_LENGTH];
+
+	/**
+	 * Characters X coordinates, relative to line start (spacing and kerning are already applied).
+	 */
+	uint16_t CharactersX[FMGL_API_TEXT_LAYOUT_MAX_LENGTH];
+
+	/**
+	 * Number of items in Characters.
+	 */
+	uint16_t CharactersCount;
+} FMGL_API_TextLayoutStruct;
+
 /**
  * Structure with XBM image.
  */
@@ -117,7 +288,13 @@ typedef struct
 	/**
 	 * Raster, packed as array of bytes.
 	 */
-	uint8_t* Raster;
+	const uint8_t* Raster;
+
+	/**
+	 * If true, leftmost pixel of each byte is stored in most significant bit (like in 1bpp framebuffers),
+	 * otherwise in least significant bit (classic XBM).
+	 */
+	bool IsMSBFirst;
 } FMGL_API_XBMImage;
 
 /**
@@ -147,7 +324,8 @@ typedef struct
 	void (*SetActiveColor) (void* deviceContext, FMGL_API_ColorStruct color);
 
 	/**
-	 * Pointer to function drawing pixel with active color.
+	 * Pointer to function drawing pixel with active color. FMGL calls it only for pixels inside current clip region (which is always
+	 * inside screen), so driver may skip bounds checks here.
 	 */
 	void (*DrawPixel) (void* deviceContext, uint16_t x, uint16_t y);
 
@@ -166,6 +344,67 @@ typedef struct
 	 */
 	void (*ClearFramebuffer) (void* deviceContext, FMGL_API_ColorStruct blankingColor);
 
+	/**
+	 * Pointer to function filling horizontal span [x1; x2] at line y with active color. May be null.
+	 * Coordinates are always on screen and x1 <= x2.
+	 */
+	void (*FillSpan) (void* deviceContext, uint16_t x1, uint16_t x2, uint16_t y);
+
+	/**
+	 * Pointer to function filling rectangle [x1; x2] x [y1; y2] with active color. May be null.
+	 * Coordinates are always on screen, x1 <= x2 and y1 <= y2.
+	 */
+	void (*FillRect) (void* deviceContext, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+	/**
+	 * Pointer to function rendering unscaled XBM image with top left corner at (x, y). May be null.
+	 * Only top left width x height part of image is rendered, it is always on screen.
+	 * Must not change device active color.
+	 */
+	void (*BlitMono1bpp) (void* deviceContext, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+			FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency);
+
+	/**
+	 * Pointer to function pushing given framebuffer regions into actual display. May be null, in this case whole
+	 * framebuffer is pushed by PushFramebuffer().
+	 */
+	void (*PushRegions) (void* deviceContext, FMGL_API_RegionStruct* regions, uint8_t regionsCount);
+
+	/**
+	 * Regions, changed since last framebuffer push. Regions don't touch each other.
+	 */
+	FMGL_API_RegionStruct DirtyRegions[FMGL_API_MAX_DIRTY_REGIONS];
+
+	/**
+	 * Number of regions in DirtyRegions.
+	 */
+	uint8_t DirtyRegionsCount;
+
+	/**
+	 * Current clip region, nothing is drawn outside of it. If X1 > X2 or Y1 > Y2, then region is empty.
+	 */
+	FMGL_API_RegionStruct ClipRegion;
+
+	/**
+	 * Clip regions, saved by FMGL_API_PushClipRegion().
+	 */
+	FMGL_API_RegionStruct ClipStack[FMGL_API_CLIP_STACK_DEPTH];
+
+	/**
+	 * Number of regions in ClipStack.
+	 */
+	uint8_t ClipStackCount;
+
+	/**
+	 * Recently measured texts.
+	 */
+	FMGL_API_TextLayoutStruct TextLayoutCache[FMGL_API_TEXT_LAYOUT_CACHE_SIZE];
+
+	/**
+	 * Index of layout cache entry to be replaced next.
+	 */
+	uint8_t TextLayoutCacheNextEntry;
+
 	/**
 	 * Maximal possible X coordinate (rightest).
 	 */
@@ -209,19 +448,26 @@ typedef struct
 	void* Context;
 
 	/**
-	 * Pointer to function returning character width.
+	 * Pointer to function returning character width. Character is Unicode code point.
+	 */
+	uint16_t (*GetCharacterWidth) (void* context, uint32_t character);
+
+	/**
+	 *Pointer to function, returning character raster. Character is Unicode code point.
+	 *Raster is owned by font and must not be freed.
 	 */
-	uint16_t (*GetCharacterWidth) (void* context, uint8_t character);
+	const uint8_t* (*GetCharacterRaster) (void* context, uint32_t character);
 
 	/**
-	 *Pointer to function, returning character raster.
+	 * Rasters bits order, see FMGL_API_XBMImage.
 	 */
-	const uint8_t* (*GetCharacterRaster) (void* context, uint8_t character);
+	bool IsMSBFirst;
 
 	/**
-	 * True if this font is loadable, which requires memory management
+	 * Pointer to function, returning horizontal adjustment (in unscaled pixels) between given pair of characters,
+	 * or NULL if font has no kerning.
 	 */
-	bool IsLoadable;
+	int16_t (*GetKerning) (void* context, uint32_t left, uint32_t right);
 } FMGL_API_Font;
 
 /**
@@ -305,6 +551,35 @@ FMGL_API_DriverContext FMGL_API_AttachToDriver
 	void (*clearFramebuffer) (void* deviceContext, FMGL_API_ColorStruct blankingColor)
 );
 
+/**
+ * Call this function after FMGL_API_AttachToDriver() if driver supports bulk drawing operations. Any of them may be null,
+ * in this case FMGL will draw pixel by pixel.
+ * @param context FMGL context pointer.
+ * @param fillSpan Pointer to function filling horizontal spans.
+ * @param fillRect Pointer to function filling rectangles.
+ * @param blitMono1bpp Pointer to function rendering unscaled XBM images.
+ */
+void FMGL_API_AttachBulkOperations
+(
+	FMGL_API_DriverContext* context,
+	void (*fillSpan) (void* deviceContext, uint16_t x1, uint16_t x2, uint16_t y),
+	void (*fillRect) (void* deviceContext, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2),
+	void (*blitMono1bpp) (void* deviceContext, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+			FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+);
+
+/**
+ * Call this function after FMGL_API_AttachToDriver() if driver can push parts of framebuffer. After it FMGL_API_PushFramebuffer()
+ * will push only regions, changed since previous push.
+ * @param context FMGL context pointer.
+ * @param pushRegions Pointer to function pushing framebuffer regions to device.
+ */
+void FMGL_API_AttachRegionsPush
+(
+	FMGL_API_DriverContext* context,
+	void (*pushRegions) (void* deviceContext, FMGL_API_RegionStruct* regions, uint8_t regionsCount)
+);
+
 /***************************
  * Basic drawing functions *
  ***************************/
@@ -338,7 +613,7 @@ void FMGL_API_SetActiveColor(FMGL_API_DriverContext* context, FMGL_API_ColorStru
 FMGL_API_ColorStruct FMGL_API_GetActiveColor(FMGL_API_DriverContext* context);
 
 /**
- * Draws pixel with current active color.
+ * Draws pixel with current active color. Pixels out of clip region are ignored.
  * @param context FMGL context pointer.
  * @param x X pixel coordinate.
  * @param y Y pixel coordinate.
@@ -362,24 +637,54 @@ FMGL_API_ColorStruct FMGL_API_GetPixel(FMGL_API_DriverContext* context, uint16_t
 void FMGL_API_SetBlankingColor(FMGL_API_DriverContext* context, FMGL_API_ColorStruct color);
 
 /**
- * Fills framebuffer with given color.
+ * Fills framebuffer (current clip region of it) with given color.
  * @param context FMGL context pointer.
  * @param color Fill framebuffer with this color.
  */
 void FMGL_API_FillScreen(FMGL_API_DriverContext* context, FMGL_API_ColorStruct color);
 
 /**
- * Clears screen (i.e. fills framebuffer with current blanking color).
+ * Clears screen (i.e. fills framebuffer with current blanking color). Only current clip region is cleared.
  * @param context FMGL context pointer.
  */
 void FMGL_API_ClearScreen(FMGL_API_DriverContext* context);
 
 /**
- * Pushes framebuffer to device.
+ * Pushes framebuffer to device. If driver can push regions, then only changed regions are pushed (and nothing is pushed
+ * if nothing was changed).
  * @param context FMGL context pointer.
  */
 void FMGL_API_PushFramebuffer (FMGL_API_DriverContext* context);
 
+/**
+ * Marks region as changed. FMGL drawing functions do it automatically, call it if framebuffer is changed bypassing FMGL.
+ * @param context FMGL context pointer.
+ * @param x1 One corner X coordinate.
+ * @param y1 One corner Y coordinate.
+ * @param x2 Opposite corner X coordinate.
+ * @param y2 Opposite corner Y coordinate.
+ */
+void FMGL_API_MarkRegionAsDirty(FMGL_API_DriverContext* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+/**
+ * Restricts drawing to given rectangle (intersected with current clip region). Previous clip region is saved and
+ * could be restored by FMGL_API_PopClipRegion(). Initially clip region is the whole screen. If more than
+ * FMGL_API_CLIP_STACK_DEPTH regions are pushed, L2HAL_Error(WrongOperation) is called.
+ * @param context FMGL context pointer.
+ * @param x1 One corner X coordinate.
+ * @param y1 One corner Y coordinate.
+ * @param x2 Opposite corner X coordinate.
+ * @param y2 Opposite corner Y coordinate.
+ */
+void FMGL_API_PushClipRegion(FMGL_API_DriverContext* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+/**
+ * Restores clip region, which was active before last FMGL_API_PushClipRegion() call. If there is nothing to restore,
+ * L2HAL_Error(WrongOperation) is called.
+ * @param context FMGL context pointer.
+ */
+void FMGL_API_PopClipRegion(FMGL_API_DriverContext* context);
+
 
 /*********
  * Lines *
@@ -451,6 +756,7 @@ void FMGL_API_DrawCircle(FMGL_API_DriverContext* context, uint16_t centerX, uint
 /**
  * Renders XBM image such way, that (0,0) pixel of image will be placed at (x,y). Image is being
  * scaled up by scaleX and scaleY. XBM's active pixels will be displayed using activeColor, inactive - using inactiveColor.
+ * Active color didn't change after this function call.
  * @param context FMGL context pointer.
  * @param image Pointer to XBM image struct.
  * @param x X coordinate of top left image corner.
@@ -469,6 +775,14 @@ void FMGL_API_RenderXBM(FMGL_API_DriverContext* context, FMGL_API_XBMImage* imag
  * Strings rendering functions *
  *******************************/
 
+/**
+ * Decodes one UTF-8 encoded character.
+ * @param string Pointer to first byte of character. Must not point to string terminator.
+ * @param length Pointer to variable, where encoded character length (in bytes, at least 1) will be stored.
+ * @return Unicode code point or FMGL_API_INVALID_CHARACTER if sequence is malformed.
+ */
+uint32_t FMGL_API_DecodeUTF8Character(const char* string, uint8_t* length);
+
 /**
  * Draws one line without wrapping at spaces. Newlines aren't allowed, in case of newline L2HAL_Error(L2HAL_ERROR_WRONG_ARGUMENT) will be called.
  * Draws until line end or until no pixels of next character falls into screen area. Returns (in width parameter) width of drawn line.
@@ -477,23 +791,64 @@ void FMGL_API_RenderXBM(FMGL_API_DriverContext* context, FMGL_API_XBMImage* imag
  * @param x,y Top left text coordinates.
  * @param width Pointer to variable, where rendered text width will be stored.
  * @param isDryRun If true, then doesn't draw anything, just calculating width.
- * @param string Text to render.
+ * @param string Text to render (UTF-8).
  */
 void FMGL_API_RenderOneLineDumb(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t* width,
 		bool isDryRun, char* string);
 
 /**
- * Renders text without wrapping at spaces, but with wrapping at newlines.
+ * Measures text without rendering it. Result is cached in context (see FMGL_API_TEXT_LAYOUT_CACHE_SIZE), so subsequent
+ * FMGL_API_RenderTextWithLineBreaks() call for the same text and font settings doesn't measure it again.
+ * Sizes aren't clipped by screen.
+ * @param context Pointer to FMGL library context.
+ * @param fontSettings Pointer to font settings.
+ * @param string Text to measure (UTF-8), newlines are allowed.
+ * @param width,height Pointers to variables, where text sizes will be stored.
+ */
+void FMGL_API_MeasureText(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, const char* string, uint16_t* width, uint16_t* height);
+
+/**
+ * Renders text without wrapping at spaces, but with wrapping at newlines. Text layout is taken from cache, see FMGL_API_MeasureText().
  * @param context Pointer to FMGL library context.
  * @param fontSettings Pointer to font settings.
  * @param x,y Top left text coordinates.
- * @param width,height Pointers to variables, where rendered text sizes will be stored.
+ * @param width,height Pointers to variables, where text sizes will be stored (not clipped by screen).
  * @param isDryRun If true, then doesn't draw anything, just calculating width.
- * @param string Text to render.
+ * @param string Text to render (UTF-8).
  */
 void FMGL_API_RenderTextWithLineBreaks(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t* width, uint16_t* height,
 		bool isDryRun, char* string);
 
+/**
+ * Renders text without wrapping at spaces, but with wrapping at newlines, aligning each line within width of the widest one.
+ * Text layout (including lines widths) is taken from cache, see FMGL_API_MeasureText().
+ * @param context Pointer to FMGL library context.
+ * @param fontSettings Pointer to font settings.
+ * @param x,y Top left text coordinates.
+ * @param alignment Lines alignment.
+ * @param width,height Pointers to variables, where text sizes will be stored (not clipped by screen).
+ * @param isDryRun If true, then doesn't draw anything, just calculating sizes.
+ * @param string Text to render (UTF-8).
+ */
+void FMGL_API_RenderTextAligned(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y,
+		FMGL_API_TextAlignment alignment, uint16_t* width, uint16_t* height, bool isDryRun, const char* string);
+
+/**
+ * Renders text, wrapping it at word boundaries (spaces) to fit into given width. Words, which are wider than budget, are broken
+ * at character boundary. Newlines are respected. Spaces at wrap positions are not drawn. Text is laid out in one pass,
+ * each line is rendered as soon as its end is found.
+ * @param context Pointer to FMGL context.
+ * @param fontSettings Pointer to font settings.
+ * @param x,y Top left corner of width budget.
+ * @param maxWidth Width budget in pixels.
+ * @param alignment Lines alignment within budget.
+ * @param width,height Pointers to variables, where text sizes will be stored (width is measured as in FMGL_API_MeasureText()).
+ * @param isDryRun If true, then doesn't draw anything, just calculating sizes.
+ * @param string Text to render (UTF-8).
+ */
+void FMGL_API_RenderTextWrapped(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t maxWidth,
+		FMGL_API_TextAlignment alignment, uint16_t* width, uint16_t* height, bool isDryRun, const char* string);
+
 /***************************
  * API functions ends here *
  ***************************/
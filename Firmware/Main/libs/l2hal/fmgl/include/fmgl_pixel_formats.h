@@ -0,0 +1,513 @@
+/*
+	This file is part of Shakti Lucidia's STM32 level 2 HAL.
+
+	STM32 level 2 HAL is free software: you can redistribute it and/or modify
+	it under the terms of the GNU Affero General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU Affero General Public License for more details.
+
+	You should have received a copy of the GNU Affero General Public License
+	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+	-------------------------------------------------------------------------
+
+	Created by Shakti Lucidia
+
+	Feel free to contact: shakti_lucidia@proton.me
+
+	Repository: https://github.com/shaktilucidia/stm32-l2hal
+
+	-------------------------------------------------------------------------
+ */
+
+/**
+ * @file
+ * @brief Framebuffer kernels for typical pixel formats, to be used by display drivers.
+ *
+ * Drivers pack colors into native format once (in SetActiveColor()) and implement bulk operations
+ * (see FMGL_API_AttachBulkOperations()) with these kernels. Kernels are inline, so constant arguments
+ * (like bits order) are resolved at compile time and each driver gets code specialized for its format.
+ *
+ * Supported formats:
+ * Mono1 - 1 bit per pixel, 8 horizontal pixels per byte, leftmost pixel in MSB or LSB.
+ * Grey2 - 2 bits per pixel, 4 horizontal pixels per byte, leftmost pixel in two most significant bits.
+ * Grey4 - 4 bits per pixel, 2 horizontal pixels per byte, leftmost pixel in high nibble.
+ * RGB565 - 2 bytes per pixel, big endian (as sent to display).
+ * RGB888 - 3 bytes per pixel, R, G, B (also used by RGB666 displays in 3-bytes transfer mode).
+ *
+ * All coordinates must be inside framebuffer, x1 <= x2.
+ */
+
+#ifndef FMGL_INCLUDE_FMGL_PIXEL_FORMATS_H_
+#define FMGL_INCLUDE_FMGL_PIXEL_FORMATS_H_
+
+#include "fmgl.h"
+
+/**
+ * To avoid magic 8 in code.
+ */
+#define FMGL_PF_BITS_PER_BYTE 8U
+
+/**
+ * Bytes per pixel for multibyte formats.
+ */
+#define FMGL_PF_RGB565_BYTES_PER_PIXEL 2U
+#define FMGL_PF_RGB888_BYTES_PER_PIXEL 3U
+
+/**
+ * XBM row size in bytes.
+ */
+static inline uint16_t FMGL_PF_GetXBMLineSize(FMGL_API_XBMImage* image)
+{
+	return (image->Width + FMGL_PF_BITS_PER_BYTE - 1) / FMGL_PF_BITS_PER_BYTE;
+}
+
+/**
+ * Returns true if XBM image pixel (x is column in given row) is active.
+ */
+static inline bool FMGL_PF_IsXBMPixelActive(FMGL_API_XBMImage* image, const uint8_t* row, uint16_t x)
+{
+	uint8_t bitNumber = image->IsMSBFirst ? 7 - (x % FMGL_PF_BITS_PER_BYTE) : x % FMGL_PF_BITS_PER_BYTE;
+
+	return 0 != ((row[x / FMGL_PF_BITS_PER_BYTE] >> bitNumber) & 0x01U);
+}
+
+/*********
+ * Mono1 *
+ *********/
+
+/**
+ * Reverses bits order in byte.
+ */
+static inline uint8_t FMGL_PF_ReverseBits(uint8_t value)
+{
+	value = (uint8_t)(((value & 0xF0U) >> 4) | ((value & 0x0FU) << 4));
+	value = (uint8_t)(((value & 0xCCU) >> 2) | ((value & 0x33U) << 2));
+	return (uint8_t)(((value & 0xAAU) >> 1) | ((value & 0x55U) << 1));
+}
+
+/**
+ * Fills pixels [x1; x2] of framebuffer line. Value is packed color, 0x00 or 0xFF.
+ */
+static inline void FMGL_PF_Mono1FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint8_t value, bool isMSBFirst)
+{
+	uint16_t firstByte = x1 / FMGL_PF_BITS_PER_BYTE;
+	uint16_t lastByte = x2 / FMGL_PF_BITS_PER_BYTE;
+
+	uint8_t firstMask;
+	uint8_t lastMask;
+
+	if (isMSBFirst)
+	{
+		firstMask = 0xFFU >> (x1 % FMGL_PF_BITS_PER_BYTE);
+		lastMask = (uint8_t)(0xFFU << (7 - (x2 % FMGL_PF_BITS_PER_BYTE)));
+	}
+	else
+	{
+		firstMask = (uint8_t)(0xFFU << (x1 % FMGL_PF_BITS_PER_BYTE));
+		lastMask = 0xFFU >> (7 - (x2 % FMGL_PF_BITS_PER_BYTE));
+	}
+
+	if (firstByte == lastByte)
+	{
+		uint8_t mask = firstMask & lastMask;
+		line[firstByte] = (line[firstByte] & ~mask) | (mask & value);
+		return;
+	}
+
+	line[firstByte] = (line[firstByte] & ~firstMask) | (firstMask & value);
+
+	memset(&line[firstByte + 1], value, lastByte - firstByte - 1);
+
+	line[lastByte] = (line[lastByte] & ~lastMask) | (lastMask & value);
+}
+
+/**
+ * Fills rectangle in framebuffer, made of lineSize bytes long lines.
+ */
+static inline void FMGL_PF_Mono1FillRect(uint8_t* framebuffer, uint16_t lineSize, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+		uint8_t value, bool isMSBFirst)
+{
+	for (uint16_t y = y1; y <= y2; y++)
+	{
+		FMGL_PF_Mono1FillSpan(&framebuffer[y * lineSize], x1, x2, value, isMSBFirst);
+	}
+}
+
+/**
+ * Renders top left width x height part of XBM image at (x, y) byte by byte. Values are packed colors, 0x00 or 0xFF.
+ */
+static inline void FMGL_PF_Mono1Blit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image,
+		uint16_t width, uint16_t height, uint8_t activeValue, uint8_t inactiveValue, FMGL_API_XBMTransparencyMode transparency, bool isMSBFirst)
+{
+	/* Which pixels are written: active ones, inactive ones or both */
+	uint8_t activeWriteMask = (FMGL_XBMTransparencyModeTransparentActive == transparency) ? 0x00U : 0xFFU;
+	uint8_t inactiveWriteMask = (FMGL_XBMTransparencyModeTransparentInactive == transparency) ? 0x00U : 0xFFU;
+
+	uint16_t imageLineSize = FMGL_PF_GetXBMLineSize(image);
+	uint16_t bytesCount = (width + FMGL_PF_BITS_PER_BYTE - 1) / FMGL_PF_BITS_PER_BYTE;
+
+	/* Visible pixels of last (probably incomplete) byte */
+	uint8_t unusedBits = (FMGL_PF_BITS_PER_BYTE - (width % FMGL_PF_BITS_PER_BYTE)) % FMGL_PF_BITS_PER_BYTE;
+	uint8_t lastByteMask = isMSBFirst ? (uint8_t)(0xFFU << unusedBits) : 0xFFU >> unusedBits;
+
+	/* Image byte falls into two framebuffer bytes if x is not aligned */
+	uint8_t shift = x % FMGL_PF_BITS_PER_BYTE;
+
+	for (uint16_t row = 0; row < height; row++)
+	{
+		const uint8_t* source = &image->Raster[row * imageLineSize];
+		uint8_t* destination = &framebuffer[(y + row) * lineSize + x / FMGL_PF_BITS_PER_BYTE];
+
+		for (uint16_t i = 0; i < bytesCount; i++)
+		{
+			uint8_t bits = (image->IsMSBFirst == isMSBFirst) ? source[i] : FMGL_PF_ReverseBits(source[i]);
+
+			uint8_t mask = (bits & activeWriteMask) | (~bits & inactiveWriteMask);
+			if (i == bytesCount - 1)
+			{
+				mask &= lastByteMask;
+			}
+
+			uint8_t value = ((bits & activeValue) | (~bits & inactiveValue)) & mask;
+
+			/* Towards higher x is right shift for MSB-first and left shift for LSB-first */
+			uint8_t currentMask = isMSBFirst ? (uint8_t)(mask >> shift) : (uint8_t)(mask << shift);
+			uint8_t currentValue = isMSBFirst ? (uint8_t)(value >> shift) : (uint8_t)(value << shift);
+
+			destination[i] = (destination[i] & ~currentMask) | currentValue;
+
+			if (0 == shift)
+			{
+				continue;
+			}
+
+			uint8_t carryMask = isMSBFirst ? (uint8_t)(mask << (8 - shift)) : (uint8_t)(mask >> (8 - shift));
+			if (0 != carryMask)
+			{
+				uint8_t carryValue = isMSBFirst ? (uint8_t)(value << (8 - shift)) : (uint8_t)(value >> (8 - shift));
+				destination[i + 1] = (destination[i + 1] & ~carryMask) | carryValue;
+			}
+		}
+	}
+}
+
+/*********
+ * Grey2 *
+ *********/
+
+/**
+ * Writes one pixel. Level is packed color, [0-3].
+ */
+static inline void FMGL_PF_Grey2WritePixel(uint8_t* line, uint16_t x, uint8_t level)
+{
+	uint8_t shift = 6U - 2U * (x % 4U);
+
+	line[x / 4U] = (line[x / 4U] & (uint8_t)~(0x03U << shift)) | (uint8_t)(level << shift);
+}
+
+/**
+ * Reads one pixel level.
+ */
+static inline uint8_t FMGL_PF_Grey2ReadPixel(const uint8_t* line, uint16_t x)
+{
+	return (line[x / 4U] >> (6U - 2U * (x % 4U))) & 0x03U;
+}
+
+/**
+ * Fills pixels [x1; x2] of framebuffer line, whole bytes are filled by memset().
+ */
+static inline void FMGL_PF_Grey2FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint8_t level)
+{
+	uint32_t x = x1;
+	uint32_t end = (uint32_t)x2 + 1U;
+
+	for (; x < end && 0 != x % 4U; x++)
+	{
+		FMGL_PF_Grey2WritePixel(line, x, level);
+	}
+
+	uint32_t quadsCount = (end - x) / 4U;
+	memset(&line[x / 4U], level * 0x55U, quadsCount);
+	x += quadsCount * 4U;
+
+	for (; x < end; x++)
+	{
+		FMGL_PF_Grey2WritePixel(line, x, level);
+	}
+}
+
+/**
+ * Gathers even bits of word (bit 2 * i goes to bit i), so 16 pixels give 16 bits of bit plane.
+ */
+static inline uint32_t FMGL_PF_Grey2GatherEvenBits(uint32_t bits)
+{
+	bits &= 0x55555555U;
+	bits = (bits | (bits >> 1)) & 0x33333333U;
+	bits = (bits | (bits >> 2)) & 0x0F0F0F0FU;
+	bits = (bits | (bits >> 4)) & 0x00FF00FFU;
+	bits = (bits | (bits >> 8)) & 0x0000FFFFU;
+
+	return bits;
+}
+
+/**
+ * Extracts bit plane (0 - low bits of levels, 1 - high bits) of framebuffer line into Mono1 MSB-first line.
+ * Width must be multiple of 8. 16 pixels are processed at once.
+ */
+static inline void FMGL_PF_Grey2ExtractPlane(const uint8_t* line, uint16_t width, uint8_t plane, uint8_t* planeLine)
+{
+	uint16_t lineSize = width / 4U;
+	uint16_t index = 0;
+
+	for (; index + 4U <= lineSize; index += 4U)
+	{
+		uint32_t pixels = ((uint32_t)line[index] << 24) | ((uint32_t)line[index + 1U] << 16)
+			| ((uint32_t)line[index + 2U] << 8) | line[index + 3U];
+
+		uint32_t bits = FMGL_PF_Grey2GatherEvenBits(pixels >> plane);
+
+		planeLine[index / 2U] = (uint8_t)(bits >> 8);
+		planeLine[index / 2U + 1U] = (uint8_t)bits;
+	}
+
+	if (index < lineSize)
+	{
+		/* Last 8 pixels */
+		uint32_t pixels = ((uint32_t)line[index] << 8) | line[index + 1U];
+
+		planeLine[index / 2U] = (uint8_t)FMGL_PF_Grey2GatherEvenBits(pixels >> plane);
+	}
+}
+
+/*********
+ * Grey4 *
+ *********/
+
+/**
+ * Writes one pixel. Brightness is packed color, [0-15].
+ */
+static inline void FMGL_PF_Grey4WritePixel(uint8_t* line, uint16_t x, uint8_t brightness)
+{
+	uint8_t* pixels = &line[x / 2U];
+
+	if (0 == x % 2U)
+	{
+		*pixels = (*pixels & 0x0FU) | (uint8_t)(brightness << 4);
+	}
+	else
+	{
+		*pixels = (*pixels & 0xF0U) | brightness;
+	}
+}
+
+/**
+ * Fills pixels [x1; x2] of framebuffer line, whole bytes are filled by memset().
+ */
+static inline void FMGL_PF_Grey4FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint8_t brightness)
+{
+	uint32_t x = x1;
+	uint32_t end = (uint32_t)x2 + 1U;
+
+	if (0 != x % 2U)
+	{
+		FMGL_PF_Grey4WritePixel(line, x, brightness);
+		x ++;
+	}
+
+	uint32_t pairsCount = (end - x) / 2U;
+	memset(&line[x / 2U], (uint8_t)((brightness << 4) | brightness), pairsCount);
+	x += pairsCount * 2U;
+
+	if (x < end)
+	{
+		FMGL_PF_Grey4WritePixel(line, x, brightness);
+	}
+}
+
+/**
+ * Renders top left width x height part of XBM image at (x, y). Brightnesses are packed colors.
+ */
+static inline void FMGL_PF_Grey4Blit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image,
+		uint16_t width, uint16_t height, uint8_t activeBrightness, uint8_t inactiveBrightness, FMGL_API_XBMTransparencyMode transparency)
+{
+	bool isActiveWritten = (FMGL_XBMTransparencyModeTransparentActive != transparency);
+	bool isInactiveWritten = (FMGL_XBMTransparencyModeTransparentInactive != transparency);
+
+	uint16_t imageLineSize = FMGL_PF_GetXBMLineSize(image);
+
+	for (uint16_t row = 0; row < height; row++)
+	{
+		const uint8_t* source = &image->Raster[row * imageLineSize];
+		uint8_t* line = &framebuffer[(y + row) * lineSize];
+
+		uint16_t column = 0;
+
+		if (isActiveWritten && isInactiveWritten)
+		{
+			/* Opaque image, writing whole bytes (pairs of pixels) after odd leftmost pixel */
+			if (0 != x % 2U)
+			{
+				FMGL_PF_Grey4WritePixel(line, x, FMGL_PF_IsXBMPixelActive(image, source, 0) ? activeBrightness : inactiveBrightness);
+				column = 1;
+			}
+
+			for (; column + 1U < width; column += 2U)
+			{
+				uint8_t left = FMGL_PF_IsXBMPixelActive(image, source, column) ? activeBrightness : inactiveBrightness;
+				uint8_t right = FMGL_PF_IsXBMPixelActive(image, source, column + 1U) ? activeBrightness : inactiveBrightness;
+
+				line[(x + column) / 2U] = (uint8_t)((left << 4) | right);
+			}
+		}
+
+		for (; column < width; column++)
+		{
+			if (FMGL_PF_IsXBMPixelActive(image, source, column))
+			{
+				if (isActiveWritten)
+				{
+					FMGL_PF_Grey4WritePixel(line, x + column, activeBrightness);
+				}
+			}
+			else if (isInactiveWritten)
+			{
+				FMGL_PF_Grey4WritePixel(line, x + column, inactiveBrightness);
+			}
+		}
+	}
+}
+
+/**********
+ * RGB565 *
+ **********/
+
+/**
+ * Packs color into RGB565.
+ */
+static inline uint16_t FMGL_PF_PackRGB565(FMGL_API_ColorStruct color)
+{
+	return (uint16_t)(((color.R & 0xF8U) << 8) | ((color.G & 0xFCU) << 3) | (color.B >> 3));
+}
+
+/**
+ * Writes one pixel.
+ */
+static inline void FMGL_PF_RGB565WritePixel(uint8_t* line, uint16_t x, uint16_t packedColor)
+{
+	uint8_t* pixel = &line[x * FMGL_PF_RGB565_BYTES_PER_PIXEL];
+
+	pixel[0] = (uint8_t)(packedColor >> 8);
+	pixel[1] = (uint8_t)(packedColor & 0xFFU);
+}
+
+/**
+ * Fills pixels [x1; x2] of framebuffer line.
+ */
+static inline void FMGL_PF_RGB565FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint16_t packedColor)
+{
+	for (uint16_t x = x1; x <= x2; x++)
+	{
+		FMGL_PF_RGB565WritePixel(line, x, packedColor);
+	}
+}
+
+/**
+ * Renders top left width x height part of XBM image at (x, y).
+ */
+static inline void FMGL_PF_RGB565Blit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image,
+		uint16_t width, uint16_t height, uint16_t activeColor, uint16_t inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+{
+	bool isActiveWritten = (FMGL_XBMTransparencyModeTransparentActive != transparency);
+	bool isInactiveWritten = (FMGL_XBMTransparencyModeTransparentInactive != transparency);
+
+	uint16_t imageLineSize = FMGL_PF_GetXBMLineSize(image);
+
+	for (uint16_t row = 0; row < height; row++)
+	{
+		const uint8_t* source = &image->Raster[row * imageLineSize];
+		uint8_t* line = &framebuffer[(y + row) * lineSize];
+
+		for (uint16_t column = 0; column < width; column++)
+		{
+			if (FMGL_PF_IsXBMPixelActive(image, source, column))
+			{
+				if (isActiveWritten)
+				{
+					FMGL_PF_RGB565WritePixel(line, x + column, activeColor);
+				}
+			}
+			else if (isInactiveWritten)
+			{
+				FMGL_PF_RGB565WritePixel(line, x + column, inactiveColor);
+			}
+		}
+	}
+}
+
+/**********
+ * RGB888 *
+ **********/
+
+/**
+ * Writes one pixel.
+ */
+static inline void FMGL_PF_RGB888WritePixel(uint8_t* line, uint16_t x, FMGL_API_ColorStruct color)
+{
+	uint8_t* pixel = &line[x * FMGL_PF_RGB888_BYTES_PER_PIXEL];
+
+	pixel[0] = color.R;
+	pixel[1] = color.G;
+	pixel[2] = color.B;
+}
+
+/**
+ * Fills pixels [x1; x2] of framebuffer line.
+ */
+static inline void FMGL_PF_RGB888FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, FMGL_API_ColorStruct color)
+{
+	for (uint16_t x = x1; x <= x2; x++)
+	{
+		FMGL_PF_RGB888WritePixel(line, x, color);
+	}
+}
+
+/**
+ * Renders top left width x height part of XBM image at (x, y).
+ */
+static inline void FMGL_PF_RGB888Blit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image,
+		uint16_t width, uint16_t height, FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+{
+	bool isActiveWritten = (FMGL_XBMTransparencyModeTransparentActive != transparency);
+	bool isInactiveWritten = (FMGL_XBMTransparencyModeTransparentInactive != transparency);
+
+	uint16_t imageLineSize = FMGL_PF_GetXBMLineSize(image);
+
+	for (uint16_t row = 0; row < height; row++)
+	{
+		const uint8_t* source = &image->Raster[row * imageLineSize];
+		uint8_t* line = &framebuffer[(y + row) * lineSize];
+
+		for (uint16_t column = 0; column < width; column++)
+		{
+			if (FMGL_PF_IsXBMPixelActive(image, source, column))
+			{
+				if (isActiveWritten)
+				{
+					FMGL_PF_RGB888WritePixel(line, x + column, activeColor);
+				}
+			}
+			else if (isInactiveWritten)
+			{
+				FMGL_PF_RGB888WritePixel(line, x + column, inactiveColor);
+			}
+		}
+	}
+}
+
+#endif /* FMGL_INCLUDE_FMGL_PIXEL_FORMATS_H_ */
@@ -43,9 +43,20 @@
 #define FMGL_PRIV_XBM_COLORS_NUMBER 2
 
 /**
- * Maximal allowed substring length for FMGL_Priv_RenderSubstring()
+ * Scaled XBM images are rendered by rows, each row is scaled up into buffer of this size (in bytes).
+ * Wider images (visible part) are rendered by blocks.
  */
-#define FMGL_PRIV_MAX_SUBSTRING_LENGTH 63
+#define FMGL_PRIV_SCALED_ROW_BUFFER_SIZE 64
+
+/**
+ * Maximal valid Unicode code point.
+ */
+#define FMGL_PRIV_MAX_CODE_POINT 0x10FFFFU
+
+/**
+ * Marks absence of previous character (at line start), never returned by UTF-8 decoder.
+ */
+#define FMGL_PRIV_NO_CHARACTER 0xFFFFFFFFU
 
 
 /**
@@ -58,6 +69,58 @@
  */
 bool FMGL_Priv_IsActiveXBMPixel(FMGL_API_XBMImage* image, uint16_t x, uint16_t y);
 
+/**
+ * Adds region to dirty regions list, merging it with touching regions. Region must be on screen.
+ * @param context Pointer to FMGL library context.
+ * @param region Region to add.
+ */
+void FMGL_Priv_AddDirtyRegion(FMGL_API_DriverContext* context, FMGL_API_RegionStruct region);
+
+/**
+ * Returns true if regions overlap or are adjacent.
+ * @param region1 First region.
+ * @param region2 Second region.
+ * @return True if regions can be merged without gaps.
+ */
+bool FMGL_Priv_IsRegionsTouching(FMGL_API_RegionStruct region1, FMGL_API_RegionStruct region2);
+
+/**
+ * Returns bounding box of two regions.
+ * @param region1 First region.
+ * @param region2 Second region.
+ * @return Smallest region, containing both regions.
+ */
+FMGL_API_RegionStruct FMGL_Priv_GetRegionsUnion(FMGL_API_RegionStruct region1, FMGL_API_RegionStruct region2);
+
+/**
+ * Returns region area.
+ * @param region Region.
+ * @return Region area in pixels.
+ */
+uint32_t FMGL_Priv_GetRegionArea(FMGL_API_RegionStruct region);
+
+/**
+ * Clips rectangle by current clip region, fills visible part with active color using the fastest operation, provided by driver,
+ * and marks it as dirty. x1 <= x2 and y1 <= y2 are required.
+ * @param context Pointer to FMGL library context.
+ * @param x1 Left X coordinate.
+ * @param y1 Top Y coordinate.
+ * @param x2 Right X coordinate.
+ * @param y2 Bottom Y coordinate.
+ */
+void FMGL_Priv_FillRect(FMGL_API_DriverContext* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+/**
+ * Scales up one row of XBM image horizontally, replicating each pixel scaleX times. Result is MSB-first.
+ * @param image Pointer to XBM image struct.
+ * @param y Row to scale.
+ * @param scaleX Scale factor.
+ * @param offset Skip this number of leftmost scaled pixels.
+ * @param width Scaled row width, only this number of pixels (after skipped ones) will be generated.
+ * @param buffer Buffer for scaled row, at least (width + 7) / 8 bytes.
+ */
+void FMGL_Priv_ScaleXBMRow(FMGL_API_XBMImage* image, uint16_t y, uint16_t scaleX, uint16_t offset, uint16_t width, uint8_t* buffer);
+
 /**
  * Draws one character at given position.
  * @param context Pointer to FMGL library context.
@@ -66,23 +129,103 @@ bool FMGL_Priv_IsActiveXBMPixel(FMGL_API_XBMImage* image, uint16_t x, uint16_t y
  * @param y Character top left corner Y position.
  * @param character Character to draw.
  */
-void FMGL_Priv_RenderCharacter(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, char character);
+void FMGL_Priv_RenderCharacter(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint32_t character);
 
 /**
- * For internal use in FMGL_RenderTextWithLineBreaks().
+ * Renders one line of text, given by pointer and length (so line doesn't need to be null-terminated). Draws until line end or until
+ * no pixels of next character falls into screen area.
  * @param context Pointer to FMGL library context.
  * @param fontSettings Pointer to font settings.
- * @param startPos Start position in string from what substring to render begins.
- * @param length Substring to render length.
- * @param x X coordinate of substring top left pixel.
- * @param y Pointer to Y coordinate of top substring top left pixel. Will be incremented to scaledLineHeight.
- * @param scaledLineHeight Scaled line height (could be calculated, but have to be provided to improve speed).
- * @param width Pointer to variable, where width (in pixels) is stored. If substring width is higher than width, then width will be updated
- * to substring width.
+ * @param x,y Top left line coordinates.
+ * @param width Pointer to variable, where rendered line width will be stored (untouched for empty line).
  * @param isDryRun If true, then doesn't draw anything, just calculating width.
- * @param string String, from what substring will be rendered.
+ * @param string Pointer to line start.
+ * @param length Line length in bytes.
+ */
+void FMGL_Priv_RenderLine(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t* width,
+		bool isDryRun, const char* string, uint16_t length);
+
+/**
+ * Measures one line of text, given by pointer and length. Width isn't clipped by screen.
+ * @param fontSettings Pointer to font settings.
+ * @param string Pointer to line start.
+ * @param length Line length in bytes.
+ * @param layout If not NULL, line characters and their positions are appended to layout characters.
+ * @return Line width in pixels.
+ */
+uint16_t FMGL_Priv_MeasureLine(FMGL_API_FontSettings* fontSettings, const char* string, uint16_t length, FMGL_API_TextLayoutStruct* layout);
+
+/**
+ * Renders line of cached layout, using stored characters positions.
+ * @param context Pointer to FMGL library context.
+ * @param fontSettings Pointer to font settings (the same as used for measurement).
+ * @param x,y Top left line coordinates.
+ * @param layout Cached layout.
+ * @param line Line index.
+ */
+void FMGL_Priv_RenderLayoutLine(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y,
+		FMGL_API_TextLayoutStruct* layout, uint16_t line);
+
+/**
+ * Returns offset of aligned line from budget left border.
+ * @param alignment Line alignment.
+ * @param lineWidth Line width.
+ * @param maxWidth Width budget.
+ * @return Offset in pixels, 0 if line is wider than budget.
+ */
+uint16_t FMGL_Priv_GetAlignmentOffset(FMGL_API_TextAlignment alignment, uint16_t lineWidth, uint16_t maxWidth);
+
+/**
+ * Returns distance between end of left character and start of right one: characters spacing plus kerning, both scaled.
+ * @param fontSettings Pointer to font settings.
+ * @param left Left character or FMGL_PRIV_NO_CHARACTER at line start (then distance is 0).
+ * @param right Right character.
+ * @return Distance in pixels, could be negative.
+ */
+int32_t FMGL_Priv_GetCharactersDistance(FMGL_API_FontSettings* fontSettings, uint32_t left, uint32_t right);
+
+/**
+ * Renders line of wrapped text, aligning it within width budget.
+ * @param context Pointer to FMGL library context.
+ * @param fontSettings Pointer to font settings.
+ * @param x,y Top left corner of budget.
+ * @param maxWidth Width budget.
+ * @param alignment Line alignment.
+ * @param isDryRun If true, then does nothing.
+ * @param string Pointer to line start.
+ * @param length Line length in bytes.
+ * @param lineWidth Line width in pixels (already measured during layout).
+ */
+void FMGL_Priv_RenderWrappedLine(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t maxWidth,
+		FMGL_API_TextAlignment alignment, bool isDryRun, const char* string, uint16_t length, uint16_t lineWidth);
+
+/**
+ * Calculates FNV-1a hash of null-terminated string.
+ * @param string String to hash.
+ * @param length Pointer to variable, where string length will be stored.
+ * @return String hash.
+ */
+uint32_t FMGL_Priv_HashString(const char* string, uint16_t* length);
+
+/**
+ * Renders text with line breaks, aligning lines within text width.
+ * @param context Pointer to FMGL library context.
+ * @param fontSettings Pointer to font settings.
+ * @param x,y Top left text coordinates.
+ * @param alignment Lines alignment.
+ * @param layout Text layout.
+ * @param string Text (UTF-8).
+ */
+void FMGL_Priv_RenderTextLayout(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y,
+		FMGL_API_TextAlignment alignment, FMGL_API_TextLayoutStruct* layout, const char* string);
+
+/**
+ * Returns layout of given text, measuring it if text isn't cached yet.
+ * @param context Pointer to FMGL library context.
+ * @param fontSettings Pointer to font settings.
+ * @param string Text (UTF-8), newlines are allowed.
+ * @return Pointer to layout in context cache. Valid until next measurement.
  */
-void FMGL_Priv_RenderSubstring(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t startPos, uint16_t length,
-		uint16_t x, uint16_t* y, uint16_t scaledLineHeight, uint16_t* width, bool isDryRun, char* string);
+FMGL_API_TextLayoutStruct* FMGL_Priv_GetTextLayout(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, const char* string);
 
 #endif /* FMGL_INCLUDE_FMGL_PRIVATE_H_ */
@@ -0,0 +1,171 @@
+/*
+ * layers.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#ifndef FMGL_LAYERS_INCLUDE_LAYERS_H_
+#define FMGL_LAYERS_INCLUDE_LAYERS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../include/fmgl.h"
+
+/**
+ * Layers are copied between external memory and framebuffer by chunks of this size (in bytes). Each layers
+ * storage keeps two such buffers (for image and for mask) in SRAM, so single layer line (width / 8 bytes)
+ * must fit into it.
+ */
+#ifndef FMGL_LAYERS_CHUNK_SIZE
+	#define FMGL_LAYERS_CHUNK_SIZE 256U
+#endif
+
+/**
+ * Layers storage - region of external memory (PSRAM), from which layers are allocated.
+ */
+typedef struct
+{
+	/**
+	 * Memory driver context
+	 */
+	void* MemoryDriverContext;
+
+	/**
+	 * Pointer to memory write function
+	 */
+	void (*MemoryWriteFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*);
+
+	/**
+	 * Pointer to memory read function
+	 */
+	void (*MemoryReadFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*);
+
+	/**
+	 * Storage starts at this address
+	 */
+	uint32_t BaseAddress;
+
+	/**
+	 * Storage size in bytes
+	 */
+	uint32_t Size;
+
+	/**
+	 * Next layer will be allocated at this address
+	 */
+	uint32_t NextAddress;
+
+	/**
+	 * Image lines are transferred through this buffer
+	 */
+	uint8_t ImageBuffer[FMGL_LAYERS_CHUNK_SIZE];
+
+	/**
+	 * Mask lines are transferred through this buffer
+	 */
+	uint8_t MaskBuffer[FMGL_LAYERS_CHUNK_SIZE];
+}
+FMGL_Layers_StorageStruct;
+
+/**
+ * Layer - monochrome off-screen image, stored in external memory. Layer consists of image and optional
+ * transparency mask, both are packed as MSB-first XBMs. Active pixels of mask are opaque.
+ */
+typedef struct
+{
+	/**
+	 * Layer is allocated in this storage
+	 */
+	FMGL_Layers_StorageStruct* Storage;
+
+	/**
+	 * Layer width
+	 */
+	uint16_t Width;
+
+	/**
+	 * Layer height
+	 */
+	uint16_t Height;
+
+	/**
+	 * Bytes per line
+	 */
+	uint16_t LineSize;
+
+	/**
+	 * If true, layer has transparency mask
+	 */
+	bool HasMask;
+
+	/**
+	 * Image address in external memory
+	 */
+	uint32_t ImageAddress;
+
+	/**
+	 * Mask address in external memory (valid only if HasMask is true)
+	 */
+	uint32_t MaskAddress;
+}
+FMGL_Layers_LayerStruct;
+
+/**
+ * Initialize layers storage. Storage occupies [baseAddress; baseAddress + size) of external memory.
+ */
+void FMGL_Layers_InitStorage
+(
+	FMGL_Layers_StorageStruct* storage,
+
+	void* memoryDriverContext,
+
+	void (*memoryWriteFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*),
+
+	void (*memoryReadFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*),
+
+	uint32_t baseAddress,
+
+	uint32_t size
+);
+
+/**
+ * Free all layers, allocated in given storage. Previously created layers MUST NOT be used after it.
+ */
+void FMGL_Layers_ResetStorage(FMGL_Layers_StorageStruct* storage);
+
+/**
+ * Allocate new layer in storage. Content of new layer is undefined, fill it using FMGL_Layers_Capture*()
+ * or FMGL_Layers_LoadImage() before drawing.
+ */
+FMGL_Layers_LayerStruct FMGL_Layers_Create(FMGL_Layers_StorageStruct* storage, uint16_t width, uint16_t height, bool hasMask);
+
+/**
+ * Copy framebuffer rectangle, starting at (x, y) and having layer size into layer image. Pixels, having
+ * color other than inactiveColor, become active. Rectangle must be completely on screen.
+ */
+void FMGL_Layers_CaptureImage(FMGL_Layers_LayerStruct* layer, FMGL_API_DriverContext* context, uint16_t x, uint16_t y,
+		FMGL_API_ColorStruct inactiveColor);
+
+/**
+ * As FMGL_Layers_CaptureImage(), but captures into layer mask. Pixels, having color other than
+ * transparentColor, become opaque.
+ */
+void FMGL_Layers_CaptureMask(FMGL_Layers_LayerStruct* layer, FMGL_API_DriverContext* context, uint16_t x, uint16_t y,
+		FMGL_API_ColorStruct transparentColor);
+
+/**
+ * Load layer image (and mask, if layer has it and mask isn't NULL) from XBM images. Images must have layer size.
+ */
+void FMGL_Layers_LoadImage(FMGL_Layers_LayerStruct* layer, FMGL_API_XBMImage* image, FMGL_API_XBMImage* mask);
+
+/**
+ * Draw layer into framebuffer with top left corner at (x, y). Layer is clipped by current clip region.
+ * If layer has mask, then transparency parameter is ignored and pixels are taken from image only
+ * where mask is active.
+ */
+void FMGL_Layers_Draw(FMGL_Layers_LayerStruct* layer, FMGL_API_DriverContext* context, uint16_t x, uint16_t y,
+		FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency);
+
+
+#endif /* FMGL_LAYERS_INCLUDE_LAYERS_H_ */
@@ -0,0 +1,37 @@
+/*
+ * layers_private.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#ifndef FMGL_LAYERS_INCLUDE_LAYERS_PRIVATE_H_
+#define FMGL_LAYERS_INCLUDE_LAYERS_PRIVATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "layers.h"
+
+/**
+ * How many layer lines fit into one chunk
+ */
+uint16_t FMGL_Layers_GetLinesPerChunk(FMGL_Layers_LayerStruct* layer);
+
+/**
+ * Capture framebuffer rectangle into external memory at given address (image or mask of layer)
+ */
+void FMGL_Layers_CaptureInternal(FMGL_Layers_LayerStruct* layer, uint32_t address, FMGL_API_DriverContext* context,
+		uint16_t x, uint16_t y, FMGL_API_ColorStruct inactiveColor);
+
+/**
+ * Copy XBM image into external memory at given address, converting it to MSB-first bits order if needed
+ */
+void FMGL_Layers_LoadInternal(FMGL_Layers_LayerStruct* layer, uint32_t address, FMGL_API_XBMImage* image);
+
+/**
+ * Returns true if colors are the same
+ */
+bool FMGL_Layers_IsSameColor(FMGL_API_ColorStruct color1, FMGL_API_ColorStruct color2);
+
+
+#endif /* FMGL_LAYERS_INCLUDE_LAYERS_PRIVATE_H_ */
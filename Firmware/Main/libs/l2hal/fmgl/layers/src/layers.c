@@ -0,0 +1,262 @@
+/*
+ * layers.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include "../include/layers.h"
+#include "../include/layers_private.h"
+#include "../../include/fmgl_pixel_formats.h"
+#include "../../../include/l2hal_errors.h"
+#include "../../../include/l2hal_aux.h"
+#include <string.h>
+
+void FMGL_Layers_InitStorage
+(
+	FMGL_Layers_StorageStruct* storage,
+
+	void* memoryDriverContext,
+
+	void (*memoryWriteFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*),
+
+	void (*memoryReadFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*),
+
+	uint32_t baseAddress,
+
+	uint32_t size
+)
+{
+	storage->MemoryDriverContext = memoryDriverContext;
+	storage->MemoryWriteFunctionPtr = memoryWriteFunctionPtr;
+	storage->MemoryReadFunctionPtr = memoryReadFunctionPtr;
+	storage->BaseAddress = baseAddress;
+	storage->Size = size;
+
+	FMGL_Layers_ResetStorage(storage);
+}
+
+void FMGL_Layers_ResetStorage(FMGL_Layers_StorageStruct* storage)
+{
+	storage->NextAddress = storage->BaseAddress;
+}
+
+FMGL_Layers_LayerStruct FMGL_Layers_Create(FMGL_Layers_StorageStruct* storage, uint16_t width, uint16_t height, bool hasMask)
+{
+	FMGL_Layers_LayerStruct layer;
+
+	if (0 == width || 0 == height)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	layer.Storage = storage;
+	layer.Width = width;
+	layer.Height = height;
+	layer.LineSize = (width + FMGL_PF_BITS_PER_BYTE - 1) / FMGL_PF_BITS_PER_BYTE;
+	layer.HasMask = hasMask;
+
+	if (layer.LineSize > FMGL_LAYERS_CHUNK_SIZE)
+	{
+		/* Line doesn't fit into transfer buffer */
+		L2HAL_Error(WrongArgument);
+	}
+
+	uint32_t planeSize = (uint32_t)layer.LineSize * height;
+	uint32_t requiredSize = hasMask ? 2 * planeSize : planeSize;
+
+	if (requiredSize > storage->BaseAddress + storage->Size - storage->NextAddress)
+	{
+		/* Out of storage */
+		L2HAL_Error(Generic);
+	}
+
+	layer.ImageAddress = storage->NextAddress;
+	layer.MaskAddress = hasMask ? layer.ImageAddress + planeSize : layer.ImageAddress;
+
+	storage->NextAddress += requiredSize;
+
+	return layer;
+}
+
+void FMGL_Layers_CaptureImage(FMGL_Layers_LayerStruct* layer, FMGL_API_DriverContext* context, uint16_t x, uint16_t y,
+		FMGL_API_ColorStruct inactiveColor)
+{
+	FMGL_Layers_CaptureInternal(layer, layer->ImageAddress, context, x, y, inactiveColor);
+}
+
+void FMGL_Layers_CaptureMask(FMGL_Layers_LayerStruct* layer, FMGL_API_DriverContext* context, uint16_t x, uint16_t y,
+		FMGL_API_ColorStruct transparentColor)
+{
+	if (!layer->HasMask)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	FMGL_Layers_CaptureInternal(layer, layer->MaskAddress, context, x, y, transparentColor);
+}
+
+void FMGL_Layers_LoadImage(FMGL_Layers_LayerStruct* layer, FMGL_API_XBMImage* image, FMGL_API_XBMImage* mask)
+{
+	FMGL_Layers_LoadInternal(layer, layer->ImageAddress, image);
+
+	if (layer->HasMask && NULL != mask)
+	{
+		FMGL_Layers_LoadInternal(layer, layer->MaskAddress, mask);
+	}
+}
+
+void FMGL_Layers_Draw(FMGL_Layers_LayerStruct* layer, FMGL_API_DriverContext* context, uint16_t x, uint16_t y,
+		FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+{
+	FMGL_Layers_StorageStruct* storage = layer->Storage;
+	FMGL_API_RegionStruct* clip = &context->ClipRegion;
+
+	/* Nothing visible - no need to even read external memory */
+	if
+	(
+		clip->X1 > clip->X2
+		||
+		clip->Y1 > clip->Y2
+		||
+		x > clip->X2
+		||
+		y > clip->Y2
+		||
+		(uint32_t)x + layer->Width - 1 < clip->X1
+		||
+		(uint32_t)y + layer->Height - 1 < clip->Y1
+	)
+	{
+		return;
+	}
+
+	/* Only lines within clip region are read */
+	uint16_t firstLine = clip->Y1 > y ? clip->Y1 - y : 0;
+	uint16_t lastLine = MIN(layer->Height - 1, clip->Y2 - y);
+	uint16_t linesPerChunk = FMGL_Layers_GetLinesPerChunk(layer);
+
+	FMGL_API_XBMImage chunk;
+	chunk.Width = layer->Width;
+	chunk.IsMSBFirst = true;
+
+	for (uint16_t line = firstLine; line <= lastLine; line += linesPerChunk)
+	{
+		chunk.Height = MIN(linesPerChunk, lastLine - line + 1);
+		uint32_t offset = (uint32_t)line * layer->LineSize;
+		uint32_t chunkSize = (uint32_t)chunk.Height * layer->LineSize;
+
+		storage->MemoryReadFunctionPtr(storage->MemoryDriverContext, layer->ImageAddress + offset, chunkSize, storage->ImageBuffer);
+
+		if (!layer->HasMask)
+		{
+			chunk.Raster = storage->ImageBuffer;
+			FMGL_API_RenderXBM(context, &chunk, x, y + line, 1, 1, activeColor, inactiveColor, transparency);
+			continue;
+		}
+
+		storage->MemoryReadFunctionPtr(storage->MemoryDriverContext, layer->MaskAddress + offset, chunkSize, storage->MaskBuffer);
+
+		/* Splitting opaque pixels into active and inactive ones, both are drawn with transparent background */
+		for (uint32_t index = 0; index < chunkSize; index++)
+		{
+			uint8_t image = storage->ImageBuffer[index];
+			uint8_t mask = storage->MaskBuffer[index];
+
+			storage->ImageBuffer[index] = image & mask;
+			storage->MaskBuffer[index] = (uint8_t)~image & mask;
+		}
+
+		chunk.Raster = storage->ImageBuffer;
+		FMGL_API_RenderXBM(context, &chunk, x, y + line, 1, 1, activeColor, inactiveColor, FMGL_XBMTransparencyModeTransparentInactive);
+
+		chunk.Raster = storage->MaskBuffer;
+		FMGL_API_RenderXBM(context, &chunk, x, y + line, 1, 1, inactiveColor, activeColor, FMGL_XBMTransparencyModeTransparentInactive);
+	}
+}
+
+uint16_t FMGL_Layers_GetLinesPerChunk(FMGL_Layers_LayerStruct* layer)
+{
+	return FMGL_LAYERS_CHUNK_SIZE / layer->LineSize;
+}
+
+void FMGL_Layers_CaptureInternal(FMGL_Layers_LayerStruct* layer, uint32_t address, FMGL_API_DriverContext* context,
+		uint16_t x, uint16_t y, FMGL_API_ColorStruct inactiveColor)
+{
+	FMGL_Layers_StorageStruct* storage = layer->Storage;
+
+	if
+	(
+		(uint32_t)x + layer->Width > FMGL_API_GetDisplayWidth(context)
+		||
+		(uint32_t)y + layer->Height > FMGL_API_GetDisplayHeight(context)
+	)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	uint16_t linesPerChunk = FMGL_Layers_GetLinesPerChunk(layer);
+
+	for (uint16_t line = 0; line < layer->Height; line += linesPerChunk)
+	{
+		uint16_t linesCount = MIN(linesPerChunk, layer->Height - line);
+		uint32_t chunkSize = (uint32_t)linesCount * layer->LineSize;
+
+		memset(storage->ImageBuffer, 0x00, chunkSize);
+
+		for (uint16_t chunkLine = 0; chunkLine < linesCount; chunkLine++)
+		{
+			uint8_t* row = storage->ImageBuffer + chunkLine * layer->LineSize;
+
+			for (uint16_t column = 0; column < layer->Width; column++)
+			{
+				FMGL_API_ColorStruct color = FMGL_API_GetPixel(context, x + column, y + line + chunkLine);
+
+				if (!FMGL_Layers_IsSameColor(color, inactiveColor))
+				{
+					row[column / FMGL_PF_BITS_PER_BYTE] |= (uint8_t)(0x80U >> (column % FMGL_PF_BITS_PER_BYTE));
+				}
+			}
+		}
+
+		storage->MemoryWriteFunctionPtr(storage->MemoryDriverContext, address + (uint32_t)line * layer->LineSize, chunkSize,
+				storage->ImageBuffer);
+	}
+}
+
+void FMGL_Layers_LoadInternal(FMGL_Layers_LayerStruct* layer, uint32_t address, FMGL_API_XBMImage* image)
+{
+	FMGL_Layers_StorageStruct* storage = layer->Storage;
+
+	if (image->Width != layer->Width || image->Height != layer->Height)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	uint16_t linesPerChunk = FMGL_Layers_GetLinesPerChunk(layer);
+	uint32_t planeSize = (uint32_t)layer->LineSize * layer->Height;
+
+	for (uint32_t offset = 0; offset < planeSize; offset += (uint32_t)linesPerChunk * layer->LineSize)
+	{
+		uint32_t chunkSize = MIN((uint32_t)linesPerChunk * layer->LineSize, planeSize - offset);
+
+		if (image->IsMSBFirst)
+		{
+			memcpy(storage->ImageBuffer, image->Raster + offset, chunkSize);
+		}
+		else
+		{
+			for (uint32_t index = 0; index < chunkSize; index++)
+			{
+				storage->ImageBuffer[index] = FMGL_PF_ReverseBits(image->Raster[offset + index]);
+			}
+		}
+
+		storage->MemoryWriteFunctionPtr(storage->MemoryDriverContext, address + offset, chunkSize, storage->ImageBuffer);
+	}
+}
+
+bool FMGL_Layers_IsSameColor(FMGL_API_ColorStruct color1, FMGL_API_ColorStruct color2)
+{
+	return color1.R == color2.R && color1.G == color2.G && color1.B == color2.B;
+}
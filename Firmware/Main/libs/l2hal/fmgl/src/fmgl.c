@@ -53,16 +53,61 @@ FMGL_API_DriverContext FMGL_API_AttachToDriver
 	context.PushFramebuffer = pushFramebuffer;
 	context.ClearFramebuffer = clearFramebuffer;
 
+	/* Bulk operations are optional, see FMGL_API_AttachBulkOperations() */
+	context.FillSpan = NULL;
+	context.FillRect = NULL;
+	context.BlitMono1bpp = NULL;
+	context.PushRegions = NULL;
+
+	context.DirtyRegionsCount = 0;
+
+	/* Text layout cache is empty */
+	for (uint8_t i = 0; i < FMGL_API_TEXT_LAYOUT_CACHE_SIZE; i ++)
+	{
+		context.TextLayoutCache[i].IsValid = false;
+	}
+	context.TextLayoutCacheNextEntry = 0;
+
 	/* Maximal coordinates */
 	context.MaxX = context.GetWidth() - 1;
 	context.MaxY = context.GetHeight() - 1;
 
+	/* Drawing is allowed on whole screen */
+	context.ClipRegion.X1 = 0;
+	context.ClipRegion.Y1 = 0;
+	context.ClipRegion.X2 = context.MaxX;
+	context.ClipRegion.Y2 = context.MaxY;
+	context.ClipStackCount = 0;
+
 	/* Blanking color */
 	context.BlankingColor = blankingColor;
 
 	return context;
 }
 
+void FMGL_API_AttachBulkOperations
+(
+	FMGL_API_DriverContext* context,
+	void (*fillSpan) (void* deviceContext, uint16_t x1, uint16_t x2, uint16_t y),
+	void (*fillRect) (void* deviceContext, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2),
+	void (*blitMono1bpp) (void* deviceContext, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+			FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
+)
+{
+	context->FillSpan = fillSpan;
+	context->FillRect = fillRect;
+	context->BlitMono1bpp = blitMono1bpp;
+}
+
+void FMGL_API_AttachRegionsPush
+(
+	FMGL_API_DriverContext* context,
+	void (*pushRegions) (void* deviceContext, FMGL_API_RegionStruct* regions, uint8_t regionsCount)
+)
+{
+	context->PushRegions = pushRegions;
+}
+
 void FMGL_API_SetActiveColor(FMGL_API_DriverContext* context, FMGL_API_ColorStruct color)
 {
 	context->ActiveColor = color;
@@ -81,22 +126,79 @@ FMGL_API_ColorStruct FMGL_API_GetActiveColor(FMGL_API_DriverContext* context)
 
 void FMGL_API_DrawPixel (FMGL_API_DriverContext* context, uint16_t x, uint16_t y)
 {
+	if (x < context->ClipRegion.X1 || x > context->ClipRegion.X2 || y < context->ClipRegion.Y1 || y > context->ClipRegion.Y2)
+	{
+		return;
+	}
+
+	FMGL_API_RegionStruct region = { x, y, x, y };
+	FMGL_Priv_AddDirtyRegion(context, region);
+
 	context->DrawPixel(context->DeviceContext, x, y);
 }
 
 FMGL_API_ColorStruct FMGL_API_GetPixel(FMGL_API_DriverContext* context, uint16_t x, uint16_t y)
 {
-	FMGL_API_ColorStruct result;
-	result.R = 0;
-	result.G = 0;
-	result.B = 0;
-
 	return context->GetPixel(context->DeviceContext, x, y);
 }
 
 void FMGL_API_PushFramebuffer (FMGL_API_DriverContext* context)
 {
-	context->PushFramebuffer(context->DeviceContext);
+	if (NULL == context->PushRegions)
+	{
+		context->PushFramebuffer(context->DeviceContext);
+	}
+	else if (context->DirtyRegionsCount > 0)
+	{
+		context->PushRegions(context->DeviceContext, context->DirtyRegions, context->DirtyRegionsCount);
+	}
+
+	context->DirtyRegionsCount = 0;
+}
+
+void FMGL_API_MarkRegionAsDirty(FMGL_API_DriverContext* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	FMGL_API_RegionStruct region;
+	region.X1 = MIN(x1, x2);
+	region.Y1 = MIN(y1, y2);
+
+	if (region.X1 > context->MaxX || region.Y1 > context->MaxY)
+	{
+		return;
+	}
+
+	region.X2 = MIN(MAX(x1, x2), context->MaxX);
+	region.Y2 = MIN(MAX(y1, y2), context->MaxY);
+
+	FMGL_Priv_AddDirtyRegion(context, region);
+}
+
+void FMGL_API_PushClipRegion(FMGL_API_DriverContext* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	if (context->ClipStackCount >= FMGL_API_CLIP_STACK_DEPTH)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	context->ClipStack[context->ClipStackCount] = context->ClipRegion;
+	context->ClipStackCount ++;
+
+	/* New region is intersection with current one, it could be empty */
+	context->ClipRegion.X1 = MAX(MIN(x1, x2), context->ClipRegion.X1);
+	context->ClipRegion.Y1 = MAX(MIN(y1, y2), context->ClipRegion.Y1);
+	context->ClipRegion.X2 = MIN(MAX(x1, x2), context->ClipRegion.X2);
+	context->ClipRegion.Y2 = MIN(MAX(y1, y2), context->ClipRegion.Y2);
+}
+
+void FMGL_API_PopClipRegion(FMGL_API_DriverContext* context)
+{
+	if (0 == context->ClipStackCount)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	context->ClipStackCount --;
+	context->ClipRegion = context->ClipStack[context->ClipStackCount];
 }
 
 uint16_t FMGL_API_GetDisplayWidth(FMGL_API_DriverContext* context)
@@ -112,19 +214,95 @@ uint16_t FMGL_API_GetDisplayHeight(FMGL_API_DriverContext* context)
 void FMGL_API_RenderXBM(FMGL_API_DriverContext* context, FMGL_API_XBMImage* image, uint16_t x, uint16_t y, uint16_t scaleX, uint16_t scaleY,
 		FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency)
 {
-	/* Do at least one pixel fit the screen? */
-	if (x > context->MaxX || y > context->MaxY)
+	if (0 == image->Width || 0 == image->Height || 0 == scaleX || 0 == scaleY)
+	{
+		return;
+	}
+
+	/* Visible part of image */
+	uint32_t visibleLeftX = MAX(x, context->ClipRegion.X1);
+	uint32_t visibleTopY = MAX(y, context->ClipRegion.Y1);
+	uint32_t visibleRightX = MIN(x + (uint32_t)image->Width * scaleX - 1, context->ClipRegion.X2);
+	uint32_t visibleBottomY = MIN(y + (uint32_t)image->Height * scaleY - 1, context->ClipRegion.Y2);
+
+	if (visibleLeftX > visibleRightX || visibleTopY > visibleBottomY)
 	{
 		return;
 	}
 
-	uint32_t scaledWidth = image->Width * scaleX;
-	uint32_t scaledHeight = image->Height * scaleY;
+	if (NULL != context->BlitMono1bpp)
+	{
+		uint32_t visibleWidth = visibleRightX - visibleLeftX + 1;
+		uint32_t visibleHeight = visibleBottomY - visibleTopY + 1;
+
+		FMGL_API_RegionStruct region = { visibleLeftX, visibleTopY, visibleRightX, visibleBottomY };
+		FMGL_Priv_AddDirtyRegion(context, region);
+
+		if (1 == scaleX && 1 == scaleY && visibleLeftX == x)
+		{
+			/* Top rows are skipped by moving raster start, rows are byte-aligned */
+			FMGL_API_XBMImage visibleImage = *image;
+			visibleImage.Raster += (visibleTopY - y) * ((image->Width + FMGL_PRIV_BITS_PER_BYTE - 1) / FMGL_PRIV_BITS_PER_BYTE);
+			visibleImage.Height -= visibleTopY - y;
+
+			context->BlitMono1bpp(context->DeviceContext, x, visibleTopY, &visibleImage, visibleWidth, visibleHeight, activeColor, inactiveColor, transparency);
+			return;
+		}
+
+		if (visibleWidth <= FMGL_PRIV_SCALED_ROW_BUFFER_SIZE * FMGL_PRIV_BITS_PER_BYTE)
+		{
+			/* Scaling visible part of image row by row. Scaled row is repeated in buffer as many times as fits,
+			 * so all target rows made of one source row are blitted at once */
+			uint8_t scaledRows[FMGL_PRIV_SCALED_ROW_BUFFER_SIZE];
+			uint16_t scaledRowSize = (visibleWidth + FMGL_PRIV_BITS_PER_BYTE - 1) / FMGL_PRIV_BITS_PER_BYTE;
+			uint16_t maxRowsCount = FMGL_PRIV_SCALED_ROW_BUFFER_SIZE / scaledRowSize;
+
+			FMGL_API_XBMImage scaledRowsImage;
+			scaledRowsImage.Width = visibleWidth;
+			scaledRowsImage.Raster = scaledRows;
+			scaledRowsImage.IsMSBFirst = true;
+
+			uint32_t targetY = visibleTopY;
+			while (targetY <= visibleBottomY)
+			{
+				uint32_t sourceY = (targetY - y) / scaleY;
+				uint32_t rowsCount = MIN(y + (sourceY + 1) * scaleY - 1, visibleBottomY) - targetY + 1;
+				uint16_t copiesCount = MIN(rowsCount, maxRowsCount);
+
+				FMGL_Priv_ScaleXBMRow(image, sourceY, scaleX, visibleLeftX - x, visibleWidth, scaledRows);
+				for (uint16_t copy = 1; copy < copiesCount; copy++)
+				{
+					memcpy(&scaledRows[copy * scaledRowSize], scaledRows, scaledRowSize);
+				}
+
+				while (rowsCount > 0)
+				{
+					scaledRowsImage.Height = MIN(rowsCount, copiesCount);
+
+					context->BlitMono1bpp(context->DeviceContext, visibleLeftX, targetY, &scaledRowsImage, visibleWidth, scaledRowsImage.Height,
+						activeColor, inactiveColor, transparency);
+
+					targetY += scaledRowsImage.Height;
+					rowsCount -= scaledRowsImage.Height;
+				}
+			}
+
+			return;
+		}
+	}
+
+	FMGL_API_ColorStruct previousActiveColor = FMGL_API_GetActiveColor(context);
 
 	FMGL_API_ColorStruct colors[FMGL_PRIV_XBM_COLORS_NUMBER]; /* Colors, active color first */
 	colors[FMGL_PRIV_XBM_ACTIVE_COLOR_INDEX] = activeColor;
 	colors[FMGL_PRIV_XBM_INACTIVE_COLOR_INDEX] = inactiveColor;
 
+	/* Only source pixels, which blocks are at least partially visible */
+	uint16_t firstSourceX = (visibleLeftX - x) / scaleX;
+	uint16_t lastSourceX = (visibleRightX - x) / scaleX;
+	uint16_t firstSourceY = (visibleTopY - y) / scaleY;
+	uint16_t lastSourceY = (visibleBottomY - y) / scaleY;
+
 	for (uint8_t colorIndex = 0; colorIndex < FMGL_PRIV_XBM_COLORS_NUMBER; colorIndex++)
 	{
 		if
@@ -140,14 +318,14 @@ void FMGL_API_RenderXBM(FMGL_API_DriverContext* context, FMGL_API_XBMImage* imag
 
 		FMGL_API_SetActiveColor(context, colors[colorIndex]);
 
-		for (uint32_t dy = 0; dy < scaledHeight; dy++)
+		/* Each image pixel becomes scaleX * scaleY block, clipped by FMGL_Priv_FillRect() */
+		for (uint16_t sy = firstSourceY; sy <= lastSourceY; sy++)
 		{
-			uint16_t sy = dy / scaleY;
+			uint16_t blockTopY = y + sy * scaleY;
+			uint16_t blockBottomY = MIN(blockTopY + scaleY - 1U, visibleBottomY);
 
-			for (uint32_t dx = 0; dx < scaledWidth; dx++)
+			for (uint16_t sx = firstSourceX; sx <= lastSourceX; sx++)
 			{
-				uint16_t sx = dx / scaleX;
-
 				bool isActive = FMGL_Priv_IsActiveXBMPixel(image, sx, sy);
 
 				if
@@ -157,66 +335,26 @@ void FMGL_API_RenderXBM(FMGL_API_DriverContext* context, FMGL_API_XBMImage* imag
 					((FMGL_PRIV_XBM_INACTIVE_COLOR_INDEX == colorIndex) && !isActive)
 				)
 				{
-					/* Active pixel */
-					FMGL_API_DrawPixel(context, dx + x, dy + y);
+					uint16_t blockLeftX = x + sx * scaleX;
+					uint16_t blockRightX = MIN(blockLeftX + scaleX - 1U, visibleRightX);
+
+					FMGL_Priv_FillRect(context, blockLeftX, blockTopY, blockRightX, blockBottomY);
 				}
 			}
 		}
 	}
+
+	FMGL_API_SetActiveColor(context, previousActiveColor);
 }
 
 void FMGL_API_DrawLineHorizontal(FMGL_API_DriverContext* context, uint16_t x1, uint16_t x2, uint16_t y)
 {
-	if (y > context->MaxY)
-	{
-		return;
-	}
-
-	uint16_t minX = MIN(x1, x2);
-	if (minX > context->MaxX)
-	{
-		/* Out of screen, can't draw */
-		return;
-	}
-
-	uint16_t maxX = MAX(x1, x2);
-
-	if (maxX > context->MaxX)
-	{
-		maxX = context->MaxX;
-	}
-
-	for (uint16_t x = minX; x <= maxX; x++)
-	{
-		FMGL_API_DrawPixel(context, x, y);
-	}
+	FMGL_Priv_FillRect(context, MIN(x1, x2), y, MAX(x1, x2), y);
 }
 
 void FMGL_API_DrawLineVertical(FMGL_API_DriverContext* context, uint16_t x, uint16_t y1, uint16_t y2)
 {
-	if (x > context->MaxX)
-	{
-		return;
-	}
-
-	uint16_t minY = MIN(y1, y2);
-
-	if (minY > context->MaxY)
-	{
-		return;
-	}
-
-	uint16_t maxY = MAX(y1, y2);
-
-	if (maxY > context->MaxY)
-	{
-		maxY = context->MaxY;
-	}
-
-	for (uint16_t y = minY; y <= maxY; y++)
-	{
-		FMGL_API_DrawPixel(context, x, y);
-	}
+	FMGL_Priv_FillRect(context, x, MIN(y1, y2), x, MAX(y1, y2));
 }
 
 /**
@@ -224,43 +362,16 @@ void FMGL_API_DrawLineVertical(FMGL_API_DriverContext* context, uint16_t x, uint
  */
 void FMGL_API_DrawRectangle(FMGL_API_DriverContext* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
-	/* Will at least one pixel be on screen */
 	uint16_t minX = MIN(x1, x2);
-
-	if (minX > context->MaxX)
-	{
-		return;
-	}
-
 	uint16_t minY = MIN(y1, y2);
-
-	if (minY > context->MaxY)
-	{
-		return;
-	}
-
-	/* At least some pixels will be displayed */
 	uint16_t maxX = MAX(x1, x2);
 	uint16_t maxY = MAX(y1, y2);
 
-	uint16_t maxVisibleX = MIN(maxX, context->MaxX);
-	uint16_t maxVisibleY = MIN(maxY, context->MaxY);
-
-	/* Drawing 100% visible parts */
-	FMGL_API_DrawLineHorizontal(context, minX, maxVisibleX, minY);
-	FMGL_API_DrawLineVertical(context, minX, minY, maxVisibleY);
-
-	/* Right border */
-	if (maxX <= context->MaxX)
-	{
-		FMGL_API_DrawLineVertical(context, maxVisibleX, minY, maxVisibleY);
-	}
-
-	/* Bottom border */
-	if (maxY <= context->MaxY)
-	{
-		FMGL_API_DrawLineHorizontal(context, minX, maxVisibleX, maxVisibleY);
-	}
+	/* Invisible borders are clipped away */
+	FMGL_API_DrawLineHorizontal(context, minX, maxX, minY);
+	FMGL_API_DrawLineHorizontal(context, minX, maxX, maxY);
+	FMGL_API_DrawLineVertical(context, minX, minY, maxY);
+	FMGL_API_DrawLineVertical(context, maxX, minY, maxY);
 }
 
 void FMGL_API_DrawRectangleFilled(FMGL_API_DriverContext* context,
@@ -273,63 +384,20 @@ void FMGL_API_DrawRectangleFilled(FMGL_API_DriverContext* context,
 {
 	FMGL_API_ColorStruct activeColor = FMGL_API_GetActiveColor(context);
 
-	/* Will at least one pixel be on screen */
 	uint16_t minX = MIN(x1, x2);
-
-	if (minX > context->MaxX)
-	{
-		return;
-	}
-
 	uint16_t minY = MIN(y1, y2);
-
-	if (minY > context->MaxY)
-	{
-		return;
-	}
-
-	/* At least some pixels will be displayed */
 	uint16_t maxX = MAX(x1, x2);
 	uint16_t maxY = MAX(y1, y2);
 
-	uint16_t maxVisibleX = MIN(maxX, context->MaxX);
-	uint16_t maxVisibleY = MIN(maxY, context->MaxY);
-
-	uint16_t fillLeftX = minX + 1;
-	uint16_t fillTopY = minY + 1;
-
-	uint16_t fillRightX = maxVisibleX; /* Initially think that right and bottom borders are off-screen*/
-	uint16_t fillBottomY = maxVisibleY;
-
 	/* Borders */
 	FMGL_API_SetActiveColor(context, borderColor);
-	FMGL_API_DrawLineHorizontal(context, minX, maxVisibleX, minY);
-	FMGL_API_DrawLineVertical(context, minX, minY, maxVisibleY);
-
-	if (maxX <= context->MaxX)
-	{
-		/*Right border is on screen so moving fill right bottom 1 pixel left*/
-		fillRightX -= 1;
-		FMGL_API_DrawLineVertical(context, maxVisibleX, minY, maxVisibleY);
-	}
-
-	if (maxY <= context->MaxY)
-	{
-		fillBottomY -= 1;
-		FMGL_API_DrawLineHorizontal(context, minX, maxVisibleX, maxVisibleY);
-	}
-
-	/* Fill */
-	if ((fillLeftX > context->MaxX) || (fillTopY > context->MaxY) || (fillRightX < fillLeftX) || (fillBottomY < fillTopY))
-	{
-		FMGL_API_SetActiveColor(context, activeColor);
-		return;
-	}
+	FMGL_API_DrawRectangle(context, minX, minY, maxX, maxY);
 
-	FMGL_API_SetActiveColor(context, fillColor);
-	for (uint16_t y = fillTopY; y <= fillBottomY; y++)
+	/* Fill, if there is space inside borders */
+	if (maxX - minX > 1 && maxY - minY > 1)
 	{
-		FMGL_API_DrawLineHorizontal(context, fillLeftX, fillRightX, y);
+		FMGL_API_SetActiveColor(context, fillColor);
+		FMGL_Priv_FillRect(context, minX + 1, minY + 1, maxX - 1, maxY - 1);
 	}
 
 	FMGL_API_SetActiveColor(context, activeColor);
@@ -345,9 +413,13 @@ void FMGL_API_FillScreen(FMGL_API_DriverContext* context, FMGL_API_ColorStruct c
 
 void FMGL_API_ClearScreen(FMGL_API_DriverContext* context)
 {
-	if (NULL != context->ClearFramebuffer)
+	bool isClipped = (0 != context->ClipRegion.X1 || 0 != context->ClipRegion.Y1
+		|| context->MaxX != context->ClipRegion.X2 || context->MaxY != context->ClipRegion.Y2);
+
+	if (NULL != context->ClearFramebuffer && !isClipped)
 	{
 		context->ClearFramebuffer(context->DeviceContext, context->BlankingColor);
+		FMGL_API_MarkRegionAsDirty(context, 0, 0, context->MaxX, context->MaxY);
 	}
 	else
 	{
@@ -356,74 +428,249 @@ void FMGL_API_ClearScreen(FMGL_API_DriverContext* context)
 
 }
 
-void FMGL_API_RenderOneLineDumb(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t* width,
-		bool isDryRun, char* string)
+uint32_t FMGL_API_DecodeUTF8Character(const char* string, uint8_t* length)
 {
-	uint16_t scaledCharactersSpacing = fontSettings->CharactersSpacing * fontSettings->Scale;
-	uint16_t currentX = x;
+	const uint8_t* bytes = (const uint8_t*)string;
 
-	char* currentChar = string;
+	*length = 1;
 
-	while (true)
+	uint32_t result;
+	uint8_t continuationsCount;
+	uint32_t minimalCodePoint;
+
+	if (bytes[0] < 0x80)
 	{
-		if ('\0' == *currentChar)
-		{
-			/* End of line */
-			return;
-		}
-		else if ('\n' == *currentChar)
-		{
-			/* Newline is not allowed */
-			L2HAL_Error(WrongArgument);
-		}
+		return bytes[0];
+	}
+	else if (0xC0 == (bytes[0] & 0xE0))
+	{
+		result = bytes[0] & 0x1F;
+		continuationsCount = 1;
+		minimalCodePoint = 0x80;
+	}
+	else if (0xE0 == (bytes[0] & 0xF0))
+	{
+		result = bytes[0] & 0x0F;
+		continuationsCount = 2;
+		minimalCodePoint = 0x800;
+	}
+	else if (0xF0 == (bytes[0] & 0xF8))
+	{
+		result = bytes[0] & 0x07;
+		continuationsCount = 3;
+		minimalCodePoint = 0x10000;
+	}
+	else
+	{
+		/* Unexpected continuation byte or invalid lead byte */
+		return FMGL_API_INVALID_CHARACTER;
+	}
 
-		/* Could we draw current pixel? */
-		if (currentX > context->MaxX)
+	for (uint8_t i = 1; i <= continuationsCount; i++)
+	{
+		if (0x80 != (bytes[i] & 0xC0))
 		{
-			/* No */
-			return;
+			/* Truncated sequence, string terminator is never a continuation byte */
+			return FMGL_API_INVALID_CHARACTER;
 		}
 
-		/* Drawing */
-		if (!isDryRun)
-		{
-			FMGL_Priv_RenderCharacter(context, fontSettings, currentX, y, *currentChar);
-		}
+		result = (result << 6) | (bytes[i] & 0x3F);
+	}
 
-		currentX += fontSettings->Font->GetCharacterWidth(fontSettings->Font->Context, *currentChar) * fontSettings->Scale;
-		*width = currentX - x - 1;
+	*length = continuationsCount + 1;
 
-		/* Adding intercharacter spacing */
-		currentX += scaledCharactersSpacing;
+	/* Overlong encodings, surrogates and out of range values */
+	if (result < minimalCodePoint || result > FMGL_PRIV_MAX_CODE_POINT || (result >= 0xD800 && result <= 0xDFFF))
+	{
+		return FMGL_API_INVALID_CHARACTER;
+	}
 
-		currentChar ++;
+	return result;
+}
+
+void FMGL_API_RenderOneLineDumb(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t* width,
+		bool isDryRun, char* string)
+{
+	size_t length = strcspn(string, "\n");
+
+	if ('\n' == string[length])
+	{
+		/* Newline is not allowed */
+		L2HAL_Error(WrongArgument);
 	}
+
+	FMGL_Priv_RenderLine(context, fontSettings, x, y, width, isDryRun, string, length);
+}
+
+void FMGL_API_MeasureText(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, const char* string, uint16_t* width, uint16_t* height)
+{
+	FMGL_API_TextLayoutStruct* layout = FMGL_Priv_GetTextLayout(context, fontSettings, string);
+
+	*width = layout->Width;
+	*height = layout->Height;
 }
 
 void FMGL_API_RenderTextWithLineBreaks(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t* width, uint16_t* height,
 		bool isDryRun, char* string)
 {
-	*width = 0;
-	*height = y;
+	FMGL_API_RenderTextAligned(context, fontSettings, x, y, FMGL_TextAlignmentLeft, width, height, isDryRun, string);
+}
+
+void FMGL_API_RenderTextAligned(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y,
+		FMGL_API_TextAlignment alignment, uint16_t* width, uint16_t* height, bool isDryRun, const char* string)
+{
+	FMGL_API_TextLayoutStruct* layout = FMGL_Priv_GetTextLayout(context, fontSettings, string);
+
+	*width = layout->Width;
+	*height = layout->Height;
+
+	if (isDryRun)
+	{
+		return;
+	}
 
-	size_t length = strlen(string);
+	FMGL_Priv_RenderTextLayout(context, fontSettings, x, y, alignment, layout, string);
+}
 
+void FMGL_API_RenderTextWrapped(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t maxWidth,
+		FMGL_API_TextAlignment alignment, uint16_t* width, uint16_t* height, bool isDryRun, const char* string)
+{
 	uint16_t scaledLineHeight = (fontSettings->Font->Height + fontSettings->LinesSpacing) * fontSettings->Scale;
 
-	/* Scanning string for newlines */
-	uint16_t startPos = 0;
-	for (uint16_t pos = 0; pos < length; pos ++)
+	*width = 0;
+	*height = 0;
+
+	/* Current line: starts at lineStart, visible part ends at lineEnd (trailing spaces are not included) */
+	const char* lineStart = string;
+	const char* lineEnd = string;
+	int32_t lineEndX = 0;
+
+	/* Pen position after last character (spaces included) */
+	int32_t currentX = 0;
+	uint32_t previousCharacter = FMGL_PRIV_NO_CHARACTER;
+
+	/* Last break opportunity: line may end at breakEnd, then next line starts at breakResume */
+	const char* breakEnd = NULL;
+	int32_t breakEndX = 0;
+	const char* breakResume = NULL;
+	int32_t breakResumeX = 0;
+	bool isInBreakSpaces = false;
+
+	const char* currentChar = string;
+
+	while (true)
 	{
-		if ('\n' == string[pos])
+		if ('\0' == *currentChar || '\n' == *currentChar)
 		{
-			FMGL_Priv_RenderSubstring(context, fontSettings, startPos, pos - startPos, x, &y, scaledLineHeight, width, isDryRun, string);
-			startPos = pos + 1; /* +1 To move after newline */
+			FMGL_Priv_RenderWrappedLine(context, fontSettings, x, y, maxWidth, alignment, isDryRun, lineStart, lineEnd - lineStart, lineEndX);
+
+			*width = MAX(*width, MAX(lineEndX, 1) - 1);
+			*height += scaledLineHeight;
+			y += scaledLineHeight;
+
+			if ('\0' == *currentChar)
+			{
+				return;
+			}
+
+			currentChar ++;
+
+			lineStart = currentChar;
+			lineEnd = currentChar;
+			lineEndX = 0;
+			currentX = 0;
+			previousCharacter = FMGL_PRIV_NO_CHARACTER;
+			breakEnd = NULL;
+			isInBreakSpaces = false;
+
+			continue;
 		}
-	}
 
-	FMGL_Priv_RenderSubstring(context, fontSettings, startPos, length - startPos, x, &y, scaledLineHeight, width, isDryRun, string);
+		uint8_t characterLength;
+		uint32_t character = FMGL_API_DecodeUTF8Character(currentChar, &characterLength);
 
-	*height = y - *height;
+		int32_t characterX = MAX(0, currentX + FMGL_Priv_GetCharactersDistance(fontSettings, previousCharacter, character));
+		int32_t characterEndX = characterX + fontSettings->Font->GetCharacterWidth(fontSettings->Font->Context, character) * fontSettings->Scale;
+
+		if (' ' == character)
+		{
+			/* Line could be broken before spaces, but not before leading ones */
+			if (!isInBreakSpaces && lineEnd > lineStart)
+			{
+				breakEnd = lineEnd;
+				breakEndX = lineEndX;
+				isInBreakSpaces = true;
+			}
+
+			currentX = characterEndX;
+			previousCharacter = character;
+			currentChar += characterLength;
+
+			continue;
+		}
+
+		if (isInBreakSpaces)
+		{
+			/* Word after spaces */
+			breakResume = currentChar;
+			breakResumeX = characterX;
+			isInBreakSpaces = false;
+		}
+
+		if (characterEndX <= maxWidth || lineEnd == lineStart)
+		{
+			/* Character fits (or line is empty, then character is put there anyway) */
+			currentX = characterEndX;
+			lineEnd = currentChar + characterLength;
+			lineEndX = characterEndX;
+			previousCharacter = character;
+			currentChar += characterLength;
+
+			continue;
+		}
+
+		/* Character doesn't fit, wrapping */
+		if (NULL != breakEnd)
+		{
+			FMGL_Priv_RenderWrappedLine(context, fontSettings, x, y, maxWidth, alignment, isDryRun, lineStart, breakEnd - lineStart, breakEndX);
+			*width = MAX(*width, MAX(breakEndX, 1) - 1);
+
+			/* Already measured part of current word moves to the new line */
+			lineStart = breakResume;
+
+			if (breakResume == currentChar)
+			{
+				lineEnd = currentChar;
+				lineEndX = 0;
+				currentX = 0;
+				previousCharacter = FMGL_PRIV_NO_CHARACTER;
+			}
+			else
+			{
+				lineEndX -= breakResumeX;
+				currentX -= breakResumeX;
+			}
+
+			breakEnd = NULL;
+		}
+		else
+		{
+			/* Word is wider than budget, breaking it before current character */
+			FMGL_Priv_RenderWrappedLine(context, fontSettings, x, y, maxWidth, alignment, isDryRun, lineStart, lineEnd - lineStart, lineEndX);
+			*width = MAX(*width, MAX(lineEndX, 1) - 1);
+
+			lineStart = currentChar;
+			lineEnd = currentChar;
+			lineEndX = 0;
+			currentX = 0;
+			previousCharacter = FMGL_PRIV_NO_CHARACTER;
+		}
+
+		*height += scaledLineHeight;
+		y += scaledLineHeight;
+
+		/* Current character will be processed again, now in new line */
+	}
 }
 
 void FMGL_API_DrawCircle(FMGL_API_DriverContext* context, uint16_t centerX, uint16_t centerY, uint16_t radius)
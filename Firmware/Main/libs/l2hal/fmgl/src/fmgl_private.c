@@ -26,8 +26,8 @@
  */
 
 #include "../include/fmgl_private.h"
+#include "../../include/l2hal_aux.h"
 #include "../../include/l2hal_errors.h"
-#include <stdlib.h>
 
 bool FMGL_Priv_IsActiveXBMPixel(FMGL_API_XBMImage* image, uint16_t x, uint16_t y)
 {
@@ -43,7 +43,7 @@ bool FMGL_Priv_IsActiveXBMPixel(FMGL_API_XBMImage* image, uint16_t x, uint16_t y
 	}
 
 	uint32_t index = y * bytesPerRow + x / FMGL_PRIV_BITS_PER_BYTE;
-	uint8_t mask = (1 << (x % FMGL_PRIV_BITS_PER_BYTE));
+	uint8_t mask = image->IsMSBFirst ? (0x80 >> (x % FMGL_PRIV_BITS_PER_BYTE)) : (1 << (x % FMGL_PRIV_BITS_PER_BYTE));
 
 	if (0 != (image->Raster[index] & mask))
 	{
@@ -55,41 +55,484 @@ bool FMGL_Priv_IsActiveXBMPixel(FMGL_API_XBMImage* image, uint16_t x, uint16_t y
 	}
 }
 
-void FMGL_Priv_RenderCharacter(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, char character)
+void FMGL_Priv_AddDirtyRegion(FMGL_API_DriverContext* context, FMGL_API_RegionStruct region)
+{
+	/* Already dirty? */
+	for (uint8_t i = 0; i < context->DirtyRegionsCount; i++)
+	{
+		FMGL_API_RegionStruct* dirtyRegion = &context->DirtyRegions[i];
+
+		if (region.X1 >= dirtyRegion->X1 && region.X2 <= dirtyRegion->X2 && region.Y1 >= dirtyRegion->Y1 && region.Y2 <= dirtyRegion->Y2)
+		{
+			return;
+		}
+	}
+
+	/* Absorbing touching regions, grown region may touch next ones */
+	uint8_t i = 0;
+	while (i < context->DirtyRegionsCount)
+	{
+		if (FMGL_Priv_IsRegionsTouching(context->DirtyRegions[i], region))
+		{
+			region = FMGL_Priv_GetRegionsUnion(context->DirtyRegions[i], region);
+
+			context->DirtyRegionsCount --;
+			context->DirtyRegions[i] = context->DirtyRegions[context->DirtyRegionsCount];
+
+			i = 0;
+			continue;
+		}
+
+		i++;
+	}
+
+	if (context->DirtyRegionsCount < FMGL_API_MAX_DIRTY_REGIONS)
+	{
+		context->DirtyRegions[context->DirtyRegionsCount] = region;
+		context->DirtyRegionsCount ++;
+		return;
+	}
+
+	/* No free space, merging with region, which grows least */
+	uint8_t bestIndex = 0;
+	uint32_t bestGrowth = UINT32_MAX;
+
+	for (i = 0; i < context->DirtyRegionsCount; i++)
+	{
+		uint32_t growth = FMGL_Priv_GetRegionArea(FMGL_Priv_GetRegionsUnion(context->DirtyRegions[i], region))
+				- FMGL_Priv_GetRegionArea(context->DirtyRegions[i]);
+
+		if (growth < bestGrowth)
+		{
+			bestGrowth = growth;
+			bestIndex = i;
+		}
+	}
+
+	region = FMGL_Priv_GetRegionsUnion(context->DirtyRegions[bestIndex], region);
+
+	context->DirtyRegionsCount --;
+	context->DirtyRegions[bestIndex] = context->DirtyRegions[context->DirtyRegionsCount];
+
+	/* There is free space now */
+	FMGL_Priv_AddDirtyRegion(context, region);
+}
+
+bool FMGL_Priv_IsRegionsTouching(FMGL_API_RegionStruct region1, FMGL_API_RegionStruct region2)
+{
+	return (region1.X1 <= region2.X2 + 1) && (region2.X1 <= region1.X2 + 1)
+			&& (region1.Y1 <= region2.Y2 + 1) && (region2.Y1 <= region1.Y2 + 1);
+}
+
+FMGL_API_RegionStruct FMGL_Priv_GetRegionsUnion(FMGL_API_RegionStruct region1, FMGL_API_RegionStruct region2)
+{
+	FMGL_API_RegionStruct result;
+	result.X1 = MIN(region1.X1, region2.X1);
+	result.Y1 = MIN(region1.Y1, region2.Y1);
+	result.X2 = MAX(region1.X2, region2.X2);
+	result.Y2 = MAX(region1.Y2, region2.Y2);
+
+	return result;
+}
+
+uint32_t FMGL_Priv_GetRegionArea(FMGL_API_RegionStruct region)
+{
+	return (uint32_t)(region.X2 - region.X1 + 1) * (uint32_t)(region.Y2 - region.Y1 + 1);
+}
+
+void FMGL_Priv_FillRect(FMGL_API_DriverContext* context, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	x1 = MAX(x1, context->ClipRegion.X1);
+	y1 = MAX(y1, context->ClipRegion.Y1);
+	x2 = MIN(x2, context->ClipRegion.X2);
+	y2 = MIN(y2, context->ClipRegion.Y2);
+
+	if (x1 > x2 || y1 > y2)
+	{
+		/* Completely clipped */
+		return;
+	}
+
+	FMGL_API_RegionStruct region = { x1, y1, x2, y2 };
+	FMGL_Priv_AddDirtyRegion(context, region);
+
+	if (NULL != context->FillRect)
+	{
+		context->FillRect(context->DeviceContext, x1, y1, x2, y2);
+		return;
+	}
+
+	for (uint16_t y = y1; y <= y2; y++)
+	{
+		if (NULL != context->FillSpan)
+		{
+			context->FillSpan(context->DeviceContext, x1, x2, y);
+			continue;
+		}
+
+		for (uint16_t x = x1; x <= x2; x++)
+		{
+			context->DrawPixel(context->DeviceContext, x, y);
+		}
+	}
+}
+
+void FMGL_Priv_ScaleXBMRow(FMGL_API_XBMImage* image, uint16_t y, uint16_t scaleX, uint16_t offset, uint16_t width, uint8_t* buffer)
+{
+	uint16_t bytesPerRow = (image->Width + FMGL_PRIV_BITS_PER_BYTE - 1) / FMGL_PRIV_BITS_PER_BYTE;
+	const uint8_t* source = &image->Raster[y * bytesPerRow];
+
+	memset(buffer, 0x00, (width + FMGL_PRIV_BITS_PER_BYTE - 1) / FMGL_PRIV_BITS_PER_BYTE);
+
+	/* First source pixel could be partially skipped */
+	uint16_t skippedPixels = offset % scaleX;
+
+	uint16_t targetX = 0;
+	for (uint16_t x = offset / scaleX; targetX < width; x++)
+	{
+		uint8_t sourceMask = image->IsMSBFirst ? (0x80 >> (x % FMGL_PRIV_BITS_PER_BYTE)) : (1 << (x % FMGL_PRIV_BITS_PER_BYTE));
+		bool isActive = (0 != (source[x / FMGL_PRIV_BITS_PER_BYTE] & sourceMask));
+
+		uint16_t runEnd = MIN(targetX + scaleX - skippedPixels, width);
+		skippedPixels = 0;
+
+		if (!isActive)
+		{
+			targetX = runEnd;
+			continue;
+		}
+
+		/* Setting run of active pixels byte by byte */
+		while (targetX < runEnd)
+		{
+			uint8_t bitInByte = targetX % FMGL_PRIV_BITS_PER_BYTE;
+			uint8_t bitsCount = MIN(FMGL_PRIV_BITS_PER_BYTE - bitInByte, runEnd - targetX);
+
+			buffer[targetX / FMGL_PRIV_BITS_PER_BYTE] |= (uint8_t)((0xFF << (FMGL_PRIV_BITS_PER_BYTE - bitsCount)) & 0xFF) >> bitInByte;
+
+			targetX += bitsCount;
+		}
+	}
+}
+
+void FMGL_Priv_RenderCharacter(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint32_t character)
 {
 	/* Generating XBM image structure */
 	FMGL_API_XBMImage characterImage;
 	characterImage.Height = fontSettings->Font->Height;
-	characterImage.Width = fontSettings->Font->GetCharacterWidth(fontSettings->Font->Context, (uint8_t)character);
-	characterImage.Raster = fontSettings->Font->GetCharacterRaster(fontSettings->Font->Context, (uint8_t)character);
+	characterImage.Width = fontSettings->Font->GetCharacterWidth(fontSettings->Font->Context, character);
+	characterImage.Raster = fontSettings->Font->GetCharacterRaster(fontSettings->Font->Context, character);
+	characterImage.IsMSBFirst = fontSettings->Font->IsMSBFirst;
 
 	FMGL_API_RenderXBM(context, &characterImage, x, y, fontSettings->Scale, fontSettings->Scale, *fontSettings->FontColor, *fontSettings->BackgroundColor, *fontSettings->Transparency);
+}
+
+void FMGL_Priv_RenderLine(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t* width,
+		bool isDryRun, const char* string, uint16_t length)
+{
+	int32_t currentX = x;
+	uint32_t previousCharacter = FMGL_PRIV_NO_CHARACTER;
 
-	if (fontSettings->Font->IsLoadable)
+	const char* currentChar = string;
+	const char* end = string + length;
+
+	while (currentChar < end)
 	{
-		free(characterImage.Raster);
+		uint8_t characterLength;
+		uint32_t character = FMGL_API_DecodeUTF8Character(currentChar, &characterLength);
+
+		/* Adding intercharacter spacing and kerning, line never starts before x */
+		currentX = MAX(x, currentX + FMGL_Priv_GetCharactersDistance(fontSettings, previousCharacter, character));
+
+		/* Could we draw current pixel? */
+		if (currentX > context->ClipRegion.X2)
+		{
+			/* No */
+			return;
+		}
+
+		/* Drawing */
+		if (!isDryRun)
+		{
+			FMGL_Priv_RenderCharacter(context, fontSettings, (uint16_t)currentX, y, character);
+		}
+
+		currentX += fontSettings->Font->GetCharacterWidth(fontSettings->Font->Context, character) * fontSettings->Scale;
+		*width = currentX - x - 1;
+
+		previousCharacter = character;
+		currentChar += characterLength;
 	}
 }
 
-void FMGL_Priv_RenderSubstring(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t startPos, uint16_t length,
-		uint16_t x, uint16_t* y, uint16_t scaledLineHeight, uint16_t* width, bool isDryRun, char* string)
+uint16_t FMGL_Priv_MeasureLine(FMGL_API_FontSettings* fontSettings, const char* string, uint16_t length, FMGL_API_TextLayoutStruct* layout)
 {
-	if (length > FMGL_PRIV_MAX_SUBSTRING_LENGTH)
+	int32_t result = 0;
+	uint32_t previousCharacter = FMGL_PRIV_NO_CHARACTER;
+
+	const char* currentChar = string;
+	const char* end = string + length;
+
+	while (currentChar < end)
+	{
+		uint8_t characterLength;
+		uint32_t character = FMGL_API_DecodeUTF8Character(currentChar, &characterLength);
+
+		result = MAX(0, result + FMGL_Priv_GetCharactersDistance(fontSettings, previousCharacter, character));
+
+		if (NULL != layout)
+		{
+			layout->Characters[layout->CharactersCount] = character;
+			layout->CharactersX[layout->CharactersCount] = (uint16_t)result;
+			layout->CharactersCount ++;
+		}
+
+		result += fontSettings->Font->GetCharacterWidth(fontSettings->Font->Context, character) * fontSettings->Scale;
+
+		previousCharacter = character;
+		currentChar += characterLength;
+	}
+
+	if (0 == result)
 	{
-		L2HAL_Error(Generic);
+		return 0;
 	}
 
-	char substr[FMGL_PRIV_MAX_SUBSTRING_LENGTH + 1];
-	memcpy(substr, string + startPos, length);
-	substr[length] = '\0';
+	/* Width is counted the same way as in FMGL_Priv_RenderLine() */
+	return (uint16_t)(result - 1);
+}
 
-	uint16_t currWidth = 0;
-	FMGL_API_RenderOneLineDumb(context, fontSettings, x, *y, &currWidth, isDryRun, substr);
+void FMGL_Priv_RenderLayoutLine(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y,
+		FMGL_API_TextLayoutStruct* layout, uint16_t line)
+{
+	uint16_t end = (line + 1 < layout->LinesCount) ? layout->LinesFirstCharacters[line + 1] : layout->CharactersCount;
 
-	if (currWidth > *width)
+	/* 32-bit index: GCC 12.2 at -O1 and higher drops calls of this function when index is 16-bit */
+	for (uint32_t i = layout->LinesFirstCharacters[line]; i < end; i ++)
 	{
-		*width = currWidth;
+		uint32_t characterX = (uint32_t)x + layout->CharactersX[i];
+
+		/* The same clipping as in FMGL_Priv_RenderLine() */
+		if (characterX > context->ClipRegion.X2)
+		{
+			return;
+		}
+
+		FMGL_Priv_RenderCharacter(context, fontSettings, (uint16_t)characterX, y, layout->Characters[i]);
+	}
+}
+
+uint16_t FMGL_Priv_GetAlignmentOffset(FMGL_API_TextAlignment alignment, uint16_t lineWidth, uint16_t maxWidth)
+{
+	if (lineWidth >= maxWidth)
+	{
+		return 0;
+	}
+
+	switch (alignment)
+	{
+		case FMGL_TextAlignmentLeft:
+			return 0;
+
+		case FMGL_TextAlignmentCenter:
+			return (maxWidth - lineWidth) / 2;
+
+		case FMGL_TextAlignmentRight:
+			return maxWidth - lineWidth;
+
+		default:
+			L2HAL_Error(WrongArgument);
+	}
+
+	return 0;
+}
+
+int32_t FMGL_Priv_GetCharactersDistance(FMGL_API_FontSettings* fontSettings, uint32_t left, uint32_t right)
+{
+	if (FMGL_PRIV_NO_CHARACTER == left)
+	{
+		/* First character of line */
+		return 0;
+	}
+
+	int32_t distance = fontSettings->CharactersSpacing;
+
+	if (NULL != fontSettings->Font->GetKerning)
+	{
+		distance += fontSettings->Font->GetKerning(fontSettings->Font->Context, left, right);
+	}
+
+	return distance * fontSettings->Scale;
+}
+
+void FMGL_Priv_RenderWrappedLine(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y, uint16_t maxWidth,
+		FMGL_API_TextAlignment alignment, bool isDryRun, const char* string, uint16_t length, uint16_t lineWidth)
+{
+	if (isDryRun || 0 == length)
+	{
+		return;
+	}
+
+	uint16_t offset = FMGL_Priv_GetAlignmentOffset(alignment, lineWidth, maxWidth);
+
+	uint16_t renderedWidth;
+	FMGL_Priv_RenderLine(context, fontSettings, x + offset, y, &renderedWidth, false, string, length);
+}
+
+uint32_t FMGL_Priv_HashString(const char* string, uint16_t* length)
+{
+	uint32_t hash = 0x811C9DC5; /* FNV-1a offset basis */
+	const char* currentChar = string;
+
+	while ('\0' != *currentChar)
+	{
+		hash ^= (uint8_t)*currentChar;
+		hash *= 0x01000193; /* FNV-1a prime */
+
+		currentChar ++;
 	}
 
-	*y += scaledLineHeight;
+	*length = currentChar - string;
+
+	return hash;
+}
+
+void FMGL_Priv_RenderTextLayout(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, uint16_t x, uint16_t y,
+		FMGL_API_TextAlignment alignment, FMGL_API_TextLayoutStruct* layout, const char* string)
+{
+	uint16_t scaledLineHeight = (fontSettings->Font->Height + fontSettings->LinesSpacing) * fontSettings->Scale;
+	uint16_t lineWidth = 0;
+
+	if (layout->LinesCount <= FMGL_API_TEXT_LAYOUT_MAX_LINES)
+	{
+		for (uint16_t line = 0; line < layout->LinesCount; line ++)
+		{
+			uint16_t lineX = x + FMGL_Priv_GetAlignmentOffset(alignment, layout->LinesWidths[line], layout->Width);
+
+			if (layout->IsValid)
+			{
+				FMGL_Priv_RenderLayoutLine(context, fontSettings, lineX, y, layout, line);
+			}
+			else
+			{
+				FMGL_Priv_RenderLine(context, fontSettings, lineX, y, &lineWidth, false, string + layout->LinesOffsets[line],
+						layout->LinesLengths[line]);
+			}
+
+			y += scaledLineHeight;
+		}
+
+		return;
+	}
+
+	/* Too many lines to keep them in layout, scanning string for newlines */
+	uint16_t startPos = 0;
+	for (uint16_t pos = 0; pos <= layout->TextLength; pos ++)
+	{
+		if (pos == layout->TextLength || '\n' == string[pos])
+		{
+			uint16_t lineX = x;
+
+			if (FMGL_TextAlignmentLeft != alignment)
+			{
+				lineWidth = FMGL_Priv_MeasureLine(fontSettings, string + startPos, pos - startPos, NULL);
+				lineX += FMGL_Priv_GetAlignmentOffset(alignment, lineWidth, layout->Width);
+			}
+
+			FMGL_Priv_RenderLine(context, fontSettings, lineX, y, &lineWidth, false, string + startPos, pos - startPos);
+			y += scaledLineHeight;
+			startPos = pos + 1; /* +1 To move after newline */
+		}
+	}
+}
+
+FMGL_API_TextLayoutStruct* FMGL_Priv_GetTextLayout(FMGL_API_DriverContext* context, FMGL_API_FontSettings* fontSettings, const char* string)
+{
+	uint16_t length;
+	uint32_t hash = FMGL_Priv_HashString(string, &length);
+
+	for (uint8_t i = 0; i < FMGL_API_TEXT_LAYOUT_CACHE_SIZE; i ++)
+	{
+		FMGL_API_TextLayoutStruct* layout = &context->TextLayoutCache[i];
+
+		if (layout->IsValid
+			&& layout->Font == fontSettings->Font
+			&& layout->Scale == fontSettings->Scale
+			&& layout->CharactersSpacing == fontSettings->CharactersSpacing
+			&& layout->LinesSpacing == fontSettings->LinesSpacing
+			&& layout->TextHash == hash
+			&& layout->TextLength == length
+			&& 0 == memcmp(layout->Text, string, length))
+		{
+			return layout;
+		}
+	}
+
+	/* Not found, measuring into oldest entry */
+	FMGL_API_TextLayoutStruct* layout = &context->TextLayoutCache[context->TextLayoutCacheNextEntry];
+	context->TextLayoutCacheNextEntry = (context->TextLayoutCacheNextEntry + 1) % FMGL_API_TEXT_LAYOUT_CACHE_SIZE;
+
+	/* Each character takes at least one byte, so characters of cached text always fit into layout */
+	bool isCached = (length <= FMGL_API_TEXT_LAYOUT_MAX_LENGTH);
+
+	layout->Font = fontSettings->Font;
+	layout->Scale = fontSettings->Scale;
+	layout->CharactersSpacing = fontSettings->CharactersSpacing;
+	layout->LinesSpacing = fontSettings->LinesSpacing;
+	layout->TextHash = hash;
+	layout->TextLength = length;
+
+	layout->Width = 0;
+	layout->LinesCount = 0;
+	layout->CharactersCount = 0;
+
+	uint16_t lineStart = 0;
+	for (uint16_t pos = 0; pos <= length; pos ++)
+	{
+		if (pos < length && '\n' != string[pos])
+		{
+			continue;
+		}
+
+		/* Line end */
+		uint16_t lineLength = pos - lineStart;
+		bool isLineStored = (layout->LinesCount < FMGL_API_TEXT_LAYOUT_MAX_LINES);
+
+		if (isLineStored)
+		{
+			layout->LinesOffsets[layout->LinesCount] = lineStart;
+			layout->LinesLengths[layout->LinesCount] = lineLength;
+			layout->LinesFirstCharacters[layout->LinesCount] = layout->CharactersCount;
+		}
+		else
+		{
+			isCached = false;
+		}
+
+		uint16_t lineWidth = FMGL_Priv_MeasureLine(fontSettings, string + lineStart, lineLength, isCached ? layout : NULL);
+
+		if (isLineStored)
+		{
+			layout->LinesWidths[layout->LinesCount] = lineWidth;
+		}
+
+		if (lineWidth > layout->Width)
+		{
+			layout->Width = lineWidth;
+		}
+
+		layout->LinesCount ++;
+		lineStart = pos + 1; /* +1 To move after newline */
+	}
+
+	layout->Height = layout->LinesCount * (fontSettings->Font->Height + fontSettings->LinesSpacing) * fontSettings->Scale;
+
+	if (isCached)
+	{
+		memcpy(layout->Text, string, length);
+	}
+
+	layout->IsValid = isCached;
+
+	return layout;
 }
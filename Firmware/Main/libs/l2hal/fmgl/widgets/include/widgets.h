@@ -0,0 +1,278 @@
+/*
+ * widgets.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#ifndef FMGL_WIDGETS_INCLUDE_WIDGETS_H_
+#define FMGL_WIDGETS_INCLUDE_WIDGETS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../include/fmgl.h"
+
+/**
+ * Maximal widget text length (remember that null-termination is a character too)
+ */
+#ifndef FMGL_WIDGETS_MAX_TEXT_LENGTH
+	#define FMGL_WIDGETS_MAX_TEXT_LENGTH 32U
+#endif
+
+/**
+ * Maximal value format length (remember that null-termination is a character too)
+ */
+#ifndef FMGL_WIDGETS_MAX_FORMAT_LENGTH
+	#define FMGL_WIDGETS_MAX_FORMAT_LENGTH 16U
+#endif
+
+/**
+ * How many points chart keeps
+ */
+#ifndef FMGL_WIDGETS_CHART_MAX_POINTS
+	#define FMGL_WIDGETS_CHART_MAX_POINTS 64U
+#endif
+
+/**
+ * How many widgets could be added to one screen
+ */
+#ifndef FMGL_WIDGETS_MAX_WIDGETS_PER_SCREEN
+	#define FMGL_WIDGETS_MAX_WIDGETS_PER_SCREEN 16U
+#endif
+
+/**
+ * Widget types
+ */
+typedef enum
+{
+	FMGL_Widgets_Label, /** Static (rarely changing) text */
+	FMGL_Widgets_Value, /** Number, formatted by printf-like format */
+	FMGL_Widgets_Icon, /** XBM image */
+	FMGL_Widgets_Chart /** Plot of last FMGL_WIDGETS_CHART_MAX_POINTS values */
+}
+FMGL_Widgets_WidgetType;
+
+/**
+ * Text (label or value) widget data
+ */
+typedef struct
+{
+	/**
+	 * Font settings
+	 */
+	FMGL_API_FontSettings* FontSettings;
+
+	/**
+	 * Currently displayed text
+	 */
+	char Text[FMGL_WIDGETS_MAX_TEXT_LENGTH];
+
+	/**
+	 * Format for value (must contain exactly one floating point conversion, like "%.1f%%")
+	 */
+	char Format[FMGL_WIDGETS_MAX_FORMAT_LENGTH];
+}
+FMGL_Widgets_TextDataStruct;
+
+/**
+ * Icon widget data
+ */
+typedef struct
+{
+	/**
+	 * Currently displayed image
+	 */
+	FMGL_API_XBMImage* Image;
+
+	/**
+	 * Image active color
+	 */
+	FMGL_API_ColorStruct ActiveColor;
+}
+FMGL_Widgets_IconDataStruct;
+
+/**
+ * Chart widget data
+ */
+typedef struct
+{
+	/**
+	 * Value, drawn at chart bottom
+	 */
+	float MinValue;
+
+	/**
+	 * Value, drawn at chart top
+	 */
+	float MaxValue;
+
+	/**
+	 * Line color
+	 */
+	FMGL_API_ColorStruct LineColor;
+
+	/**
+	 * Points as distances from chart bottom (in pixels), oldest point first
+	 */
+	uint16_t Points[FMGL_WIDGETS_CHART_MAX_POINTS];
+
+	/**
+	 * How many points we have
+	 */
+	uint16_t PointsCount;
+}
+FMGL_Widgets_ChartDataStruct;
+
+/**
+ * Widget
+ */
+typedef struct
+{
+	/**
+	 * Widget type
+	 */
+	FMGL_Widgets_WidgetType Type;
+
+	/**
+	 * Top left corner X
+	 */
+	uint16_t X;
+
+	/**
+	 * Top left corner Y
+	 */
+	uint16_t Y;
+
+	/**
+	 * Widget width, widget never draws outside of its bounds
+	 */
+	uint16_t Width;
+
+	/**
+	 * Widget height
+	 */
+	uint16_t Height;
+
+	/**
+	 * If true, widget will be redrawn at next FMGL_Widgets_Render() call
+	 */
+	bool IsInvalidated;
+
+	/**
+	 * Type-specific data
+	 */
+	union
+	{
+		FMGL_Widgets_TextDataStruct Text;
+		FMGL_Widgets_IconDataStruct Icon;
+		FMGL_Widgets_ChartDataStruct Chart;
+	}
+	Data;
+}
+FMGL_Widgets_WidgetStruct;
+
+/**
+ * Screen - set of widgets, drawn on common background
+ */
+typedef struct
+{
+	/**
+	 * Screen uses this FMGL context
+	 */
+	FMGL_API_DriverContext* FmglContext;
+
+	/**
+	 * Widgets background color
+	 */
+	FMGL_API_ColorStruct BackgroundColor;
+
+	/**
+	 * Widgets (they are owned by caller)
+	 */
+	FMGL_Widgets_WidgetStruct* Widgets[FMGL_WIDGETS_MAX_WIDGETS_PER_SCREEN];
+
+	/**
+	 * Widgets count
+	 */
+	uint8_t WidgetsCount;
+}
+FMGL_Widgets_ScreenStruct;
+
+/**
+ * Initialize screen
+ */
+FMGL_Widgets_ScreenStruct FMGL_Widgets_InitScreen(FMGL_API_DriverContext* fmglContext, FMGL_API_ColorStruct backgroundColor);
+
+/**
+ * Add widget to screen. Widget will be drawn at next FMGL_Widgets_Render() call
+ */
+void FMGL_Widgets_AddWidget(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget);
+
+/**
+ * Create label
+ */
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateLabel(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		FMGL_API_FontSettings* fontSettings, const char* text);
+
+/**
+ * Create value. Value is empty till first FMGL_Widgets_SetValue() call
+ */
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateValue(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		FMGL_API_FontSettings* fontSettings, const char* format);
+
+/**
+ * Create icon. Image could be NULL, then icon is empty
+ */
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateIcon(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		FMGL_API_XBMImage* image, FMGL_API_ColorStruct activeColor);
+
+/**
+ * Create chart. Values outside of [minValue; maxValue] are clamped
+ */
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateChart(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		float minValue, float maxValue, FMGL_API_ColorStruct lineColor);
+
+/**
+ * Set label or value text. Widget is invalidated only if text is changed, returns true in this case
+ */
+bool FMGL_Widgets_SetText(FMGL_Widgets_WidgetStruct* widget, const char* text);
+
+/**
+ * Format and set value. Widget is invalidated only if formatted text is changed, returns true in this case
+ */
+bool FMGL_Widgets_SetValue(FMGL_Widgets_WidgetStruct* widget, float value);
+
+/**
+ * Set icon image. Widget is invalidated only if image is changed, returns true in this case
+ */
+bool FMGL_Widgets_SetIcon(FMGL_Widgets_WidgetStruct* widget, FMGL_API_XBMImage* image);
+
+/**
+ * Add point to chart, dropping oldest one if chart is full. Widget is invalidated only if chart is changed,
+ * returns true in this case
+ */
+bool FMGL_Widgets_AddChartPoint(FMGL_Widgets_WidgetStruct* widget, float value);
+
+/**
+ * Force widget redraw
+ */
+void FMGL_Widgets_Invalidate(FMGL_Widgets_WidgetStruct* widget);
+
+/**
+ * Force redraw of all screen widgets
+ */
+void FMGL_Widgets_InvalidateScreen(FMGL_Widgets_ScreenStruct* screen);
+
+/**
+ * Redraw invalidated widgets into framebuffer. Returns true if at least one widget was redrawn
+ */
+bool FMGL_Widgets_Render(FMGL_Widgets_ScreenStruct* screen);
+
+/**
+ * Redraw invalidated widgets and push changed regions to display. Display isn't touched if nothing
+ * was changed. Returns true if display was updated
+ */
+bool FMGL_Widgets_Update(FMGL_Widgets_ScreenStruct* screen);
+
+
+#endif /* FMGL_WIDGETS_INCLUDE_WIDGETS_H_ */
@@ -0,0 +1,39 @@
+/*
+ * widgets_private.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#ifndef FMGL_WIDGETS_INCLUDE_WIDGETS_PRIVATE_H_
+#define FMGL_WIDGETS_INCLUDE_WIDGETS_PRIVATE_H_
+
+#include "widgets.h"
+
+/**
+ * Create widget of given type with given bounds, type-specific data is zeroed
+ */
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateWidget(FMGL_Widgets_WidgetType type, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
+/**
+ * Clear widget bounds and draw widget
+ */
+void FMGL_Widgets_DrawWidget(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget);
+
+/**
+ * Draw label or value
+ */
+void FMGL_Widgets_DrawText(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget);
+
+/**
+ * Draw icon
+ */
+void FMGL_Widgets_DrawIcon(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget);
+
+/**
+ * Draw chart
+ */
+void FMGL_Widgets_DrawChart(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget);
+
+
+#endif /* FMGL_WIDGETS_INCLUDE_WIDGETS_PRIVATE_H_ */
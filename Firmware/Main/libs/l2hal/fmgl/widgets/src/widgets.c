@@ -0,0 +1,347 @@
+/*
+ * widgets.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include "../include/widgets.h"
+#include "../include/widgets_private.h"
+#include "../../../include/l2hal_errors.h"
+#include "../../../include/l2hal_aux.h"
+#include <string.h>
+#include <stdio.h>
+
+FMGL_Widgets_ScreenStruct FMGL_Widgets_InitScreen(FMGL_API_DriverContext* fmglContext, FMGL_API_ColorStruct backgroundColor)
+{
+	FMGL_Widgets_ScreenStruct screen;
+
+	screen.FmglContext = fmglContext;
+	screen.BackgroundColor = backgroundColor;
+	screen.WidgetsCount = 0;
+
+	return screen;
+}
+
+void FMGL_Widgets_AddWidget(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget)
+{
+	if (screen->WidgetsCount >= FMGL_WIDGETS_MAX_WIDGETS_PER_SCREEN)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	screen->Widgets[screen->WidgetsCount] = widget;
+	screen->WidgetsCount ++;
+
+	FMGL_Widgets_Invalidate(widget);
+}
+
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateLabel(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		FMGL_API_FontSettings* fontSettings, const char* text)
+{
+	FMGL_Widgets_WidgetStruct widget = FMGL_Widgets_CreateWidget(FMGL_Widgets_Label, x, y, width, height);
+
+	widget.Data.Text.FontSettings = fontSettings;
+	FMGL_Widgets_SetText(&widget, text);
+
+	return widget;
+}
+
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateValue(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		FMGL_API_FontSettings* fontSettings, const char* format)
+{
+	if (strlen(format) >= FMGL_WIDGETS_MAX_FORMAT_LENGTH)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	FMGL_Widgets_WidgetStruct widget = FMGL_Widgets_CreateWidget(FMGL_Widgets_Value, x, y, width, height);
+
+	widget.Data.Text.FontSettings = fontSettings;
+	strcpy(widget.Data.Text.Format, format);
+
+	return widget;
+}
+
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateIcon(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		FMGL_API_XBMImage* image, FMGL_API_ColorStruct activeColor)
+{
+	FMGL_Widgets_WidgetStruct widget = FMGL_Widgets_CreateWidget(FMGL_Widgets_Icon, x, y, width, height);
+
+	widget.Data.Icon.Image = image;
+	widget.Data.Icon.ActiveColor = activeColor;
+
+	return widget;
+}
+
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateChart(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		float minValue, float maxValue, FMGL_API_ColorStruct lineColor)
+{
+	if (minValue >= maxValue)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	FMGL_Widgets_WidgetStruct widget = FMGL_Widgets_CreateWidget(FMGL_Widgets_Chart, x, y, width, height);
+
+	widget.Data.Chart.MinValue = minValue;
+	widget.Data.Chart.MaxValue = maxValue;
+	widget.Data.Chart.LineColor = lineColor;
+
+	return widget;
+}
+
+bool FMGL_Widgets_SetText(FMGL_Widgets_WidgetStruct* widget, const char* text)
+{
+	if (FMGL_Widgets_Label != widget->Type && FMGL_Widgets_Value != widget->Type)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	/* Comparing only part, which fits into widget */
+	if (0 == strncmp(widget->Data.Text.Text, text, FMGL_WIDGETS_MAX_TEXT_LENGTH - 1))
+	{
+		return false;
+	}
+
+	strncpy(widget->Data.Text.Text, text, FMGL_WIDGETS_MAX_TEXT_LENGTH - 1);
+	widget->Data.Text.Text[FMGL_WIDGETS_MAX_TEXT_LENGTH - 1] = '\0';
+
+	FMGL_Widgets_Invalidate(widget);
+
+	return true;
+}
+
+bool FMGL_Widgets_SetValue(FMGL_Widgets_WidgetStruct* widget, float value)
+{
+	if (FMGL_Widgets_Value != widget->Type)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	char buffer[FMGL_WIDGETS_MAX_TEXT_LENGTH];
+	snprintf(buffer, FMGL_WIDGETS_MAX_TEXT_LENGTH, widget->Data.Text.Format, value);
+
+	return FMGL_Widgets_SetText(widget, buffer);
+}
+
+bool FMGL_Widgets_SetIcon(FMGL_Widgets_WidgetStruct* widget, FMGL_API_XBMImage* image)
+{
+	if (FMGL_Widgets_Icon != widget->Type)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	if (widget->Data.Icon.Image == image)
+	{
+		return false;
+	}
+
+	widget->Data.Icon.Image = image;
+
+	FMGL_Widgets_Invalidate(widget);
+
+	return true;
+}
+
+bool FMGL_Widgets_AddChartPoint(FMGL_Widgets_WidgetStruct* widget, float value)
+{
+	if (FMGL_Widgets_Chart != widget->Type)
+	{
+		L2HAL_Error(WrongOperation);
+	}
+
+	FMGL_Widgets_ChartDataStruct* chart = &widget->Data.Chart;
+
+	value = MAX(chart->MinValue, MIN(chart->MaxValue, value));
+	uint16_t point = (uint16_t)((value - chart->MinValue) * (widget->Height - 1) / (chart->MaxValue - chart->MinValue) + 0.5f);
+
+	if (chart->PointsCount < FMGL_WIDGETS_CHART_MAX_POINTS)
+	{
+		chart->Points[chart->PointsCount] = point;
+		chart->PointsCount ++;
+
+		FMGL_Widgets_Invalidate(widget);
+
+		return true;
+	}
+
+	/* Chart is full, it looks the same after scrolling only if all points are equal to new one */
+	bool isChanged = false;
+	for (uint16_t i = 0; i < FMGL_WIDGETS_CHART_MAX_POINTS; i++)
+	{
+		if (chart->Points[i] != point)
+		{
+			isChanged = true;
+			break;
+		}
+	}
+
+	if (!isChanged)
+	{
+		return false;
+	}
+
+	memmove(&chart->Points[0], &chart->Points[1], (FMGL_WIDGETS_CHART_MAX_POINTS - 1) * sizeof(uint16_t));
+	chart->Points[FMGL_WIDGETS_CHART_MAX_POINTS - 1] = point;
+
+	FMGL_Widgets_Invalidate(widget);
+
+	return true;
+}
+
+void FMGL_Widgets_Invalidate(FMGL_Widgets_WidgetStruct* widget)
+{
+	widget->IsInvalidated = true;
+}
+
+void FMGL_Widgets_InvalidateScreen(FMGL_Widgets_ScreenStruct* screen)
+{
+	for (uint8_t i = 0; i < screen->WidgetsCount; i++)
+	{
+		FMGL_Widgets_Invalidate(screen->Widgets[i]);
+	}
+}
+
+bool FMGL_Widgets_Render(FMGL_Widgets_ScreenStruct* screen)
+{
+	bool isRendered = false;
+
+	for (uint8_t i = 0; i < screen->WidgetsCount; i++)
+	{
+		FMGL_Widgets_WidgetStruct* widget = screen->Widgets[i];
+
+		if (!widget->IsInvalidated)
+		{
+			continue;
+		}
+
+		FMGL_Widgets_DrawWidget(screen, widget);
+
+		widget->IsInvalidated = false;
+		isRendered = true;
+	}
+
+	return isRendered;
+}
+
+bool FMGL_Widgets_Update(FMGL_Widgets_ScreenStruct* screen)
+{
+	if (!FMGL_Widgets_Render(screen))
+	{
+		return false;
+	}
+
+	/* Only regions, touched by redrawn widgets, are dirty */
+	FMGL_API_PushFramebuffer(screen->FmglContext);
+
+	return true;
+}
+
+FMGL_Widgets_WidgetStruct FMGL_Widgets_CreateWidget(FMGL_Widgets_WidgetType type, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	FMGL_Widgets_WidgetStruct widget;
+
+	if (0 == width || 0 == height)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	memset(&widget, 0, sizeof(FMGL_Widgets_WidgetStruct));
+
+	widget.Type = type;
+	widget.X = x;
+	widget.Y = y;
+	widget.Width = width;
+	widget.Height = height;
+	widget.IsInvalidated = true;
+
+	return widget;
+}
+
+void FMGL_Widgets_DrawWidget(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget)
+{
+	FMGL_API_DriverContext* context = screen->FmglContext;
+
+	uint16_t x2 = widget->X + widget->Width - 1;
+	uint16_t y2 = widget->Y + widget->Height - 1;
+
+	/* Widget can't spoil neighbours */
+	FMGL_API_PushClipRegion(context, widget->X, widget->Y, x2, y2);
+
+	FMGL_API_DrawRectangleFilled(context, widget->X, widget->Y, x2, y2, screen->BackgroundColor, screen->BackgroundColor);
+
+	switch (widget->Type)
+	{
+		case FMGL_Widgets_Label:
+		case FMGL_Widgets_Value:
+			FMGL_Widgets_DrawText(screen, widget);
+			break;
+
+		case FMGL_Widgets_Icon:
+			FMGL_Widgets_DrawIcon(screen, widget);
+			break;
+
+		case FMGL_Widgets_Chart:
+			FMGL_Widgets_DrawChart(screen, widget);
+			break;
+
+		default:
+			L2HAL_Error(WrongArgument);
+	}
+
+	FMGL_API_PopClipRegion(context);
+}
+
+void FMGL_Widgets_DrawText(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget)
+{
+	uint16_t width;
+	uint16_t height;
+
+	FMGL_API_RenderTextWithLineBreaks(screen->FmglContext, widget->Data.Text.FontSettings, widget->X, widget->Y, &width, &height, false,
+			widget->Data.Text.Text);
+}
+
+void FMGL_Widgets_DrawIcon(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget)
+{
+	if (NULL == widget->Data.Icon.Image)
+	{
+		return;
+	}
+
+	FMGL_API_RenderXBM(screen->FmglContext, widget->Data.Icon.Image, widget->X, widget->Y, 1, 1, widget->Data.Icon.ActiveColor,
+			screen->BackgroundColor, FMGL_XBMTransparencyModeNormal);
+}
+
+void FMGL_Widgets_DrawChart(FMGL_Widgets_ScreenStruct* screen, FMGL_Widgets_WidgetStruct* widget)
+{
+	FMGL_API_DriverContext* context = screen->FmglContext;
+	FMGL_Widgets_ChartDataStruct* chart = &widget->Data.Chart;
+
+	FMGL_API_ColorStruct previousColor = FMGL_API_GetActiveColor(context);
+	FMGL_API_SetActiveColor(context, chart->LineColor);
+
+	uint16_t bottom = widget->Y + widget->Height - 1;
+	uint16_t previousY = 0;
+
+	/* Each point is horizontal step, neighbouring steps are joined by vertical lines */
+	for (uint16_t i = 0; i < chart->PointsCount; i++)
+	{
+		uint16_t x1 = widget->X + (uint32_t)i * widget->Width / FMGL_WIDGETS_CHART_MAX_POINTS;
+		uint16_t x2 = widget->X + (uint32_t)(i + 1) * widget->Width / FMGL_WIDGETS_CHART_MAX_POINTS;
+		x2 = x2 > x1 ? x2 - 1 : x1;
+
+		uint16_t y = bottom - chart->Points[i];
+
+		FMGL_API_DrawLineHorizontal(context, x1, x2, y);
+
+		if (i > 0 && y != previousY)
+		{
+			FMGL_API_DrawLineVertical(context, x1, previousY, y);
+		}
+
+		previousY = y;
+	}
+
+	FMGL_API_SetActiveColor(context, previousColor);
+}
@@ -35,6 +35,7 @@
 #include "../drivers/ram/ly68l6400/include/l2hal_ly68l6400.h"
 #include "../drivers/display/ssd1683/include/ssd1683.h"
 #include "../drivers/sdcard/include/l2hal_sdcard.h"
+#include "../drivers/sensors/bme280_i2c/include/l2hal_bme280_i2c.h"
 
 /**
  * UART1 interrupt priorities
@@ -58,6 +59,9 @@ extern L2HAL_SSD1683_ContextStruct DisplayContext;
 extern L2HAL_SDCard_ContextStruct SDCardContext;
 
 extern I2C_HandleTypeDef I2C1_Handle;
+extern DMA_HandleTypeDef I2C1RxDmaHandle;
+
+extern L2HAL_BME280_I2C_ContextStruct LocalSensor;
 
 /**
  * Put custom hardware initialization stuff here,
@@ -75,6 +79,8 @@ void L2HAL_DisplayDmaCompleted(DMA_HandleTypeDef *hdma); /* Called when transmis
 
 void L2HAL_SDCardDmaCompleted(DMA_HandleTypeDef *hdma); /* Called when transmission via SDCard SPI is completed */
 
+void L2HAL_DisplayRefreshCompleted(void); /* Called when display BUSY signal is released */
+
 /**
  * I2C-related stuff
  */
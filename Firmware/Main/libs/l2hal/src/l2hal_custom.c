@@ -273,6 +273,11 @@ void L2HAL_SDCardDmaCompleted(DMA_HandleTypeDef *hdma)
 	L2HAL_SDCard_MarkDataTransferAsCompleted(&SDCardContext);
 }
 
+void L2HAL_DisplayRefreshCompleted(void)
+{
+	L2HAL_SSD1683_MarkRefreshAsCompleted(&DisplayContext);
+}
+
 void L2HAL_SetupI2C(void)
 {
 	/* I2C1 */
@@ -316,11 +321,38 @@ void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
 
 		HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
-		/* Display driver uses I2C interrupts exchange */
+		/* Sensor driver uses I2C interrupts exchange */
 		HAL_NVIC_SetPriority(I2C1_ER_IRQn, 15, 0);
 		HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
 		HAL_NVIC_SetPriority(I2C1_EV_IRQn, 15, 0);
 		HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+
+		/* RX DMA */
+		__HAL_RCC_DMA1_CLK_ENABLE();
+
+		I2C1RxDmaHandle.Instance = DMA1_Stream0;
+		I2C1RxDmaHandle.Init.Channel = DMA_CHANNEL_1;
+		I2C1RxDmaHandle.Init.Direction = DMA_PERIPH_TO_MEMORY;
+		I2C1RxDmaHandle.Init.PeriphInc = DMA_PINC_DISABLE;
+		I2C1RxDmaHandle.Init.MemInc = DMA_MINC_ENABLE;
+		I2C1RxDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+		I2C1RxDmaHandle.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+		I2C1RxDmaHandle.Init.Mode = DMA_NORMAL;
+		I2C1RxDmaHandle.Init.Priority = DMA_PRIORITY_LOW;
+		I2C1RxDmaHandle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+		I2C1RxDmaHandle.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+		I2C1RxDmaHandle.Init.MemBurst = DMA_MBURST_SINGLE;
+		I2C1RxDmaHandle.Init.PeriphBurst = DMA_PBURST_SINGLE;
+
+		if (HAL_DMA_Init(&I2C1RxDmaHandle) != HAL_OK)
+		{
+			L2HAL_Error(Generic);
+		}
+
+		__HAL_LINKDMA(hi2c, hdmarx, I2C1RxDmaHandle);
+
+		HAL_NVIC_SetPriority(DMA1_Stream0_IRQn, 15, 0);
+		HAL_NVIC_EnableIRQ(DMA1_Stream0_IRQn);
 	}
 }
 
@@ -331,11 +363,39 @@ void HAL_I2C_MspDeInit(I2C_HandleTypeDef* hi2c)
 		HAL_NVIC_DisableIRQ(I2C1_ER_IRQn);
 		HAL_NVIC_DisableIRQ(I2C1_EV_IRQn);
 
+		HAL_DMA_DeInit(&I2C1RxDmaHandle);
+		HAL_NVIC_DisableIRQ(DMA1_Stream0_IRQn);
+
 		__HAL_RCC_I2C1_CLK_DISABLE();
 		HAL_GPIO_DeInit(GPIOB, GPIO_PIN_8 | GPIO_PIN_9);
 	}
 }
 
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance == I2C1)
+	{
+		L2HAL_BME280_I2C_MarkWriteAsCompleted(&LocalSensor);
+	}
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance == I2C1)
+	{
+		L2HAL_BME280_I2C_MarkReadAsCompleted(&LocalSensor);
+	}
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c->Instance == I2C1)
+	{
+		/* Blocking exchange fails in the same way */
+		L2HAL_Error(Generic);
+	}
+}
+
 void HAL_UART_MspInit(UART_HandleTypeDef *huart)
 {
 	if (huart->Instance == USART1)
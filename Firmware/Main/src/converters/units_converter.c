@@ -12,11 +12,31 @@ double TemperatureKelvinsToCelsius(double kelvins)
 	return kelvins - ZERO_CELSIUS_IN_KELVINS;
 }
 
+float TemperatureCentikelvinsToCelsius(int32_t centikelvins)
+{
+	return (float)(centikelvins - ZERO_CELSIUS_IN_CENTIKELVINS) / 100.0f;
+}
+
+float TemperatureCentikelvinsToKelvins(int32_t centikelvins)
+{
+	return (float)centikelvins / 100.0f;
+}
+
 double TemperatureKelvinsToFahrenheits(double kelvins)
 {
 	return kelvins * 1.8 - 459.67;
 }
 
+float TemperatureCentikelvinsToFahrenheits(int32_t centikelvins)
+{
+	return (float)centikelvins * 0.018f - 459.67f;
+}
+
+float HumidityFixedPointToPercents(uint32_t humidity)
+{
+	return (float)humidity / FIXED_POINT_HUMIDITY_SCALE;
+}
+
 double PressurePascalsToMmHg(double pascals)
 {
 	return pascals * 0.00750062;
@@ -31,3 +51,18 @@ double PressurePascalsToInHg(double pascals)
 {
 	return pascals * 0.0002952998751;
 }
+
+float PressureFixedPointToMmHg(uint32_t pressure)
+{
+	return (float)pressure * (0.00750062f / FIXED_POINT_PRESSURE_SCALE);
+}
+
+float PressureFixedPointToHPa(uint32_t pressure)
+{
+	return (float)pressure / (100.0f * FIXED_POINT_PRESSURE_SCALE);
+}
+
+float PressureFixedPointToInHg(uint32_t pressure)
+{
+	return (float)pressure * (0.0002952998751f / FIXED_POINT_PRESSURE_SCALE);
+}
@@ -0,0 +1,97 @@
+/*
+ * waveforms.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Shakti
+ */
+
+#include "../../include/display/waveforms.h"
+#include "../../libs/fatfs/ff.h"
+
+WaveformsContextStruct WaveformsInit(char* path)
+{
+	WaveformsContextStruct waveforms = { 0 };
+
+	waveforms.Path = path;
+
+	FILINFO fileInfo;
+	waveforms.IsAvailable = (FR_OK == f_stat(path, &fileInfo));
+
+	if (waveforms.IsAvailable && 0 != fileInfo.fsize % sizeof(WaveformsRecordStruct))
+	{
+		/* Damaged file */
+		L2HAL_Error(Generic);
+	}
+
+	return waveforms;
+}
+
+void WaveformsSelectByTemperature(WaveformsContextStruct* context, L2HAL_SSD1683_ContextStruct* display, float temperature)
+{
+	L2HAL_SSD1683_SetTemperature(display, temperature);
+
+	if (!context->IsAvailable)
+	{
+		return;
+	}
+
+	if
+	(
+		context->IsBandLoaded
+		&&
+		temperature >= context->Current.MinTemperature - WAVEFORMS_HYSTERESIS
+		&&
+		temperature < context->Current.MaxTemperature + WAVEFORMS_HYSTERESIS
+	)
+	{
+		/* Still within current band */
+		return;
+	}
+
+	if
+	(
+		!context->IsBandLoaded
+		&&
+		context->IsSearched
+		&&
+		temperature >= context->SearchedTemperature - WAVEFORMS_HYSTERESIS
+		&&
+		temperature <= context->SearchedTemperature + WAVEFORMS_HYSTERESIS
+	)
+	{
+		/* There was no band for almost the same temperature */
+		return;
+	}
+
+	/* Search for band, fast waveform is meaningless without it */
+	context->IsBandLoaded = false;
+	context->IsSearched = true;
+	context->SearchedTemperature = temperature;
+
+	FIL file;
+	if (f_open(&file, context->Path, FA_READ) != FR_OK)
+	{
+		L2HAL_Error(Generic);
+	}
+
+	/* Current is in use by display till new band is found */
+	WaveformsRecordStruct record;
+	UINT bytesRead;
+	while (FR_OK == f_read(&file, &record, sizeof(WaveformsRecordStruct), &bytesRead)
+		&& sizeof(WaveformsRecordStruct) == bytesRead)
+	{
+		if (temperature >= record.MinTemperature && temperature < record.MaxTemperature)
+		{
+			context->Current = record;
+			context->IsBandLoaded = true;
+			break;
+		}
+	}
+
+	if (f_close(&file) != FR_OK)
+	{
+		L2HAL_Error(Generic);
+	}
+
+	L2HAL_SSD1683_SetPartialWaveform(display, context->IsBandLoaded ? context->Current.Waveform : NULL);
+}
@@ -48,11 +48,14 @@ void HAL_InitHardware(void)
 	/* Busy */
 	L2HAL_MCU_ClockPortIn(HAL_DISPLAY_BUSY_PORT);
 	GPIO_InitStruct.Pin = HAL_DISPLAY_BUSY_PIN;
-	GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+	GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING; /* Falling edge - refresh completed */
 	GPIO_InitStruct.Pull = GPIO_NOPULL;
 	GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
 	HAL_GPIO_Init(HAL_DISPLAY_BUSY_PORT, &GPIO_InitStruct);
 
+	HAL_NVIC_SetPriority(HAL_DISPLAY_BUSY_IRQ, 0, 2);
+	HAL_NVIC_EnableIRQ(HAL_DISPLAY_BUSY_IRQ);
+
 	/* Reset */
 	L2HAL_MCU_ClockPortIn(HAL_DISPLAY_RESET_PORT);
 	GPIO_InitStruct.Pin = HAL_DISPLAY_RESET_PIN;
@@ -47,6 +47,14 @@ void DMA1_Stream3_IRQHandler(void)
 	HAL_DMA_IRQHandler(SPI2Handle.hdmarx);
 }
 
+/* Display BUSY (PB0) falling edge */
+void EXTI0_IRQHandler(void)
+{
+	HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_0);
+
+	L2HAL_DisplayRefreshCompleted();
+}
+
 void I2C1_EV_IRQHandler(void)
 {
 	HAL_I2C_EV_IRQHandler(&I2C1_Handle);
@@ -57,6 +65,12 @@ void I2C1_ER_IRQHandler(void)
 	HAL_I2C_ER_IRQHandler(&I2C1_Handle);
 }
 
+/* I2C1 DMA RX complete */
+void DMA1_Stream0_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(I2C1_Handle.hdmarx);
+}
+
 void USART1_IRQHandler(void)
 {
 	HAL_UART_IRQHandler(&UART1Handle);
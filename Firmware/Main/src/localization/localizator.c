@@ -89,18 +89,37 @@ double LocalizatorGetLocalizedTemperature(LocalizationContextStruct* context, do
 	}
 }
 
+float LocalizatorGetLocalizedFixedPointTemperature(LocalizationContextStruct* context, int32_t t)
+{
+	switch (context->TemperatureUnit)
+	{
+		case LOCALIZATION_TEMPERATURE_UNIT_KELVIN:
+			return TemperatureCentikelvinsToKelvins(t);
+
+		case LOCALIZATION_TEMPERATURE_UNIT_CELSIUS:
+			return TemperatureCentikelvinsToCelsius(t);
+
+		case LOCALIZATION_TEMPERATURE_UNIT_FAHRENHEIT:
+			return TemperatureCentikelvinsToFahrenheits(t);
+
+		default:
+			L2HAL_Error(Generic);
+			return 0;
+	}
+}
+
 char* LocalizatorGetLocalizedTemperatureUnit(LocalizationContextStruct* context)
 {
 	switch (context->TemperatureUnit)
 	{
 		case LOCALIZATION_TEMPERATURE_UNIT_KELVIN:
-			return "\x9C" "K";
+			return "°K";
 
 		case LOCALIZATION_TEMPERATURE_UNIT_CELSIUS:
-			return "\x9C" "C";
+			return "°C";
 
 		case LOCALIZATION_TEMPERATURE_UNIT_FAHRENHEIT:
-			return "\x9C" "F";
+			return "°F";
 
 		default:
 			L2HAL_Error(Generic);
@@ -133,6 +152,25 @@ double LocalizatorGetLocalizedPressure(LocalizationContextStruct* context, doubl
 	}
 }
 
+float LocalizatorGetLocalizedFixedPointPressure(LocalizationContextStruct* context, uint32_t p)
+{
+	switch (context->PressureUnit)
+	{
+		case LOCALIZATION_PRESSURE_UNIT_MMHG:
+			return PressureFixedPointToMmHg(p);
+
+		case LOCALIZATION_PRESSURE_UNIT_HPA:
+			return PressureFixedPointToHPa(p);
+
+		case LOCALIZATION_PRESSURE_UNIT_INHG:
+			return PressureFixedPointToInHg(p);
+
+		default:
+			L2HAL_Error(Generic);
+			return 0;
+	}
+}
+
 char* LocalizatorGetLocalizedPressureUnit(LocalizationContextStruct* context)
 {
 	switch (context->PressureUnit)
@@ -65,7 +65,26 @@ int main(int argc, char* argv[])
 		HAL_PSRAM_CS_PIN
 	);
 
+	/* Off-screen layers live in RAM too */
+	FMGL_Layers_InitStorage
+	(
+		&LayersStorage,
+		&RamContext,
+		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryWrite,
+		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryRead,
+		CONSTANTS_ADDRESSES_LAYERS_BASE_ADDRESS,
+		CONSTANTS_ADDRESSES_LAYERS_SIZE
+	);
+
 	/* Display initialization */
+	L2HAL_SSD1683_RefreshPolicyStruct refreshPolicy =
+	{
+		.TileGhostingBudget = CONSTANTS_GENERIC_DISPLAY_TILE_GHOSTING_BUDGET,
+		.FullRefreshTilesCount = CONSTANTS_GENERIC_DISPLAY_FULL_REFRESH_TILES_COUNT,
+		.IdleCleaningPercent = CONSTANTS_GENERIC_DISPLAY_IDLE_CLEANING_PERCENT,
+		.IdleTimeout = CONSTANTS_GENERIC_DISPLAY_IDLE_TIMEOUT
+	};
+
 	L2HAL_SSD1683_Init
 	(
 		&DisplayContext,
@@ -85,10 +104,12 @@ int main(int argc, char* argv[])
 
 		OffColor,
 
-		CONSTANTS_GENERIC_IS_DO_PERIODIC_FULL_REFRESH, /* Do periodic full refresh? */
-		CONSTANTS_GENERIC_PERIODIC_FULL_REFRESH_PERIOD /* Do periodic full refresh each this frames count */
+		refreshPolicy /* When to clean display from ghosting */
 	);
 
+	/* Pushes return immediately, display refreshes in background */
+	L2HAL_SSD1683_AttachBackBuffer(&DisplayContext, DisplayBackBuffer);
+
 	/* Local sensor initialization */
 	L2HAL_BME280_I2C_Init
 	(
@@ -106,12 +127,27 @@ int main(int argc, char* argv[])
 		(void (*) (void* deviceContext, FMGL_API_ColorStruct color))&L2HAL_SSD1683_SetActiveColor,
 		(void (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1683_DrawPixel,
 		(FMGL_API_ColorStruct (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1683_GetPixel,
-		(void (*) (void* deviceContext))&L2HAL_SSD1683_PushFramebufferPartial,
+		(void (*) (void* deviceContext))&L2HAL_SSD1683_PushFramebufferPartialAsync,
 
 		OffColor, /* Blanking color */
 		(void (*)(void *, FMGL_API_ColorStruct))&L2HAL_SSD1683_ClearFramebuffer /* Blanking method */
 	);
 
+	FMGL_API_AttachBulkOperations
+	(
+		&FmglContext,
+		(void (*) (void* deviceContext, uint16_t x1, uint16_t x2, uint16_t y))&L2HAL_SSD1683_FillSpan,
+		(void (*) (void* deviceContext, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2))&L2HAL_SSD1683_FillRect,
+		(void (*) (void* deviceContext, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+			FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency))&L2HAL_SSD1683_BlitMono1bpp
+	);
+
+	FMGL_API_AttachRegionsPush
+	(
+		&FmglContext,
+		(void (*) (void* deviceContext, FMGL_API_RegionStruct* regions, uint8_t regionsCount))&L2HAL_SSD1683_PushRegionsPartialAsync
+	);
+
 	/* Early monospaced font */
 	FMGL_API_Font earlyFontData = FMGL_FontTerminusRegular12Init();
 	FMGL_API_XBMTransparencyMode transparencyMode = FMGL_XBMTransparencyModeNormal;
@@ -184,9 +220,21 @@ int main(int argc, char* argv[])
 		&RamContext,
 		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryWrite,
 		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryRead,
-		CONSTANTS_ADDRESSES_MAIN_FONT_BASE_ADDRESS
+		CONSTANTS_ADDRESSES_MAIN_FONT_BASE_ADDRESS,
+		CONSTANTS_ADDRESSES_MAIN_FONT_SIZE
 	);
 
+	uint8_t pinnedCharacterLength;
+	for (const char* pinnedCharacter = CONSTANTS_GENERIC_MAIN_FONT_PINNED_CHARACTERS; *pinnedCharacter != '\0'; pinnedCharacter += pinnedCharacterLength)
+	{
+		uint32_t character = FMGL_API_DecodeUTF8Character(pinnedCharacter, &pinnedCharacterLength);
+
+		if (!FMGL_LoadableFont_PinCharacter(&MainFontContext, character))
+		{
+			break; /* Cache is full, other characters will be cached on demand */
+		}
+	}
+
 	MainFont.Font = &mainFontData;
 	MainFont.Scale = 1;
 	MainFont.CharactersSpacing = 0;
@@ -208,6 +256,74 @@ int main(int argc, char* argv[])
 
 	FMGL_ConsoleAddLine(&Console, "Success");
 
+	/* Display waveforms depend on ambient temperature */
+	FMGL_ConsoleAddLine(&Console, "Loading display waveforms:");
+	FMGL_ConsoleAddLine(&Console, CONSTANTS_PATHS_DISPLAY_WAVEFORMS);
+
+	Waveforms = WaveformsInit(CONSTANTS_PATHS_DISPLAY_WAVEFORMS);
+
+	L2HAL_BME280_I2C_StartForcedMeasurement
+	(
+		&LocalSensor,
+		L2HAL_BME280_I2C_OVERSAMPLING_1,
+		L2HAL_BME280_I2C_OVERSAMPLING_1,
+		L2HAL_BME280_I2C_OVERSAMPLING_1
+	);
+
+	/* Just waiting for conversion instead of hammering I2C bus with status requests */
+	HAL_Delay(L2HAL_BME280_I2C_GetMeasurementTime
+	(
+		L2HAL_BME280_I2C_OVERSAMPLING_1,
+		L2HAL_BME280_I2C_OVERSAMPLING_1,
+		L2HAL_BME280_I2C_OVERSAMPLING_1
+	));
+
+	L2HAL_BME280_I2C_FixedPointMeasurementsStruct ambient = L2HAL_BME280_I2C_GetFixedPointValues(&LocalSensor,
+			L2HAL_BME280_I2C_GetMeasurementRaw(&LocalSensor));
+
+	WaveformsSelectByTemperature(&Waveforms, &DisplayContext, TemperatureCentikelvinsToCelsius(ambient.Temperature));
+
+	FMGL_ConsoleAddLine(&Console, Waveforms.IsAvailable ? "Success" : "Not found, using built-in ones");
+
+	/* Measurements history */
+	TemperatureHistory = TimeSeriesInit
+	(
+		CONSTANTS_ADDRESSES_TEMPERATURE_HISTORY_BASE_ADDRESS,
+		CONSTANTS_ADDRESSES_HISTORY_SIZE,
+		&RamContext,
+		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryRead,
+		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryWrite
+	);
+
+	HumidityHistory = TimeSeriesInit
+	(
+		CONSTANTS_ADDRESSES_HUMIDITY_HISTORY_BASE_ADDRESS,
+		CONSTANTS_ADDRESSES_HISTORY_SIZE,
+		&RamContext,
+		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryRead,
+		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryWrite
+	);
+
+	PressureHistory = TimeSeriesInit
+	(
+		CONSTANTS_ADDRESSES_PRESSURE_HISTORY_BASE_ADDRESS,
+		CONSTANTS_ADDRESSES_HISTORY_SIZE,
+		&RamContext,
+		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryRead,
+		(void (*)(void*, uint32_t, uint32_t, uint8_t*))&L2HAL_LY68L6400_MemoryWrite
+	);
+
+	/* From now on local sensor measures continuously, we only read filtered values */
+	L2HAL_BME280_I2C_StartNormalMode
+	(
+		&LocalSensor,
+		L2HAL_BME280_I2C_OVERSAMPLING_2,
+		L2HAL_BME280_I2C_OVERSAMPLING_1,
+		L2HAL_BME280_I2C_OVERSAMPLING_16,
+		L2HAL_BME280_I2C_STANDBY_1000_MS,
+		L2HAL_BME280_I2C_FILTER_16
+	);
+
 	/* Setting up CRC calculator */
 	CrcContext = L2HAL_CRC_Init();
 
@@ -215,8 +331,10 @@ int main(int argc, char* argv[])
 	L2HAL_SysTick_RegisterHandler(&OnSysTick);
 
 	/* Clear screen before going to main mode */
-	/*FMGL_API_ClearScreen(&FmglContext);
-	FMGL_API_PushFramebuffer(&FmglContext);*/
+	FMGL_API_ClearScreen(&FmglContext);
+	FMGL_API_PushFramebuffer(&FmglContext);
+
+	InitDashboard();
 
 	/* Starting to listen for packets */
 	LLPP_Init(OnPacketReceived);
@@ -225,6 +343,32 @@ int main(int argc, char* argv[])
 	/* Main loop enter */
 	while (true)
 	{
+		/* Local sensor measures in background (normal mode) */
+		if (IsLocalSensorMeasurementCompleted)
+		{
+			IsLocalSensorMeasurementCompleted = false;
+
+			/* Fixed-point compensation, M4F FPU can't do double */
+			L2HAL_BME280_I2C_FixedPointMeasurementsStruct values = L2HAL_BME280_I2C_GetFixedPointValues(&LocalSensor, LocalSensorRawMeasurements);
+
+			/* Display waveform follows ambient temperature */
+			WaveformsSelectByTemperature(&Waveforms, &DisplayContext, TemperatureCentikelvinsToCelsius(values.Temperature));
+
+			/* History keeps fixed-point values as is */
+			uint32_t timestamp = Uptime;
+			TimeSeriesAdd(&TemperatureHistory, timestamp, values.Temperature);
+			TimeSeriesAdd(&HumidityHistory, timestamp, (int32_t)values.Humidity);
+			TimeSeriesAdd(&PressureHistory, timestamp, (int32_t)values.Pressure);
+
+			UpdateDashboard(values);
+		}
+		else if (0 == LocalSensorPollTimeLeft && !L2HAL_BME280_I2C_IsAsyncMeasurementInProgress(&LocalSensor))
+		{
+			LocalSensorPollTimeLeft = CONSTANTS_GENERIC_LOCAL_SENSOR_POLL_INTERVAL;
+
+			L2HAL_BME280_I2C_ReadLatestMeasurementAsync(&LocalSensor, &OnLocalSensorMeasurementCompleted);
+		}
+
 		if (IsNewPacketReceived)
 		{
 			IsNewPacketReceived = false;
@@ -233,72 +377,12 @@ int main(int argc, char* argv[])
 			sprintf(buffer, "Acknowledged: %s", PacketPayload);
 
 			LLPP_Send(buffer, strlen(buffer));
-
-			FMGL_ConsoleAddLine(&Console, PacketPayload);
+		}
+		else
+		{
+			L2HAL_SSD1683_CleanOnIdle(&DisplayContext);
 		}
 	}
-
-	/*while(true)
-	{
-		L2HAL_BME280_I2C_StartForcedMeasurement
-		(
-			&LocalSensor,
-			L2HAL_BME280_I2C_OVERSAMPLING_16,
-			L2HAL_BME280_I2C_OVERSAMPLING_16,
-			L2HAL_BME280_I2C_OVERSAMPLING_16
-		);
-
-		while (!L2HAL_BME280_I2C_IsMeasurementCompleted(&LocalSensor)) {}
-
-		L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements = L2HAL_BME280_I2C_GetMeasurementRaw(&LocalSensor);
-
-		 Creature-readable values
-		L2HAL_BME280_I2C_CreatureReadableMeasurementsStruct creatureReadableValues = L2HAL_BME280_I2C_GetCreatureReadableValues(&LocalSensor, rawMeasurements);
-
-		char buffer[32];
-		char template[32];
-		uint16_t linePosition = 0;
-		uint16_t width;
-		uint16_t height;
-
-		FMGL_API_ClearScreen(&FmglContext);
-
-		 Temperature
-		sprintf(template, "Temperature: %s%%s", LocalizatorGetLocalizedTemperaturePrecisionTemplate(&LocalizationContext));
-		sprintf
-		(
-			buffer,
-			template,
-			LocalizatorGetLocalizedTemperature(&LocalizationContext, creatureReadableValues.Temperature),
-			LocalizatorGetLocalizedTemperatureUnit(&LocalizationContext)
-		);
-
-		FMGL_API_RenderTextWithLineBreaks(&FmglContext, &MainFont, 0, linePosition, &width, &height, false, buffer);
-		HAL_UART_Transmit(&UART1Handle, (uint8_t*)buffer, strlen(buffer) , L2HAL_HC06_UART_TIMEOUT);
-		linePosition += height;
-
-		 Humidity
-		sprintf(buffer, "Humidity: %.1f%%", creatureReadableValues.Humidity);
-		FMGL_API_RenderTextWithLineBreaks(&FmglContext, &MainFont, 0, linePosition, &width, &height, false, buffer);
-		HAL_UART_Transmit(&UART1Handle, (uint8_t*)buffer, strlen(buffer) , L2HAL_HC06_UART_TIMEOUT);
-		linePosition += height;
-
-		 Pressure
-		sprintf(template, "Pressure: %s %%s", LocalizatorGetLocalizedPressurePrecisionTemplate(&LocalizationContext));
-		sprintf
-		(
-			buffer,
-			template,
-			LocalizatorGetLocalizedPressure(&LocalizationContext, creatureReadableValues.Pressure),
-			LocalizatorGetLocalizedPressureUnit(&LocalizationContext)
-		);
-
-		FMGL_API_RenderTextWithLineBreaks(&FmglContext, &MainFont, 0, linePosition, &width, &height, false, buffer);
-		HAL_UART_Transmit(&UART1Handle, (uint8_t*)buffer, strlen(buffer) , L2HAL_HC06_UART_TIMEOUT);
-		linePosition += height;
-
-		FMGL_API_PushFramebuffer(&FmglContext);
-	}*/
 }
 
 /**
@@ -306,7 +390,80 @@ int main(int argc, char* argv[])
  */
 void OnSysTick(void)
 {
+	UptimeMilliseconds ++;
+	if (UptimeMilliseconds >= 1000)
+	{
+		UptimeMilliseconds = 0;
+		Uptime ++;
+	}
+
+	if (LocalSensorPollTimeLeft > 0)
+	{
+		LocalSensorPollTimeLeft --;
+	}
+}
+
+/**
+ * Called when local sensor asynchronous measurement is completed, executed in interrupt context
+ */
+void OnLocalSensorMeasurementCompleted(L2HAL_BME280_I2C_RawMeasurementsStruct rawMeasurements)
+{
+	LocalSensorRawMeasurements = rawMeasurements;
+	IsLocalSensorMeasurementCompleted = true;
+}
+
+void InitDashboard(void)
+{
+	uint16_t width = FMGL_API_GetDisplayWidth(&FmglContext);
+	uint16_t lineHeight = MainFont.Font->Height * MainFont.Scale;
+
+	Dashboard = FMGL_Widgets_InitScreen(&FmglContext, OffColor);
+
+	TemperatureWidget = FMGL_Widgets_CreateLabel(0, 0, width, lineHeight, &MainFont, "");
+	HumidityWidget = FMGL_Widgets_CreateValue(0, lineHeight, width, lineHeight, &MainFont, "%.1f%%");
+	PressureWidget = FMGL_Widgets_CreateLabel(0, 2 * lineHeight, width, lineHeight, &MainFont, "");
+
+	FMGL_Widgets_AddWidget(&Dashboard, &TemperatureWidget);
+	FMGL_Widgets_AddWidget(&Dashboard, &HumidityWidget);
+	FMGL_Widgets_AddWidget(&Dashboard, &PressureWidget);
+}
+
+void UpdateDashboard(L2HAL_BME280_I2C_FixedPointMeasurementsStruct values)
+{
+	char buffer[FMGL_WIDGETS_MAX_TEXT_LENGTH];
+	char template[FMGL_WIDGETS_MAX_TEXT_LENGTH];
+
+	/* Temperature */
+	snprintf(template, sizeof(template), "%s%%s", LocalizatorGetLocalizedTemperaturePrecisionTemplate(&LocalizationContext));
+	snprintf
+	(
+		buffer,
+		sizeof(buffer),
+		template,
+		LocalizatorGetLocalizedFixedPointTemperature(&LocalizationContext, values.Temperature),
+		LocalizatorGetLocalizedTemperatureUnit(&LocalizationContext)
+	);
+
+	FMGL_Widgets_SetText(&TemperatureWidget, buffer);
+
+	/* Humidity */
+	FMGL_Widgets_SetValue(&HumidityWidget, HumidityFixedPointToPercents(values.Humidity));
+
+	/* Pressure */
+	snprintf(template, sizeof(template), "%s %%s", LocalizatorGetLocalizedPressurePrecisionTemplate(&LocalizationContext));
+	snprintf
+	(
+		buffer,
+		sizeof(buffer),
+		template,
+		LocalizatorGetLocalizedFixedPointPressure(&LocalizationContext, values.Pressure),
+		LocalizatorGetLocalizedPressureUnit(&LocalizationContext)
+	);
+
+	FMGL_Widgets_SetText(&PressureWidget, buffer);
 
+	/* Only changed lines are redrawn and pushed */
+	FMGL_Widgets_Update(&Dashboard);
 }
 
 void OnPacketReceived(uint8_t* payload, uint8_t payloadLength)
@@ -0,0 +1,285 @@
+/*
+ * time_series.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: Shakti
+ */
+
+#include "../../include/measurements/time_series_private.h"
+#include "../../libs/l2hal/l2hal_config.h"
+
+TimeSeriesContextStruct TimeSeriesInit
+(
+	uint32_t baseAddress,
+	uint32_t size,
+	void* memoryDriverContext,
+	void (*memoryReadFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*),
+	void (*memoryWriteFunctionPtr)(void*, uint32_t, uint32_t, uint8_t*)
+)
+{
+	TimeSeriesContextStruct timeSeries = { 0 };
+
+	if (size < TIME_SERIES_SIZE)
+	{
+		/* Doesn't fit */
+		L2HAL_Error(WrongArgument);
+	}
+
+	timeSeries.MemoryDriverContext = memoryDriverContext;
+	timeSeries.MemoryReadFunctionPtr = memoryReadFunctionPtr;
+	timeSeries.MemoryWriteFunctionPtr = memoryWriteFunctionPtr;
+
+	uint32_t address = baseAddress;
+	address = TimeSeriesInitTier(&timeSeries.Tiers[TIME_SERIES_TIER_RAW], address, TIME_SERIES_RAW_CAPACITY, 0);
+	address = TimeSeriesInitTier(&timeSeries.Tiers[TIME_SERIES_TIER_MINUTE], address, TIME_SERIES_MINUTE_CAPACITY, TIME_SERIES_MINUTE_PERIOD);
+	address = TimeSeriesInitTier(&timeSeries.Tiers[TIME_SERIES_TIER_HOUR], address, TIME_SERIES_HOUR_CAPACITY, TIME_SERIES_HOUR_PERIOD);
+	TimeSeriesInitTier(&timeSeries.Tiers[TIME_SERIES_TIER_DAY], address, TIME_SERIES_DAY_CAPACITY, TIME_SERIES_DAY_PERIOD);
+
+	return timeSeries;
+}
+
+uint32_t TimeSeriesInitTier(TimeSeriesTierStruct* tier, uint32_t baseAddress, uint32_t capacity, uint32_t period)
+{
+	tier->BaseAddress = baseAddress;
+	tier->Capacity = capacity;
+	tier->Period = period;
+	tier->Head = 0;
+	tier->Count = 0;
+	tier->BucketCount = 0;
+
+	uint8_t columnsCount = (0 == period) ? TIME_SERIES_RAW_COLUMNS_COUNT : TIME_SERIES_AGGREGATED_COLUMNS_COUNT;
+
+	return baseAddress + columnsCount * capacity * TIME_SERIES_ELEMENT_SIZE;
+}
+
+void TimeSeriesAdd(TimeSeriesContextStruct* context, uint32_t timestamp, int32_t value)
+{
+	TimeSeriesTierStruct* raw = &context->Tiers[TIME_SERIES_TIER_RAW];
+
+	if (raw->Count > 0 && timestamp < context->LastTimestamp)
+	{
+		/* Binary search relies on chronological order */
+		L2HAL_Error(WrongArgument);
+	}
+
+	context->LastTimestamp = timestamp;
+
+	uint32_t record[TIME_SERIES_RAW_COLUMNS_COUNT] = { timestamp, (uint32_t)value };
+	TimeSeriesAppendRecord(context, raw, record, TIME_SERIES_RAW_COLUMNS_COUNT);
+
+	/* Each aggregated tier is calculated from samples, not from lower tier, so means are exact */
+	for (uint8_t tier = TIME_SERIES_TIER_MINUTE; tier < TIME_SERIES_TIERS_COUNT; tier++)
+	{
+		TimeSeriesAggregate(context, &context->Tiers[tier], timestamp, value);
+	}
+}
+
+void TimeSeriesAggregate(TimeSeriesContextStruct* context, TimeSeriesTierStruct* tier, uint32_t timestamp, int32_t value)
+{
+	uint32_t bucketTimestamp = timestamp - timestamp % tier->Period;
+
+	if (tier->BucketCount > 0 && bucketTimestamp != tier->BucketTimestamp)
+	{
+		/* Period is finished */
+		uint32_t record[TIME_SERIES_AGGREGATED_COLUMNS_COUNT];
+		record[TIME_SERIES_COLUMN_TIMESTAMP] = tier->BucketTimestamp;
+		record[TIME_SERIES_COLUMN_MEAN] = (uint32_t)(int32_t)(tier->BucketSum / (int64_t)tier->BucketCount);
+		record[TIME_SERIES_COLUMN_MIN] = (uint32_t)tier->BucketMin;
+		record[TIME_SERIES_COLUMN_MAX] = (uint32_t)tier->BucketMax;
+		record[TIME_SERIES_COLUMN_COUNT] = tier->BucketCount;
+
+		TimeSeriesAppendRecord(context, tier, record, TIME_SERIES_AGGREGATED_COLUMNS_COUNT);
+
+		tier->BucketCount = 0;
+	}
+
+	if (0 == tier->BucketCount)
+	{
+		tier->BucketTimestamp = bucketTimestamp;
+		tier->BucketMin = value;
+		tier->BucketMax = value;
+		tier->BucketSum = 0;
+	}
+
+	if (value < tier->BucketMin)
+	{
+		tier->BucketMin = value;
+	}
+
+	if (value > tier->BucketMax)
+	{
+		tier->BucketMax = value;
+	}
+
+	tier->BucketSum += value;
+	tier->BucketCount ++;
+}
+
+void TimeSeriesAppendRecord(TimeSeriesContextStruct* context, TimeSeriesTierStruct* tier, uint32_t* record, uint8_t columnsCount)
+{
+	uint32_t physicalIndex = (tier->Head + tier->Count) % tier->Capacity;
+
+	for (uint8_t column = 0; column < columnsCount; column++)
+	{
+		context->MemoryWriteFunctionPtr
+		(
+			context->MemoryDriverContext,
+			TimeSeriesGetElementAddress(tier, column, physicalIndex),
+			TIME_SERIES_ELEMENT_SIZE,
+			(uint8_t*)&record[column]
+		);
+	}
+
+	if (tier->Count < tier->Capacity)
+	{
+		tier->Count ++;
+	}
+	else
+	{
+		/* Oldest record was overwritten */
+		tier->Head = (tier->Head + 1) % tier->Capacity;
+	}
+}
+
+uint32_t TimeSeriesGetElementAddress(TimeSeriesTierStruct* tier, enum TIME_SERIES_COLUMN column, uint32_t physicalIndex)
+{
+	if (0 == tier->Period)
+	{
+		if (TIME_SERIES_COLUMN_COUNT == column)
+		{
+			L2HAL_Error(WrongArgument);
+		}
+
+		/* Raw tier: minimum and maximum are the sample itself */
+		if (TIME_SERIES_COLUMN_TIMESTAMP != column)
+		{
+			column = TIME_SERIES_COLUMN_MEAN;
+		}
+	}
+
+	return tier->BaseAddress + (column * tier->Capacity + physicalIndex) * TIME_SERIES_ELEMENT_SIZE;
+}
+
+uint32_t TimeSeriesGetCount(TimeSeriesContextStruct* context, enum TIME_SERIES_TIER tier)
+{
+	return TimeSeriesGetTier(context, tier)->Count;
+}
+
+uint32_t TimeSeriesFindRange
+(
+	TimeSeriesContextStruct* context,
+	enum TIME_SERIES_TIER tier,
+	uint32_t from,
+	uint32_t to,
+	uint32_t* firstIndex
+)
+{
+	TimeSeriesTierStruct* tierPtr = TimeSeriesGetTier(context, tier);
+
+	if (from > to)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	*firstIndex = TimeSeriesLowerBound(context, tierPtr, from, false);
+
+	return TimeSeriesLowerBound(context, tierPtr, to, true) - *firstIndex;
+}
+
+uint32_t TimeSeriesLowerBound(TimeSeriesContextStruct* context, TimeSeriesTierStruct* tier, uint32_t timestamp, bool isStrict)
+{
+	uint32_t low = 0;
+	uint32_t high = tier->Count;
+
+	while (low < high)
+	{
+		uint32_t middle = low + (high - low) / 2;
+		uint32_t middleTimestamp = TimeSeriesReadTimestamp(context, tier, middle);
+
+		if (middleTimestamp < timestamp || (isStrict && middleTimestamp == timestamp))
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return low;
+}
+
+uint32_t TimeSeriesReadTimestamp(TimeSeriesContextStruct* context, TimeSeriesTierStruct* tier, uint32_t index)
+{
+	uint32_t timestamp;
+
+	context->MemoryReadFunctionPtr
+	(
+		context->MemoryDriverContext,
+		TimeSeriesGetElementAddress(tier, TIME_SERIES_COLUMN_TIMESTAMP, (tier->Head + index) % tier->Capacity),
+		TIME_SERIES_ELEMENT_SIZE,
+		(uint8_t*)&timestamp
+	);
+
+	return timestamp;
+}
+
+void TimeSeriesReadColumn
+(
+	TimeSeriesContextStruct* context,
+	enum TIME_SERIES_TIER tier,
+	enum TIME_SERIES_COLUMN column,
+	uint32_t firstIndex,
+	uint32_t count,
+	void* buffer
+)
+{
+	TimeSeriesTierStruct* tierPtr = TimeSeriesGetTier(context, tier);
+
+	if (firstIndex > tierPtr->Count || count > tierPtr->Count - firstIndex)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	if (0 == count)
+	{
+		return;
+	}
+
+	/* Ring buffer may wrap, then column is read in two parts */
+	uint32_t physicalIndex = (tierPtr->Head + firstIndex) % tierPtr->Capacity;
+	uint32_t firstPartCount = tierPtr->Capacity - physicalIndex;
+	if (firstPartCount > count)
+	{
+		firstPartCount = count;
+	}
+
+	context->MemoryReadFunctionPtr
+	(
+		context->MemoryDriverContext,
+		TimeSeriesGetElementAddress(tierPtr, column, physicalIndex),
+		firstPartCount * TIME_SERIES_ELEMENT_SIZE,
+		(uint8_t*)buffer
+	);
+
+	if (firstPartCount < count)
+	{
+		context->MemoryReadFunctionPtr
+		(
+			context->MemoryDriverContext,
+			TimeSeriesGetElementAddress(tierPtr, column, 0),
+			(count - firstPartCount) * TIME_SERIES_ELEMENT_SIZE,
+			(uint8_t*)buffer + firstPartCount * TIME_SERIES_ELEMENT_SIZE
+		);
+	}
+}
+
+TimeSeriesTierStruct* TimeSeriesGetTier(TimeSeriesContextStruct* context, enum TIME_SERIES_TIER tier)
+{
+	if (tier >= TIME_SERIES_TIERS_COUNT)
+	{
+		L2HAL_Error(WrongArgument);
+	}
+
+	return &context->Tiers[tier];
+}
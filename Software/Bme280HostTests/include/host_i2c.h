@@ -0,0 +1,20 @@
+/*
+ * host_i2c.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * STM32 HAL I2C stub, emulating BME280 registers file. Writes to sensor are ignored
+ */
+
+#ifndef INCLUDE_HOST_I2C_H_
+#define INCLUDE_HOST_I2C_H_
+
+#include <stdint.h>
+
+/**
+ * Set emulated sensor registers
+ */
+void HostI2C_SetRegisters(uint8_t baseAddress, const uint8_t* data, uint8_t count);
+
+#endif /* INCLUDE_HOST_I2C_H_ */
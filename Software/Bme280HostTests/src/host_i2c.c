@@ -0,0 +1,88 @@
+/*
+ * host_i2c.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stm32f4xx_hal.h>
+#include "../include/host_i2c.h"
+#include "../../../Firmware/Main/libs/l2hal/include/l2hal_errors.h"
+
+#define HOST_I2C_REGISTERS_COUNT 256U
+
+static uint8_t Registers[HOST_I2C_REGISTERS_COUNT];
+
+void HostI2C_SetRegisters(uint8_t baseAddress, const uint8_t* data, uint8_t count)
+{
+	if (baseAddress + count > HOST_I2C_REGISTERS_COUNT)
+	{
+		fprintf(stderr, "Registers 0x%02X-0x%02X are out of range\n", baseAddress, baseAddress + count - 1);
+		exit(EXIT_FAILURE);
+	}
+
+	memcpy(&Registers[baseAddress], data, count);
+}
+
+void L2HAL_Error(L2HAL_ErrorCode code)
+{
+	fprintf(stderr, "L2HAL_Error(%d) called\n", (int)code);
+	exit(EXIT_FAILURE);
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef* hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)Trials;
+	(void)Timeout;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef* hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t* pData,
+	uint16_t Size, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)MemAddSize;
+	(void)Timeout;
+
+	if (MemAddress + Size > HOST_I2C_REGISTERS_COUNT)
+	{
+		return HAL_ERROR;
+	}
+
+	memcpy(pData, &Registers[MemAddress], Size);
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef* hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t* pData,
+	uint16_t Size)
+{
+	return HAL_I2C_Mem_Read(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 0);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef* hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t* pData,
+	uint16_t Size, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)MemAddress;
+	(void)MemAddSize;
+	(void)pData;
+	(void)Size;
+	(void)Timeout;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef* hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t* pData,
+	uint16_t Size)
+{
+	return HAL_I2C_Mem_Write(hi2c, DevAddress, MemAddress, MemAddSize, pData, Size, 0);
+}
@@ -0,0 +1,254 @@
+/*
+ * main.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * Sweeps raw temperature, humidity and pressure over whole sensor range and checks that fixed-point compensation
+ * (L2HAL_BME280_I2C_GetFixedPointValues()) agrees with floating point one (L2HAL_BME280_I2C_GetCreatureReadableValues())
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "../include/host_i2c.h"
+#include "../../../Firmware/Main/libs/l2hal/drivers/sensors/bme280_i2c/include/l2hal_bme280_i2c.h"
+
+/**
+ * Sensor registers
+ */
+#define MAIN_REGISTER_TEMPERATURE_PRESSURE_COMPENSATION 0x88U
+#define MAIN_REGISTER_H1 0xA1U
+#define MAIN_REGISTER_ID 0xD0U
+#define MAIN_REGISTER_HUMIDITY_COMPENSATION 0xE1U
+#define MAIN_REGISTER_STATUS 0xF3U
+
+#define MAIN_DEVICE_ID 0x60U
+#define MAIN_BUS_ADDRESS (0x76U << 1)
+
+/**
+ * Raw values sweep. Raw values are 20 bits for temperature and pressure, 16 bits for humidity
+ */
+#define MAIN_RAW_TEMPERATURE_MIN 300000
+#define MAIN_RAW_TEMPERATURE_MAX 750000
+#define MAIN_RAW_TEMPERATURE_STEP 2503
+
+#define MAIN_RAW_PRESSURE_MIN 180000U
+#define MAIN_RAW_PRESSURE_MAX 700000U
+#define MAIN_RAW_PRESSURE_STEP 10007U
+
+#define MAIN_RAW_HUMIDITY_MAX 65535U
+#define MAIN_RAW_HUMIDITY_STEP 1511U
+
+/**
+ * Only values in sensor operating range are compared
+ */
+#define MAIN_KELVINS_IN_ZERO_CELSIUS 273.15
+#define MAIN_MIN_TEMPERATURE (MAIN_KELVINS_IN_ZERO_CELSIUS - 40.0)
+#define MAIN_MAX_TEMPERATURE (MAIN_KELVINS_IN_ZERO_CELSIUS + 85.0)
+#define MAIN_MIN_PRESSURE 30000.0
+#define MAIN_MAX_PRESSURE 110000.0
+
+/**
+ * Tolerances: Kelvins, percents and Pascals
+ */
+#define MAIN_TEMPERATURE_TOLERANCE 0.01
+#define MAIN_HUMIDITY_TOLERANCE 0.02
+#define MAIN_PRESSURE_TOLERANCE 1.0
+
+/**
+ * Fixed-point values scale
+ */
+#define MAIN_TEMPERATURE_SCALE 100.0
+#define MAIN_HUMIDITY_SCALE 1024.0
+#define MAIN_PRESSURE_SCALE 256.0
+
+/**
+ * Calibration constants, as named in datasheet
+ */
+typedef struct
+{
+	const char* Name;
+
+	uint16_t T1;
+	int16_t T2;
+	int16_t T3;
+
+	uint16_t P1;
+	int16_t P2;
+	int16_t P3;
+	int16_t P4;
+	int16_t P5;
+	int16_t P6;
+	int16_t P7;
+	int16_t P8;
+	int16_t P9;
+
+	uint8_t H1;
+	int16_t H2;
+	uint8_t H3;
+	int16_t H4;
+	int16_t H5;
+	int8_t H6;
+}
+MainCalibrationStruct;
+
+/**
+ * Maximal difference and where it is reached
+ */
+typedef struct
+{
+	double Value;
+	L2HAL_BME280_I2C_RawMeasurementsStruct Raw;
+}
+MainErrorStruct;
+
+static const MainCalibrationStruct Calibrations[] =
+{
+	{
+		"datasheet",
+		27504, 26435, -1000,
+		36477, -10685, 3024, 2855, 140, -7, 15500, -14600, 6000,
+		75, 362, 0, 316, 50, 30
+	},
+	{
+		"sensor",
+		28485, 26735, 50,
+		37697, -10600, 3024, 6952, -83, -7, 9900, -10230, 4285,
+		75, 356, 0, 339, 50, 30
+	}
+};
+
+static void PutWord(uint8_t* registers, uint16_t value)
+{
+	registers[0] = (uint8_t)value;
+	registers[1] = (uint8_t)(value >> 8);
+}
+
+/**
+ * Put calibration constants into sensor registers
+ */
+static void SetCalibration(const MainCalibrationStruct* calibration)
+{
+	uint8_t registers[24];
+
+	const uint16_t words[] =
+	{
+		calibration->T1, (uint16_t)calibration->T2, (uint16_t)calibration->T3,
+		calibration->P1, (uint16_t)calibration->P2, (uint16_t)calibration->P3, (uint16_t)calibration->P4, (uint16_t)calibration->P5,
+		(uint16_t)calibration->P6, (uint16_t)calibration->P7, (uint16_t)calibration->P8, (uint16_t)calibration->P9
+	};
+
+	for (uint8_t i = 0; i < sizeof(words) / sizeof(words[0]); i++)
+	{
+		PutWord(&registers[2 * i], words[i]);
+	}
+
+	HostI2C_SetRegisters(MAIN_REGISTER_TEMPERATURE_PRESSURE_COMPENSATION, registers, sizeof(words));
+
+	HostI2C_SetRegisters(MAIN_REGISTER_H1, &calibration->H1, 1);
+
+	/* H4 and H5 are 12-bit, sharing one register */
+	PutWord(&registers[0], (uint16_t)calibration->H2);
+	registers[2] = calibration->H3;
+	registers[3] = (uint8_t)(calibration->H4 >> 4);
+	registers[4] = (uint8_t)((calibration->H4 & 0x0F) | ((calibration->H5 & 0x0F) << 4));
+	registers[5] = (uint8_t)(calibration->H5 >> 4);
+	registers[6] = (uint8_t)calibration->H6;
+
+	HostI2C_SetRegisters(MAIN_REGISTER_HUMIDITY_COMPENSATION, registers, 7);
+}
+
+static void UpdateError(MainErrorStruct* error, double value, L2HAL_BME280_I2C_RawMeasurementsStruct raw)
+{
+	if (value > error->Value)
+	{
+		error->Value = value;
+		error->Raw = raw;
+	}
+}
+
+static bool CheckError(const char* name, const MainErrorStruct* error, double tolerance, const char* unit)
+{
+	bool isPassed = (error->Value <= tolerance);
+
+	printf("    %-12s max difference %.4f %s (tolerance %.2f) at raw T=%ld, H=%lu, P=%lu%s\n", name, error->Value, unit, tolerance,
+		(long)error->Raw.Temperature, (unsigned long)error->Raw.Humidity, (unsigned long)error->Raw.Pressure, isPassed ? "" : " - FAILED");
+
+	return isPassed;
+}
+
+/**
+ * Sweep raw values with given calibration. Returns false if differences exceed tolerances
+ */
+static bool TestCalibration(const MainCalibrationStruct* calibration)
+{
+	SetCalibration(calibration);
+
+	I2C_HandleTypeDef bus;
+	L2HAL_BME280_I2C_ContextStruct context;
+	L2HAL_BME280_I2C_Init(&context, &bus, MAIN_BUS_ADDRESS);
+
+	MainErrorStruct temperatureError = { 0 };
+	MainErrorStruct humidityError = { 0 };
+	MainErrorStruct pressureError = { 0 };
+	uint32_t pointsCount = 0;
+
+	for (int32_t rawTemperature = MAIN_RAW_TEMPERATURE_MIN; rawTemperature <= MAIN_RAW_TEMPERATURE_MAX; rawTemperature += MAIN_RAW_TEMPERATURE_STEP)
+	{
+		for (uint32_t rawPressure = MAIN_RAW_PRESSURE_MIN; rawPressure <= MAIN_RAW_PRESSURE_MAX; rawPressure += MAIN_RAW_PRESSURE_STEP)
+		{
+			for (uint32_t rawHumidity = 0; rawHumidity <= MAIN_RAW_HUMIDITY_MAX; rawHumidity += MAIN_RAW_HUMIDITY_STEP)
+			{
+				L2HAL_BME280_I2C_RawMeasurementsStruct raw;
+				raw.Temperature = rawTemperature;
+				raw.Humidity = rawHumidity;
+				raw.Pressure = rawPressure;
+
+				L2HAL_BME280_I2C_CreatureReadableMeasurementsStruct reference = L2HAL_BME280_I2C_GetCreatureReadableValues(&context, raw);
+
+				if (reference.Temperature < MAIN_MIN_TEMPERATURE || reference.Temperature > MAIN_MAX_TEMPERATURE
+					|| reference.Pressure < MAIN_MIN_PRESSURE || reference.Pressure > MAIN_MAX_PRESSURE)
+				{
+					continue;
+				}
+
+				L2HAL_BME280_I2C_FixedPointMeasurementsStruct fixedPoint = L2HAL_BME280_I2C_GetFixedPointValues(&context, raw);
+
+				UpdateError(&temperatureError, fabs(fixedPoint.Temperature / MAIN_TEMPERATURE_SCALE - reference.Temperature), raw);
+				UpdateError(&humidityError, fabs(fixedPoint.Humidity / MAIN_HUMIDITY_SCALE - reference.Humidity), raw);
+				UpdateError(&pressureError, fabs(fixedPoint.Pressure / MAIN_PRESSURE_SCALE - reference.Pressure), raw);
+
+				pointsCount ++;
+			}
+		}
+	}
+
+	printf("Calibration \"%s\", %lu points:\n", calibration->Name, (unsigned long)pointsCount);
+
+	bool isPassed = CheckError("temperature", &temperatureError, MAIN_TEMPERATURE_TOLERANCE, "K");
+	isPassed = CheckError("humidity", &humidityError, MAIN_HUMIDITY_TOLERANCE, "%RH") && isPassed;
+	isPassed = CheckError("pressure", &pressureError, MAIN_PRESSURE_TOLERANCE, "Pa") && isPassed;
+
+	return isPassed && (0 != pointsCount);
+}
+
+int main(void)
+{
+	const uint8_t deviceId = MAIN_DEVICE_ID;
+	const uint8_t status = 0x00; /* Not measuring, NVM data are copied */
+
+	HostI2C_SetRegisters(MAIN_REGISTER_ID, &deviceId, 1);
+	HostI2C_SetRegisters(MAIN_REGISTER_STATUS, &status, 1);
+
+	bool isPassed = true;
+
+	for (uint8_t i = 0; i < sizeof(Calibrations) / sizeof(Calibrations[0]); i++)
+	{
+		isPassed = TestCalibration(&Calibrations[i]) && isPassed;
+	}
+
+	printf("%s\n", isPassed ? "Passed" : "Failed");
+
+	return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,24 @@
+/*
+ * bdf_reader.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#ifndef INCLUDE_BDF_READER_H_
+#define INCLUDE_BDF_READER_H_
+
+#include "glyphs.h"
+
+/**
+ * Maximal BDF line length
+ */
+#define BDF_READER_MAX_LINE_LENGTH 1024
+
+/**
+ * Load glyphs from BDF (bitmap distribution format) font.
+ * charactersMap: target code -> source font code (BDF ENCODING)
+ */
+void BdfReader_Load(Glyphs_FontStruct* font, const char* path, const Glyphs_CharactersMapStruct* charactersMap);
+
+#endif /* INCLUDE_BDF_READER_H_ */
@@ -0,0 +1,51 @@
+/*
+ * fmgl_font_writer.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#ifndef INCLUDE_FMGL_FONT_WRITER_H_
+#define INCLUDE_FMGL_FONT_WRITER_H_
+
+#include "glyphs.h"
+
+/**
+ * .fmglfont versions
+ */
+#define FMGL_FONT_WRITER_VERSION_1 1
+#define FMGL_FONT_WRITER_VERSION_2 2
+
+/**
+ * Version 2 glyph flags
+ */
+#define FMGL_FONT_WRITER_GLYPH_FLAG_RLE 0x0001
+
+/**
+ * Version 2 rasters are aligned to this number of bytes
+ */
+#define FMGL_FONT_WRITER_RASTER_ALIGNMENT 4
+
+/**
+ * RLE: control byte with MSB set means "repeat next byte (control & 0x7F) + 2 times",
+ * otherwise (control + 1) literal bytes follow
+ */
+#define FMGL_FONT_WRITER_RLE_REPEAT_FLAG 0x80
+#define FMGL_FONT_WRITER_RLE_MIN_REPEAT 2
+#define FMGL_FONT_WRITER_RLE_MAX_REPEAT 129
+#define FMGL_FONT_WRITER_RLE_MAX_LITERALS 128
+
+/**
+ * Write .fmglfont file. Version 1 rasters are LSB-first (XBM), version 2 ones are MSB-first.
+ * If isRle is true, version 2 glyph rasters are RLE-packed when it makes them smaller.
+ * Kerning pairs (if any) are written into version 2 optional kerning block.
+ * Glyphs are sorted by code (firmware requires it)
+ */
+void FmglFontWriter_Write(Glyphs_FontStruct* font, const char* path, uint32_t version, bool isRle);
+
+/**
+ * Pack raster with RLE. Returns packed size, destination must be at least size + size / 128 + 1 bytes long
+ */
+uint32_t FmglFontWriter_PackRle(const uint8_t* source, uint32_t size, uint8_t* destination);
+
+#endif /* INCLUDE_FMGL_FONT_WRITER_H_ */
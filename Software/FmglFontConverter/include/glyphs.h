@@ -0,0 +1,202 @@
+/*
+ * glyphs.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#ifndef INCLUDE_GLYPHS_H_
+#define INCLUDE_GLYPHS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Maximal Unicode code point
+ */
+#define GLYPHS_MAX_CODE_POINT 0x10FFFFU
+
+/**
+ * Firmware can't load more glyphs
+ */
+#define GLYPHS_MAX_GLYPHS_COUNT 0xFFFEU
+
+/**
+ * Rendered glyph, one byte per pixel (0 - off, 1 - on)
+ */
+typedef struct
+{
+	/**
+	 * Character code (Unicode code point) in resulting font
+	 */
+	uint32_t Code;
+
+	/**
+	 * Glyph width (advance)
+	 */
+	uint16_t Width;
+
+	/**
+	 * Glyph height, the same for all glyphs of font
+	 */
+	uint16_t Height;
+
+	/**
+	 * Width * Height pixels, row by row
+	 */
+	uint8_t* Pixels;
+}
+Glyphs_GlyphStruct;
+
+/**
+ * Kerning pair
+ */
+typedef struct
+{
+	/**
+	 * Left character code (in resulting font)
+	 */
+	uint32_t Left;
+
+	/**
+	 * Right character code (in resulting font)
+	 */
+	uint32_t Right;
+
+	/**
+	 * Adjustment of distance between characters, in pixels
+	 */
+	int16_t Value;
+}
+Glyphs_KerningPairStruct;
+
+/**
+ * Source font, rendered into glyphs
+ */
+typedef struct
+{
+	/**
+	 * Height of all glyphs
+	 */
+	uint16_t Height;
+
+	/**
+	 * Distance from top of glyph to baseline
+	 */
+	uint16_t Ascent;
+
+	/**
+	 * Glyphs count
+	 */
+	uint32_t Count;
+
+	/**
+	 * Glyphs array size
+	 */
+	uint32_t Capacity;
+
+	/**
+	 * Glyphs, sorted by code after Glyphs_Sort()
+	 */
+	Glyphs_GlyphStruct* Glyphs;
+
+	/**
+	 * Kerning pairs count
+	 */
+	uint32_t KerningPairsCount;
+
+	/**
+	 * Kerning pairs array size
+	 */
+	uint32_t KerningPairsCapacity;
+
+	/**
+	 * Kerning pairs, sorted by left code, then by right code after Glyphs_Sort()
+	 */
+	Glyphs_KerningPairStruct* KerningPairs;
+}
+Glyphs_FontStruct;
+
+/**
+ * Which characters to take from source font
+ */
+typedef struct
+{
+	/**
+	 * Mappings count
+	 */
+	uint32_t Count;
+
+	/**
+	 * Mappings array size
+	 */
+	uint32_t Capacity;
+
+	/**
+	 * Code in resulting font
+	 */
+	uint32_t* TargetCodes;
+
+	/**
+	 * Code in source font
+	 */
+	uint32_t* SourceCodes;
+}
+Glyphs_CharactersMapStruct;
+
+/**
+ * Allocate empty glyph for given code (replacing existing one)
+ */
+Glyphs_GlyphStruct* Glyphs_Create(Glyphs_FontStruct* font, uint32_t code, uint16_t width);
+
+/**
+ * Set pixel, pixels outside of glyph are ignored
+ */
+void Glyphs_SetPixel(Glyphs_GlyphStruct* glyph, int32_t x, int32_t y);
+
+/**
+ * Get pixel
+ */
+bool Glyphs_GetPixel(const Glyphs_GlyphStruct* glyph, uint16_t x, uint16_t y);
+
+/**
+ * Create glyph for code 0 (used for characters, missing in font) as a box
+ */
+void Glyphs_CreateMissingCharacterGlyph(Glyphs_FontStruct* font);
+
+/**
+ * Returns true if font contains given code
+ */
+bool Glyphs_IsPresent(const Glyphs_FontStruct* font, uint32_t code);
+
+/**
+ * Add kerning pair
+ */
+void Glyphs_AddKerningPair(Glyphs_FontStruct* font, uint32_t left, uint32_t right, int16_t value);
+
+/**
+ * Keep not more than maxCount kerning pairs, pairs with largest adjustments are kept
+ */
+void Glyphs_LimitKerningPairs(Glyphs_FontStruct* font, uint32_t maxCount);
+
+/**
+ * Sort glyphs and kerning pairs by code
+ */
+void Glyphs_Sort(Glyphs_FontStruct* font);
+
+/**
+ * Free all glyphs and kerning pairs
+ */
+void Glyphs_Free(Glyphs_FontStruct* font);
+
+/**
+ * Add (or replace) target code -> source code mapping
+ */
+void Glyphs_AddMapping(Glyphs_CharactersMapStruct* map, uint32_t targetCode, uint32_t sourceCode);
+
+/**
+ * Free characters map
+ */
+void Glyphs_FreeMap(Glyphs_CharactersMapStruct* map);
+
+#endif /* INCLUDE_GLYPHS_H_ */
@@ -0,0 +1,20 @@
+/*
+ * ttf_reader.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#ifndef INCLUDE_TTF_READER_H_
+#define INCLUDE_TTF_READER_H_
+
+#include "glyphs.h"
+
+/**
+ * Render TrueType / OpenType font (anything FreeType can open) into monochrome glyphs.
+ * charactersMap: target code -> source font code (Unicode)
+ * If isKerning is true, kerning pairs are taken from font 'kern' table (if font has it)
+ */
+void TtfReader_Load(Glyphs_FontStruct* font, const char* path, uint16_t pixelSize, const Glyphs_CharactersMapStruct* charactersMap, bool isKerning);
+
+#endif /* INCLUDE_TTF_READER_H_ */
@@ -0,0 +1,224 @@
+/*
+ * bdf_reader.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include "../include/bdf_reader.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Glyph, being parsed
+ */
+typedef struct
+{
+	int32_t Encoding;
+	int32_t DeviceWidth;
+	int32_t BoxWidth;
+	int32_t BoxHeight;
+	int32_t BoxX;
+	int32_t BoxY;
+}
+BdfReader_CharacterStruct;
+
+/**
+ * Source code -> target code pair
+ */
+typedef struct
+{
+	uint32_t SourceCode;
+	uint32_t TargetCode;
+}
+BdfReader_MappingStruct;
+
+static int BdfReader_CompareMappings(const void* a, const void* b)
+{
+	uint32_t codeA = ((const BdfReader_MappingStruct*)a)->SourceCode;
+	uint32_t codeB = ((const BdfReader_MappingStruct*)b)->SourceCode;
+
+	return (codeA > codeB) - (codeA < codeB);
+}
+
+static bool BdfReader_IsKeyword(const char* line, const char* keyword)
+{
+	size_t length = strlen(keyword);
+	return 0 == strncmp(line, keyword, length) && (line[length] == ' ' || line[length] == '\n' || line[length] == '\r' || line[length] == '\0');
+}
+
+static void BdfReader_Fail(const char* path, uint32_t lineNumber, const char* message)
+{
+	fprintf(stderr, "%s:%u: %s\n", path, lineNumber, message);
+	exit(EXIT_FAILURE);
+}
+
+void BdfReader_Load(Glyphs_FontStruct* font, const char* path, const Glyphs_CharactersMapStruct* charactersMap)
+{
+	FILE* file = fopen(path, "r");
+	if (NULL == file)
+	{
+		fprintf(stderr, "Failed to open font %s\n", path);
+		exit(EXIT_FAILURE);
+	}
+
+	/* Sorting map by source code to quickly find target codes for each BDF character */
+	BdfReader_MappingStruct* mappings = malloc(sizeof(BdfReader_MappingStruct) * (charactersMap->Count + 1));
+	for (uint32_t i = 0; i < charactersMap->Count; i++)
+	{
+		mappings[i].SourceCode = charactersMap->SourceCodes[i];
+		mappings[i].TargetCode = charactersMap->TargetCodes[i];
+	}
+
+	qsort(mappings, charactersMap->Count, sizeof(BdfReader_MappingStruct), BdfReader_CompareMappings);
+
+	char line[BDF_READER_MAX_LINE_LENGTH];
+	uint32_t lineNumber = 0;
+
+	int32_t ascent = -1;
+	int32_t descent = -1;
+	int32_t boundingBoxHeight = 0;
+	int32_t boundingBoxY = 0;
+	bool isHeightKnown = false;
+
+	BdfReader_CharacterStruct character;
+	bool isInCharacter = false;
+
+	while (NULL != fgets(line, sizeof(line), file))
+	{
+		lineNumber ++;
+
+		if (BdfReader_IsKeyword(line, "FONTBOUNDINGBOX"))
+		{
+			int32_t boundingBoxWidth, boundingBoxX;
+			if (4 != sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &boundingBoxWidth, &boundingBoxHeight, &boundingBoxX, &boundingBoxY))
+			{
+				BdfReader_Fail(path, lineNumber, "Malformed FONTBOUNDINGBOX");
+			}
+		}
+		else if (BdfReader_IsKeyword(line, "FONT_ASCENT"))
+		{
+			sscanf(line, "FONT_ASCENT %d", &ascent);
+		}
+		else if (BdfReader_IsKeyword(line, "FONT_DESCENT"))
+		{
+			sscanf(line, "FONT_DESCENT %d", &descent);
+		}
+		else if (BdfReader_IsKeyword(line, "STARTCHAR"))
+		{
+			if (!isHeightKnown)
+			{
+				/* Properties are over, using bounding box if font has no ascent / descent */
+				if (ascent < 0 || descent < 0)
+				{
+					ascent = boundingBoxHeight + boundingBoxY;
+					descent = -boundingBoxY;
+				}
+
+				if (ascent + descent <= 0)
+				{
+					BdfReader_Fail(path, lineNumber, "Can't determine font height");
+				}
+
+				font->Ascent = (uint16_t)ascent;
+				font->Height = (uint16_t)(ascent + descent);
+				isHeightKnown = true;
+			}
+
+			memset(&character, 0, sizeof(character));
+			character.Encoding = -1;
+			isInCharacter = true;
+		}
+		else if (isInCharacter && BdfReader_IsKeyword(line, "ENCODING"))
+		{
+			sscanf(line, "ENCODING %d", &character.Encoding);
+		}
+		else if (isInCharacter && BdfReader_IsKeyword(line, "DWIDTH"))
+		{
+			sscanf(line, "DWIDTH %d", &character.DeviceWidth);
+		}
+		else if (isInCharacter && BdfReader_IsKeyword(line, "BBX"))
+		{
+			if (4 != sscanf(line, "BBX %d %d %d %d", &character.BoxWidth, &character.BoxHeight, &character.BoxX, &character.BoxY))
+			{
+				BdfReader_Fail(path, lineNumber, "Malformed BBX");
+			}
+		}
+		else if (isInCharacter && BdfReader_IsKeyword(line, "BITMAP"))
+		{
+			isInCharacter = false;
+
+			/* Reading rows even if character is not needed to keep line numbers in sync */
+			int32_t left = character.BoxX > 0 ? character.BoxX : 0;
+			int32_t top = ascent - (character.BoxHeight + character.BoxY);
+			int32_t width = character.DeviceWidth;
+			if (left + character.BoxWidth > width)
+			{
+				width = left + character.BoxWidth;
+			}
+
+			uint32_t rowBytes = (uint32_t)(character.BoxWidth + 7) / 8;
+			uint8_t* rows = calloc((size_t)rowBytes * (size_t)character.BoxHeight + 1, 1);
+
+			for (int32_t y = 0; y < character.BoxHeight; y++)
+			{
+				if (NULL == fgets(line, sizeof(line), file))
+				{
+					BdfReader_Fail(path, lineNumber, "Unexpected end of file in BITMAP");
+				}
+
+				lineNumber ++;
+
+				for (uint32_t byte = 0; byte < rowBytes; byte++)
+				{
+					unsigned int value;
+					if (1 != sscanf(&line[byte * 2], "%2x", &value))
+					{
+						BdfReader_Fail(path, lineNumber, "Malformed BITMAP row");
+					}
+
+					rows[y * rowBytes + byte] = (uint8_t)value;
+				}
+			}
+
+			/* Putting bitmap to all target codes, mapped to this encoding */
+			BdfReader_MappingStruct key = { (uint32_t)character.Encoding, 0 };
+			BdfReader_MappingStruct* mapping = (character.Encoding < 0)
+				? NULL
+				: bsearch(&key, mappings, charactersMap->Count, sizeof(BdfReader_MappingStruct), BdfReader_CompareMappings);
+
+			/* bsearch() may return any of equal items, moving to first one */
+			while (NULL != mapping && mapping > mappings && (mapping - 1)->SourceCode == key.SourceCode)
+			{
+				mapping --;
+			}
+
+			for (; NULL != mapping && mapping < mappings + charactersMap->Count && mapping->SourceCode == key.SourceCode; mapping++)
+			{
+				Glyphs_GlyphStruct* glyph = Glyphs_Create(font, mapping->TargetCode, (uint16_t)width);
+
+				for (int32_t y = 0; y < character.BoxHeight; y++)
+				{
+					for (int32_t x = 0; x < character.BoxWidth; x++)
+					{
+						if (0 != (rows[y * rowBytes + x / 8] & (0x80 >> (x % 8))))
+						{
+							Glyphs_SetPixel(glyph, left + x, top + y);
+						}
+					}
+				}
+			}
+
+			free(rows);
+		}
+	}
+
+	fclose(file);
+	free(mappings);
+
+	if (!isHeightKnown)
+	{
+		BdfReader_Fail(path, lineNumber, "Font has no characters");
+	}
+}
@@ -0,0 +1,306 @@
+/*
+ * fmgl_font_writer.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include "../include/fmgl_font_writer.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Glyph raster, ready to be written
+ */
+typedef struct
+{
+	uint32_t Code;
+	uint16_t Width;
+	uint16_t Height;
+	uint32_t Size;
+	uint16_t Flags;
+	uint8_t* Data;
+}
+FmglFontWriter_RasterStruct;
+
+static void FmglFontWriter_WriteBytes(FILE* file, const void* data, size_t size)
+{
+	if (size != fwrite(data, 1, size, file))
+	{
+		fprintf(stderr, "Write failed\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+/* File is always little-endian, regardless of host */
+static void FmglFontWriter_WriteUInt32(FILE* file, uint32_t value)
+{
+	uint8_t bytes[4] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) };
+	FmglFontWriter_WriteBytes(file, bytes, sizeof(bytes));
+}
+
+static void FmglFontWriter_WriteUInt16(FILE* file, uint16_t value)
+{
+	uint8_t bytes[2] = { (uint8_t)value, (uint8_t)(value >> 8) };
+	FmglFontWriter_WriteBytes(file, bytes, sizeof(bytes));
+}
+
+static FmglFontWriter_RasterStruct FmglFontWriter_MakeRaster(const Glyphs_GlyphStruct* glyph, uint32_t code, bool isMSBFirst)
+{
+	FmglFontWriter_RasterStruct raster;
+	raster.Code = code;
+	raster.Width = glyph->Width;
+	raster.Height = glyph->Height;
+	raster.Flags = 0;
+
+	uint32_t rowBytes = (glyph->Width + 7U) / 8U;
+	raster.Size = rowBytes * glyph->Height;
+	raster.Data = calloc(raster.Size + raster.Size / FMGL_FONT_WRITER_RLE_MAX_LITERALS + 1, 1);
+
+	for (uint16_t y = 0; y < glyph->Height; y++)
+	{
+		for (uint16_t x = 0; x < glyph->Width; x++)
+		{
+			if (Glyphs_GetPixel(glyph, x, y))
+			{
+				raster.Data[y * rowBytes + x / 8] |= isMSBFirst ? (uint8_t)(0x80 >> (x % 8)) : (uint8_t)(1 << (x % 8));
+			}
+		}
+	}
+
+	return raster;
+}
+
+uint32_t FmglFontWriter_PackRle(const uint8_t* source, uint32_t size, uint8_t* destination)
+{
+	uint32_t in = 0;
+	uint32_t out = 0;
+
+	while (in < size)
+	{
+		/* Repeat run? */
+		uint32_t repeat = 1;
+		while (in + repeat < size && source[in + repeat] == source[in] && repeat < FMGL_FONT_WRITER_RLE_MAX_REPEAT)
+		{
+			repeat ++;
+		}
+
+		if (repeat >= FMGL_FONT_WRITER_RLE_MIN_REPEAT)
+		{
+			destination[out++] = (uint8_t)(FMGL_FONT_WRITER_RLE_REPEAT_FLAG | (repeat - FMGL_FONT_WRITER_RLE_MIN_REPEAT));
+			destination[out++] = source[in];
+			in += repeat;
+			continue;
+		}
+
+		/* Literals till next repeat run */
+		uint32_t literals = 1;
+		while (in + literals < size && literals < FMGL_FONT_WRITER_RLE_MAX_LITERALS)
+		{
+			if (in + literals + 1 < size && source[in + literals] == source[in + literals + 1])
+			{
+				break;
+			}
+
+			literals ++;
+		}
+
+		destination[out++] = (uint8_t)(literals - 1);
+		memcpy(&destination[out], &source[in], literals);
+		out += literals;
+		in += literals;
+	}
+
+	return out;
+}
+
+static void FmglFontWriter_WriteV1(FILE* file, FmglFontWriter_RasterStruct* rasters, uint32_t count)
+{
+	/* Characters table, offsets are from file beginning */
+	uint32_t offset = 16 + 8 * count;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		FmglFontWriter_WriteUInt32(file, rasters[i].Code);
+		FmglFontWriter_WriteUInt32(file, offset);
+
+		offset += 12 + rasters[i].Size;
+	}
+
+	/* Characters data */
+	for (uint32_t i = 0; i < count; i++)
+	{
+		FmglFontWriter_WriteUInt32(file, rasters[i].Width);
+		FmglFontWriter_WriteUInt32(file, rasters[i].Height);
+		FmglFontWriter_WriteUInt32(file, rasters[i].Size);
+		FmglFontWriter_WriteBytes(file, rasters[i].Data, rasters[i].Size);
+	}
+}
+
+static void FmglFontWriter_WriteV2(FILE* file, FmglFontWriter_RasterStruct* rasters, uint32_t count, bool isRle)
+{
+	if (isRle)
+	{
+		uint8_t* packed = malloc(UINT16_MAX * 2);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			uint32_t packedSize = FmglFontWriter_PackRle(rasters[i].Data, rasters[i].Size, packed);
+			if (packedSize < rasters[i].Size)
+			{
+				memcpy(rasters[i].Data, packed, packedSize);
+				rasters[i].Size = packedSize;
+				rasters[i].Flags |= FMGL_FONT_WRITER_GLYPH_FLAG_RLE;
+			}
+		}
+
+		free(packed);
+	}
+
+	/* Rasters block layout */
+	uint32_t* offsets = malloc(sizeof(uint32_t) * count);
+	uint32_t rastersSize = 0;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (rasters[i].Size > UINT16_MAX)
+		{
+			fprintf(stderr, "Character %u raster is too big\n", rasters[i].Code);
+			exit(EXIT_FAILURE);
+		}
+
+		offsets[i] = rastersSize;
+		rastersSize += (rasters[i].Size + FMGL_FONT_WRITER_RASTER_ALIGNMENT - 1) / FMGL_FONT_WRITER_RASTER_ALIGNMENT * FMGL_FONT_WRITER_RASTER_ALIGNMENT;
+	}
+
+	FmglFontWriter_WriteUInt32(file, rastersSize);
+
+	/* Metrics block */
+	for (uint32_t i = 0; i < count; i++)
+	{
+		FmglFontWriter_WriteUInt32(file, rasters[i].Code);
+		FmglFontWriter_WriteUInt32(file, offsets[i]);
+		FmglFontWriter_WriteUInt16(file, (uint16_t)rasters[i].Size);
+		FmglFontWriter_WriteUInt16(file, rasters[i].Flags);
+		FmglFontWriter_WriteUInt16(file, rasters[i].Width);
+		FmglFontWriter_WriteUInt16(file, rasters[i].Height);
+	}
+
+	/* Rasters block */
+	static const uint8_t padding[FMGL_FONT_WRITER_RASTER_ALIGNMENT] = { 0 };
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		FmglFontWriter_WriteBytes(file, rasters[i].Data, rasters[i].Size);
+
+		uint32_t next = (i + 1 < count) ? offsets[i + 1] : rastersSize;
+		FmglFontWriter_WriteBytes(file, padding, next - offsets[i] - rasters[i].Size);
+	}
+
+	free(offsets);
+}
+
+static void FmglFontWriter_WriteKerningV2(FILE* file, const Glyphs_FontStruct* font)
+{
+	/* No block at all for fonts without kerning, so such files are the same as before kerning was introduced */
+	if (0 == font->KerningPairsCount)
+	{
+		return;
+	}
+
+	FmglFontWriter_WriteUInt32(file, font->KerningPairsCount);
+
+	for (uint32_t i = 0; i < font->KerningPairsCount; i++)
+	{
+		const Glyphs_KerningPairStruct* pair = &font->KerningPairs[i];
+
+		FmglFontWriter_WriteUInt32(file, pair->Left);
+		FmglFontWriter_WriteUInt32(file, pair->Right);
+		FmglFontWriter_WriteUInt16(file, (uint16_t)pair->Value);
+		FmglFontWriter_WriteUInt16(file, 0); /* Reserved */
+	}
+}
+
+void FmglFontWriter_Write(Glyphs_FontStruct* font, const char* path, uint32_t version, bool isRle)
+{
+	Glyphs_Sort(font);
+
+	if (0 == font->Count || 0 != font->Glyphs[0].Code)
+	{
+		fprintf(stderr, "Font must contain character with code 0\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (font->Count > GLYPHS_MAX_GLYPHS_COUNT)
+	{
+		fprintf(stderr, "Too many characters, font can contain at most %u\n", GLYPHS_MAX_GLYPHS_COUNT);
+		exit(EXIT_FAILURE);
+	}
+
+	/* Pairs for characters, which are not in font, are useless */
+	uint32_t kerningPairsCount = 0;
+	for (uint32_t i = 0; i < font->KerningPairsCount; i++)
+	{
+		if (Glyphs_IsPresent(font, font->KerningPairs[i].Left) && Glyphs_IsPresent(font, font->KerningPairs[i].Right))
+		{
+			font->KerningPairs[kerningPairsCount] = font->KerningPairs[i];
+			kerningPairsCount ++;
+		}
+	}
+
+	font->KerningPairsCount = kerningPairsCount;
+
+	FmglFontWriter_RasterStruct* rasters = malloc(sizeof(FmglFontWriter_RasterStruct) * font->Count);
+	uint32_t count = font->Count;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		const Glyphs_GlyphStruct* glyph = &font->Glyphs[i];
+
+		if (glyph->Width > UINT8_MAX || glyph->Height > UINT8_MAX)
+		{
+			fprintf(stderr, "Character %u is too big (%ux%u)\n", glyph->Code, glyph->Width, glyph->Height);
+			exit(EXIT_FAILURE);
+		}
+
+		rasters[i] = FmglFontWriter_MakeRaster(glyph, glyph->Code, FMGL_FONT_WRITER_VERSION_2 == version);
+	}
+
+	FILE* file = fopen(path, "wb");
+	if (NULL == file)
+	{
+		fprintf(stderr, "Failed to create %s\n", path);
+		exit(EXIT_FAILURE);
+	}
+
+	/* Common header */
+	FmglFontWriter_WriteBytes(file, "FMGLFONT", 8);
+	FmglFontWriter_WriteUInt32(file, version);
+	FmglFontWriter_WriteUInt32(file, count);
+
+	switch (version)
+	{
+		case FMGL_FONT_WRITER_VERSION_1:
+			FmglFontWriter_WriteV1(file, rasters, count);
+			break;
+
+		case FMGL_FONT_WRITER_VERSION_2:
+			FmglFontWriter_WriteV2(file, rasters, count, isRle);
+			FmglFontWriter_WriteKerningV2(file, font);
+			break;
+
+		default:
+			fprintf(stderr, "Unsupported version %u\n", version);
+			exit(EXIT_FAILURE);
+	}
+
+	fclose(file);
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		free(rasters[i].Data);
+	}
+
+	free(rasters);
+}
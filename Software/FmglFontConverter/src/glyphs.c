@@ -0,0 +1,237 @@
+/*
+ * glyphs.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include "../include/glyphs.h"
+#include <stdlib.h>
+#include <stdio.h>
+
+static void* Glyphs_Realloc(void* pointer, size_t size)
+{
+	void* result = realloc(pointer, size);
+	if (NULL == result)
+	{
+		fprintf(stderr, "Out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+
+	return result;
+}
+
+static Glyphs_GlyphStruct* Glyphs_Find(Glyphs_FontStruct* font, uint32_t code)
+{
+	for (uint32_t i = 0; i < font->Count; i++)
+	{
+		if (font->Glyphs[i].Code == code)
+		{
+			return &font->Glyphs[i];
+		}
+	}
+
+	return NULL;
+}
+
+Glyphs_GlyphStruct* Glyphs_Create(Glyphs_FontStruct* font, uint32_t code, uint16_t width)
+{
+	if (code > GLYPHS_MAX_CODE_POINT)
+	{
+		fprintf(stderr, "Character code %u is too big\n", code);
+		exit(EXIT_FAILURE);
+	}
+
+	Glyphs_GlyphStruct* glyph = Glyphs_Find(font, code);
+
+	if (NULL != glyph)
+	{
+		free(glyph->Pixels);
+	}
+	else
+	{
+		if (font->Count == font->Capacity)
+		{
+			font->Capacity = 0 == font->Capacity ? 256 : font->Capacity * 2;
+			font->Glyphs = Glyphs_Realloc(font->Glyphs, sizeof(Glyphs_GlyphStruct) * font->Capacity);
+		}
+
+		glyph = &font->Glyphs[font->Count];
+		font->Count ++;
+	}
+
+	glyph->Code = code;
+	glyph->Width = width;
+	glyph->Height = font->Height;
+	glyph->Pixels = calloc((size_t)width * font->Height + 1, 1); /* +1 to never get NULL for empty glyphs */
+	if (NULL == glyph->Pixels)
+	{
+		fprintf(stderr, "Out of memory\n");
+		exit(EXIT_FAILURE);
+	}
+
+	return glyph;
+}
+
+void Glyphs_SetPixel(Glyphs_GlyphStruct* glyph, int32_t x, int32_t y)
+{
+	if (x < 0 || y < 0 || x >= glyph->Width || y >= glyph->Height)
+	{
+		return;
+	}
+
+	glyph->Pixels[y * glyph->Width + x] = 1;
+}
+
+bool Glyphs_GetPixel(const Glyphs_GlyphStruct* glyph, uint16_t x, uint16_t y)
+{
+	return 0 != glyph->Pixels[y * glyph->Width + x];
+}
+
+void Glyphs_CreateMissingCharacterGlyph(Glyphs_FontStruct* font)
+{
+	uint16_t width = font->Height / 2;
+	if (width < 3)
+	{
+		width = 3;
+	}
+
+	Glyphs_GlyphStruct* glyph = Glyphs_Create(font, 0, width);
+
+	/* Box with one pixel margin */
+	int32_t left = 1;
+	int32_t right = width - 2;
+	int32_t top = 1;
+	int32_t bottom = font->Height - 2;
+
+	for (int32_t x = left; x <= right; x++)
+	{
+		Glyphs_SetPixel(glyph, x, top);
+		Glyphs_SetPixel(glyph, x, bottom);
+	}
+
+	for (int32_t y = top; y <= bottom; y++)
+	{
+		Glyphs_SetPixel(glyph, left, y);
+		Glyphs_SetPixel(glyph, right, y);
+	}
+}
+
+bool Glyphs_IsPresent(const Glyphs_FontStruct* font, uint32_t code)
+{
+	return NULL != Glyphs_Find((Glyphs_FontStruct*)font, code);
+}
+
+static int Glyphs_CompareCodes(const void* a, const void* b)
+{
+	uint32_t codeA = ((const Glyphs_GlyphStruct*)a)->Code;
+	uint32_t codeB = ((const Glyphs_GlyphStruct*)b)->Code;
+
+	return (codeA > codeB) - (codeA < codeB);
+}
+
+void Glyphs_AddKerningPair(Glyphs_FontStruct* font, uint32_t left, uint32_t right, int16_t value)
+{
+	if (font->KerningPairsCount == font->KerningPairsCapacity)
+	{
+		font->KerningPairsCapacity = 0 == font->KerningPairsCapacity ? 256 : font->KerningPairsCapacity * 2;
+		font->KerningPairs = Glyphs_Realloc(font->KerningPairs, sizeof(Glyphs_KerningPairStruct) * font->KerningPairsCapacity);
+	}
+
+	Glyphs_KerningPairStruct* pair = &font->KerningPairs[font->KerningPairsCount];
+	pair->Left = left;
+	pair->Right = right;
+	pair->Value = value;
+
+	font->KerningPairsCount ++;
+}
+
+static int Glyphs_CompareKerningPairs(const void* a, const void* b)
+{
+	const Glyphs_KerningPairStruct* pairA = (const Glyphs_KerningPairStruct*)a;
+	const Glyphs_KerningPairStruct* pairB = (const Glyphs_KerningPairStruct*)b;
+
+	if (pairA->Left != pairB->Left)
+	{
+		return (pairA->Left > pairB->Left) - (pairA->Left < pairB->Left);
+	}
+
+	return (pairA->Right > pairB->Right) - (pairA->Right < pairB->Right);
+}
+
+static int Glyphs_CompareKerningValues(const void* a, const void* b)
+{
+	int32_t valueA = abs(((const Glyphs_KerningPairStruct*)a)->Value);
+	int32_t valueB = abs(((const Glyphs_KerningPairStruct*)b)->Value);
+
+	/* Descending */
+	return (valueA < valueB) - (valueA > valueB);
+}
+
+void Glyphs_LimitKerningPairs(Glyphs_FontStruct* font, uint32_t maxCount)
+{
+	if (font->KerningPairsCount <= maxCount)
+	{
+		return;
+	}
+
+	qsort(font->KerningPairs, font->KerningPairsCount, sizeof(Glyphs_KerningPairStruct), Glyphs_CompareKerningValues);
+	font->KerningPairsCount = maxCount;
+}
+
+void Glyphs_Sort(Glyphs_FontStruct* font)
+{
+	qsort(font->Glyphs, font->Count, sizeof(Glyphs_GlyphStruct), Glyphs_CompareCodes);
+	qsort(font->KerningPairs, font->KerningPairsCount, sizeof(Glyphs_KerningPairStruct), Glyphs_CompareKerningPairs);
+}
+
+void Glyphs_Free(Glyphs_FontStruct* font)
+{
+	for (uint32_t i = 0; i < font->Count; i++)
+	{
+		free(font->Glyphs[i].Pixels);
+	}
+
+	free(font->Glyphs);
+	font->Glyphs = NULL;
+	font->Count = 0;
+	font->Capacity = 0;
+
+	free(font->KerningPairs);
+	font->KerningPairs = NULL;
+	font->KerningPairsCount = 0;
+	font->KerningPairsCapacity = 0;
+}
+
+void Glyphs_AddMapping(Glyphs_CharactersMapStruct* map, uint32_t targetCode, uint32_t sourceCode)
+{
+	for (uint32_t i = 0; i < map->Count; i++)
+	{
+		if (map->TargetCodes[i] == targetCode)
+		{
+			map->SourceCodes[i] = sourceCode;
+			return;
+		}
+	}
+
+	if (map->Count == map->Capacity)
+	{
+		map->Capacity = 0 == map->Capacity ? 256 : map->Capacity * 2;
+		map->TargetCodes = Glyphs_Realloc(map->TargetCodes, sizeof(uint32_t) * map->Capacity);
+		map->SourceCodes = Glyphs_Realloc(map->SourceCodes, sizeof(uint32_t) * map->Capacity);
+	}
+
+	map->TargetCodes[map->Count] = targetCode;
+	map->SourceCodes[map->Count] = sourceCode;
+	map->Count ++;
+}
+
+void Glyphs_FreeMap(Glyphs_CharactersMapStruct* map)
+{
+	free(map->TargetCodes);
+	free(map->SourceCodes);
+	map->TargetCodes = NULL;
+	map->SourceCodes = NULL;
+	map->Count = 0;
+	map->Capacity = 0;
+}
@@ -0,0 +1,220 @@
+/*
+ * main.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * Converts TrueType / OpenType (via FreeType) and BDF fonts to FMGL loadable fonts (.fmglfont)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include "../include/glyphs.h"
+#include "../include/ttf_reader.h"
+#include "../include/bdf_reader.h"
+#include "../include/fmgl_font_writer.h"
+
+/**
+ * Default characters ranges (printable ASCII)
+ */
+#define MAIN_DEFAULT_CHARACTERS "0x20-0x7E"
+
+/**
+ * Firmware loads not more than this number of kerning pairs by default (FMGL_LOADABLE_FONT_MAX_KERNING_PAIRS)
+ */
+#define MAIN_DEFAULT_KERNING_PAIRS 128U
+
+static void PrintUsage(const char* name)
+{
+	fprintf(stderr,
+		"Usage: %s -i input.(ttf|otf|bdf) -o output.fmglfont [options]\n"
+		"  -s size       Pixel size for TrueType / OpenType fonts (default 32)\n"
+		"  -v version    Output format version, 1 or 2 (default 2)\n"
+		"  -r            RLE-pack version 2 rasters when it makes them smaller\n"
+		"  -k count      Take up to count kerning pairs (largest adjustments first) from TrueType / OpenType 'kern' table,\n"
+		"                version 2 only. Firmware loads %u pairs by default\n"
+		"  -c ranges     Unicode code points to include, e.g. 0x20-0x7E,0xB0,0x410-0x44F (default %s). May be repeated\n"
+		"  -m to=from    Put source character 'from' at code 'to', e.g. -m 0x2103=0xB0. May be repeated\n"
+		"Character with code 0 is generated as a box and is shown instead of missing characters.\n",
+		name, MAIN_DEFAULT_KERNING_PAIRS, MAIN_DEFAULT_CHARACTERS);
+}
+
+static uint32_t ParseCode(const char* value, char** end)
+{
+	unsigned long code = strtoul(value, end, 0);
+	if (*end == value || code > GLYPHS_MAX_CODE_POINT)
+	{
+		fprintf(stderr, "Invalid character code %s\n", value);
+		exit(EXIT_FAILURE);
+	}
+
+	return (uint32_t)code;
+}
+
+static void ParseRanges(Glyphs_CharactersMapStruct* map, const char* ranges)
+{
+	const char* position = ranges;
+
+	while ('\0' != *position)
+	{
+		char* end;
+		uint32_t first = ParseCode(position, &end);
+		uint32_t last = first;
+
+		if ('-' == *end)
+		{
+			last = ParseCode(end + 1, &end);
+		}
+
+		if (last < first || (',' != *end && '\0' != *end))
+		{
+			fprintf(stderr, "Invalid characters range %s\n", ranges);
+			exit(EXIT_FAILURE);
+		}
+
+		for (uint32_t code = first; code <= last; code++)
+		{
+			Glyphs_AddMapping(map, code, code);
+		}
+
+		position = (',' == *end) ? end + 1 : end;
+	}
+}
+
+static bool IsBdf(const char* path)
+{
+	size_t length = strlen(path);
+	return length > 4 && 0 == strcasecmp(path + length - 4, ".bdf");
+}
+
+int main(int argc, char** argv)
+{
+	const char* inputPath = NULL;
+	const char* outputPath = NULL;
+	uint32_t pixelSize = 32;
+	uint32_t version = FMGL_FONT_WRITER_VERSION_2;
+	bool isRle = false;
+	uint32_t kerningPairsCount = 0;
+	bool isRangesSet = false;
+
+	/* Target code -> source code */
+	Glyphs_CharactersMapStruct charactersMap = { 0 };
+	Glyphs_CharactersMapStruct extraMap = { 0 };
+
+	int option;
+	while (-1 != (option = getopt(argc, argv, "i:o:s:v:rk:c:m:h")))
+	{
+		switch (option)
+		{
+			case 'i':
+				inputPath = optarg;
+				break;
+
+			case 'o':
+				outputPath = optarg;
+				break;
+
+			case 's':
+				pixelSize = (uint32_t)strtoul(optarg, NULL, 0);
+				break;
+
+			case 'v':
+				version = (uint32_t)strtoul(optarg, NULL, 0);
+				break;
+
+			case 'r':
+				isRle = true;
+				break;
+
+			case 'k':
+				kerningPairsCount = (uint32_t)strtoul(optarg, NULL, 0);
+				break;
+
+			case 'c':
+				ParseRanges(&charactersMap, optarg);
+				isRangesSet = true;
+				break;
+
+			case 'm':
+			{
+				char* separator = strchr(optarg, '=');
+				if (NULL == separator)
+				{
+					fprintf(stderr, "Invalid mapping %s, expected to=from\n", optarg);
+					return EXIT_FAILURE;
+				}
+
+				char* end;
+				uint32_t targetCode = ParseCode(optarg, &end);
+				uint32_t sourceCode = ParseCode(separator + 1, &end);
+				Glyphs_AddMapping(&extraMap, targetCode, sourceCode);
+				break;
+			}
+
+			default:
+				PrintUsage(argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+
+	if (NULL == inputPath || NULL == outputPath || 0 == pixelSize || pixelSize > UINT8_MAX
+		|| (FMGL_FONT_WRITER_VERSION_1 != version && FMGL_FONT_WRITER_VERSION_2 != version))
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (isRle && FMGL_FONT_WRITER_VERSION_1 == version)
+	{
+		fprintf(stderr, "RLE is supported only by version 2\n");
+		return EXIT_FAILURE;
+	}
+
+	if (kerningPairsCount > 0 && FMGL_FONT_WRITER_VERSION_1 == version)
+	{
+		fprintf(stderr, "Kerning is supported only by version 2\n");
+		return EXIT_FAILURE;
+	}
+
+	if (!isRangesSet)
+	{
+		ParseRanges(&charactersMap, MAIN_DEFAULT_CHARACTERS);
+	}
+
+	for (uint32_t i = 0; i < extraMap.Count; i++)
+	{
+		Glyphs_AddMapping(&charactersMap, extraMap.TargetCodes[i], extraMap.SourceCodes[i]);
+	}
+
+	Glyphs_FontStruct font = { 0 };
+
+	if (IsBdf(inputPath))
+	{
+		BdfReader_Load(&font, inputPath, &charactersMap);
+	}
+	else
+	{
+		TtfReader_Load(&font, inputPath, (uint16_t)pixelSize, &charactersMap, kerningPairsCount > 0);
+	}
+
+	Glyphs_CreateMissingCharacterGlyph(&font); /* Always generated, even if requested */
+
+	Glyphs_LimitKerningPairs(&font, kerningPairsCount);
+
+	if (!Glyphs_IsPresent(&font, ' '))
+	{
+		/* Firmware uses space height as font height */
+		fprintf(stderr, "Warning: font has no space character\n");
+	}
+
+	FmglFontWriter_Write(&font, outputPath, version, isRle);
+
+	Glyphs_Free(&font);
+	Glyphs_FreeMap(&charactersMap);
+	Glyphs_FreeMap(&extraMap);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/*
+ * ttf_reader.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include "../include/ttf_reader.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+static void TtfReader_LoadKerning(Glyphs_FontStruct* font, FT_Face face, const uint32_t* codes, const FT_UInt* glyphIndexes, uint32_t count)
+{
+	if (!FT_HAS_KERNING(face))
+	{
+		fprintf(stderr, "Warning: font has no kerning table\n");
+		return;
+	}
+
+	for (uint32_t left = 0; left < count; left++)
+	{
+		for (uint32_t right = 0; right < count; right++)
+		{
+			FT_Vector delta;
+			if (0 != FT_Get_Kerning(face, glyphIndexes[left], glyphIndexes[right], FT_KERNING_DEFAULT, &delta))
+			{
+				continue;
+			}
+
+			/* 26.6 fixed point -> pixels, rounding to nearest */
+			int32_t value = (int32_t)((delta.x + 32) >> 6);
+			if (0 != value)
+			{
+				Glyphs_AddKerningPair(font, codes[left], codes[right], (int16_t)value);
+			}
+		}
+	}
+}
+
+void TtfReader_Load(Glyphs_FontStruct* font, const char* path, uint16_t pixelSize, const Glyphs_CharactersMapStruct* charactersMap, bool isKerning)
+{
+	FT_Library library;
+	FT_Face face;
+
+	if (0 != FT_Init_FreeType(&library))
+	{
+		fprintf(stderr, "Failed to initialize FreeType\n");
+		exit(EXIT_FAILURE);
+	}
+
+	if (0 != FT_New_Face(library, path, 0, &face))
+	{
+		fprintf(stderr, "Failed to open font %s\n", path);
+		exit(EXIT_FAILURE);
+	}
+
+	if (0 != FT_Set_Pixel_Sizes(face, 0, pixelSize))
+	{
+		fprintf(stderr, "Font %s can't be rendered at %u pixels\n", path, pixelSize);
+		exit(EXIT_FAILURE);
+	}
+
+	/* 26.6 fixed point -> pixels */
+	int32_t ascent = (int32_t)((face->size->metrics.ascender + 63) >> 6);
+	int32_t descent = (int32_t)((-face->size->metrics.descender + 63) >> 6);
+
+	font->Ascent = (uint16_t)ascent;
+	font->Height = (uint16_t)(ascent + descent);
+
+	/* Rendered characters, for kerning */
+	uint32_t* codes = malloc(sizeof(uint32_t) * (charactersMap->Count + 1));
+	FT_UInt* glyphIndexes = malloc(sizeof(FT_UInt) * (charactersMap->Count + 1));
+	uint32_t renderedCount = 0;
+
+	for (uint32_t i = 0; i < charactersMap->Count; i++)
+	{
+		uint32_t code = charactersMap->TargetCodes[i];
+		uint32_t sourceCode = charactersMap->SourceCodes[i];
+
+		FT_UInt glyphIndex = FT_Get_Char_Index(face, sourceCode);
+		if (0 == glyphIndex)
+		{
+			bool isControl = sourceCode < 0x20 || (sourceCode >= 0x7F && sourceCode <= 0x9F);
+			if (!isControl)
+			{
+				fprintf(stderr, "Warning: no glyph for U+%04X, skipping\n", sourceCode);
+			}
+
+			continue;
+		}
+
+		if (0 != FT_Load_Glyph(face, glyphIndex, FT_LOAD_RENDER | FT_LOAD_MONOCHROME | FT_LOAD_TARGET_MONO))
+		{
+			fprintf(stderr, "Failed to render U+%04X\n", sourceCode);
+			exit(EXIT_FAILURE);
+		}
+
+		FT_GlyphSlot slot = face->glyph;
+		FT_Bitmap* bitmap = &slot->bitmap;
+
+		int32_t left = slot->bitmap_left > 0 ? slot->bitmap_left : 0; /* Negative bearing is clipped */
+		int32_t width = (int32_t)((slot->advance.x + 32) >> 6);
+		if (left + (int32_t)bitmap->width > width)
+		{
+			width = left + (int32_t)bitmap->width;
+		}
+
+		Glyphs_GlyphStruct* glyph = Glyphs_Create(font, code, (uint16_t)width);
+
+		codes[renderedCount] = code;
+		glyphIndexes[renderedCount] = glyphIndex;
+		renderedCount ++;
+
+		int32_t top = ascent - slot->bitmap_top;
+
+		for (uint32_t y = 0; y < bitmap->rows; y++)
+		{
+			const uint8_t* row = bitmap->buffer + (int32_t)y * bitmap->pitch;
+
+			for (uint32_t x = 0; x < bitmap->width; x++)
+			{
+				bool isActive = (FT_PIXEL_MODE_MONO == bitmap->pixel_mode)
+					? 0 != (row[x / 8] & (0x80 >> (x % 8)))
+					: row[x] >= 128;
+
+				if (isActive)
+				{
+					Glyphs_SetPixel(glyph, left + (int32_t)x, top + (int32_t)y);
+				}
+			}
+		}
+	}
+
+	if (isKerning)
+	{
+		TtfReader_LoadKerning(font, face, codes, glyphIndexes, renderedCount);
+	}
+
+	free(codes);
+	free(glyphIndexes);
+
+	FT_Done_Face(face);
+	FT_Done_FreeType(library);
+}
@@ -0,0 +1,40 @@
+/*
+ * benchmarks.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * Rendering throughput benchmarks. Fast paths are compared with FMGL per-pixel drawing, and results of both are
+ * checked to be the same
+ */
+
+#ifndef INCLUDE_BENCHMARKS_H_
+#define INCLUDE_BENCHMARKS_H_
+
+#include <stdbool.h>
+#include "../../../Firmware/Main/libs/l2hal/fmgl/include/fmgl.h"
+#include "host_memory.h"
+
+/**
+ * Each measurement lasts at least this time, seconds
+ */
+#define BENCHMARKS_MIN_TIME 0.2
+
+/**
+ * Monotonic time, seconds
+ */
+double Benchmarks_GetTime(void);
+
+/**
+ * Screen of glyphs, drawn with every display, font, transparency mode and scale, first pixel by pixel, then with
+ * driver bulk operations (byte-wise XBM blit). Prints glyphs per second, returns false if results differ
+ */
+bool Benchmarks_RunGlyphs(HostMemory_ContextStruct* memory, FMGL_API_Font* builtinFont, FMGL_API_Font* loadableFont);
+
+/**
+ * Fill and blit throughput of each FMGL pixel format kernel, compared with reference implementation, which writes
+ * pixels one by one
+ */
+void Benchmarks_RunPixelFormats(void);
+
+#endif /* INCLUDE_BENCHMARKS_H_ */
@@ -0,0 +1,65 @@
+/*
+ * displays.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * Displays under test. Drivers are used as is, only their framebuffers are checked (pushes to display go nowhere)
+ */
+
+#ifndef INCLUDE_DISPLAYS_H_
+#define INCLUDE_DISPLAYS_H_
+
+#include <stdbool.h>
+#include "../../../Firmware/Main/libs/l2hal/fmgl/include/fmgl.h"
+#include "host_memory.h"
+#include "images.h"
+
+/**
+ * Where GC9A01 framebuffers are located in external memory
+ */
+#define DISPLAYS_GC9A01_FRAMEBUFFER_ADDRESS 0x000000U
+#define DISPLAYS_GC9A01_PREVIOUS_FRAMEBUFFER_ADDRESS 0x040000U
+
+/**
+ * Display under test
+ */
+typedef struct
+{
+	/**
+	 * Display name, it is used in images file names
+	 */
+	const char* Name;
+
+	/**
+	 * Captured images are stored in this format
+	 */
+	Images_Format Format;
+
+	/**
+	 * Scenes colors. On monochrome displays accent color is the same as foreground one
+	 */
+	FMGL_API_ColorStruct BackgroundColor;
+	FMGL_API_ColorStruct ForegroundColor;
+	FMGL_API_ColorStruct AccentColor;
+
+	/**
+	 * Initialize driver and attach FMGL to it, drivers which need external memory use given one. If isBulkOperations
+	 * is false, driver bulk operations aren't attached and FMGL draws pixel by pixel
+	 */
+	FMGL_API_DriverContext (*Init)(HostMemory_ContextStruct* memory, bool isBulkOperations);
+
+	/**
+	 * Decode driver framebuffer into new image. It is done without driver help, so GetPixel() could be checked against it
+	 */
+	Images_ImageStruct (*Capture)(void);
+}
+Displays_DisplayStruct;
+
+/**
+ * All displays
+ */
+extern const Displays_DisplayStruct Displays_Displays[];
+extern const uint8_t Displays_Count;
+
+#endif /* INCLUDE_DISPLAYS_H_ */
@@ -0,0 +1,20 @@
+/*
+ * host_hal.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * STM32 HAL stubs for running display drivers on host: transfers are completed immediately, BUSY lines are never
+ * asserted and no time passes in delays
+ */
+
+#ifndef INCLUDE_HOST_HAL_H_
+#define INCLUDE_HOST_HAL_H_
+
+/**
+ * Set function, called right after DMA or interrupt-driven transfer start instead of transfer completion interrupt
+ * handler. Callback could be NULL
+ */
+void HostHal_SetTransferCompletedCallback(void (*callback)(void* context), void* context);
+
+#endif /* INCLUDE_HOST_HAL_H_ */
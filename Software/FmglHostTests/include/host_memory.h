@@ -0,0 +1,50 @@
+/*
+ * host_memory.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * External memory (like LY68L6400 PSRAM) simulation, used by loadable fonts and GC9A01 framebuffer
+ */
+
+#ifndef INCLUDE_HOST_MEMORY_H_
+#define INCLUDE_HOST_MEMORY_H_
+
+#include <stdint.h>
+
+/**
+ * Memory size, the same as LY68L6400 one
+ */
+#define HOST_MEMORY_SIZE 0x800000U
+
+typedef struct
+{
+	/**
+	 * Memory contents
+	 */
+	uint8_t* Data;
+
+	/**
+	 * How many read and write calls were made
+	 */
+	uint32_t ReadsCount;
+	uint32_t WritesCount;
+}
+HostMemory_ContextStruct;
+
+/**
+ * Allocate memory, filled with garbage (as memory chip after power up)
+ */
+HostMemory_ContextStruct HostMemory_Init(void);
+
+/**
+ * Read from memory. Reads outside of memory are fatal. Signature is the same as memory drivers one
+ */
+void HostMemory_Read(void* context, uint32_t address, uint32_t size, uint8_t* buffer);
+
+/**
+ * Write to memory. Writes outside of memory are fatal
+ */
+void HostMemory_Write(void* context, uint32_t address, uint32_t size, uint8_t* buffer);
+
+#endif /* INCLUDE_HOST_MEMORY_H_ */
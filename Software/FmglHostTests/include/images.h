@@ -0,0 +1,84 @@
+/*
+ * images.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * Captured framebuffers and their storage as binary PBM / PGM / PPM files
+ */
+
+#ifndef INCLUDE_IMAGES_H_
+#define INCLUDE_IMAGES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../../Firmware/Main/libs/l2hal/fmgl/include/fmgl.h"
+
+/**
+ * Image file format, it is chosen by display type
+ */
+typedef enum
+{
+	Images_Bitmap, /** PBM, black and white */
+	Images_Greymap, /** PGM, 8 bits per pixel */
+	Images_Pixmap /** PPM, 24 bits per pixel */
+}
+Images_Format;
+
+/**
+ * Image, pixels are always stored as RGB triplets
+ */
+typedef struct
+{
+	uint16_t Width;
+	uint16_t Height;
+
+	Images_Format Format;
+
+	uint8_t* Pixels;
+}
+Images_ImageStruct;
+
+/**
+ * Create black image
+ */
+Images_ImageStruct Images_Create(uint16_t width, uint16_t height, Images_Format format);
+
+/**
+ * Free image pixels
+ */
+void Images_Free(Images_ImageStruct* image);
+
+/**
+ * Set / get pixel color
+ */
+void Images_SetPixel(Images_ImageStruct* image, uint16_t x, uint16_t y, FMGL_API_ColorStruct color);
+FMGL_API_ColorStruct Images_GetPixel(const Images_ImageStruct* image, uint16_t x, uint16_t y);
+
+/**
+ * File name extension (without dot) for given format
+ */
+const char* Images_GetExtension(Images_Format format);
+
+/**
+ * Write image to file. Bitmap pixels are black if they aren't white, greymap pixels take red channel
+ */
+bool Images_Write(const Images_ImageStruct* image, const char* path);
+
+/**
+ * Read image from binary PBM / PGM / PPM file (maximal value must be 255). Returns false if there is no such file
+ * or it can't be parsed
+ */
+bool Images_Read(Images_ImageStruct* image, const char* path);
+
+/**
+ * Count pixels, which differ in given images. Images must have the same sizes
+ */
+uint32_t Images_CountDifferentPixels(const Images_ImageStruct* first, const Images_ImageStruct* second);
+
+/**
+ * Make image, where pixels, which differ in given images, are red and other ones are dimmed first image pixels
+ */
+Images_ImageStruct Images_MakeDifference(const Images_ImageStruct* first, const Images_ImageStruct* second);
+
+#endif /* INCLUDE_IMAGES_H_ */
@@ -0,0 +1,76 @@
+/*
+ * pixel_formats.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * FMGL pixel formats kernels under test. Each kernel is checked against naive pixel by pixel reference implementation
+ */
+
+#ifndef INCLUDE_PIXEL_FORMATS_H_
+#define INCLUDE_PIXEL_FORMATS_H_
+
+#include <stdbool.h>
+#include "../../../Firmware/Main/libs/l2hal/fmgl/include/fmgl.h"
+
+/**
+ * Pixel format
+ */
+typedef struct
+{
+	/**
+	 * Format name
+	 */
+	const char* Name;
+
+	/**
+	 * Bits per pixel. Pixels of formats with less than 8 bits per pixel are packed into bytes, pixels of other formats
+	 * are stored in big endian order
+	 */
+	uint8_t BitsPerPixel;
+
+	/**
+	 * For formats with several pixels per byte: is leftmost pixel stored in most significant bits
+	 */
+	bool IsMSBFirst;
+
+	/**
+	 * Kernels, called with packed values of [0; 2^BitsPerPixel - 1] range
+	 */
+	void (*FillSpan)(uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value);
+
+	void (*Blit)(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+		uint32_t activeValue, uint32_t inactiveValue, FMGL_API_XBMTransparencyMode transparency);
+}
+PixelFormats_FormatStruct;
+
+/**
+ * All formats
+ */
+extern const PixelFormats_FormatStruct PixelFormats_Formats[];
+extern const uint8_t PixelFormats_Count;
+
+/**
+ * Framebuffer line size in bytes
+ */
+uint16_t PixelFormats_GetLineSize(const PixelFormats_FormatStruct* format, uint16_t width);
+
+/**
+ * Reference implementations
+ */
+uint32_t PixelFormats_ReadPixel(const PixelFormats_FormatStruct* format, const uint8_t* line, uint16_t x);
+
+void PixelFormats_WritePixel(const PixelFormats_FormatStruct* format, uint8_t* line, uint16_t x, uint32_t value);
+
+void PixelFormats_ReferenceFillSpan(const PixelFormats_FormatStruct* format, uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value);
+
+void PixelFormats_ReferenceBlit(const PixelFormats_FormatStruct* format, uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y,
+	FMGL_API_XBMImage* image, uint16_t width, uint16_t height, uint32_t activeValue, uint32_t inactiveValue, FMGL_API_XBMTransparencyMode transparency);
+
+/**
+ * Compare kernels with reference implementations on random framebuffers, spans and images. Prints mismatches,
+ * returns false if there are any
+ */
+bool PixelFormats_Test(void);
+
+#endif /* INCLUDE_PIXEL_FORMATS_H_ */
@@ -0,0 +1,80 @@
+/*
+ * scenes.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * Test scenes. Scene draws one or more frames, each frame is captured and compared with golden image
+ */
+
+#ifndef INCLUDE_SCENES_H_
+#define INCLUDE_SCENES_H_
+
+#include "../../../Firmware/Main/libs/l2hal/fmgl/include/fmgl.h"
+#include "../../../Firmware/Main/libs/l2hal/fmgl/fonts/loadable/include/loadable_font.h"
+#include "../../../Firmware/Main/libs/l2hal/fmgl/layers/include/layers.h"
+#include "displays.h"
+
+/**
+ * Scene drawing context
+ */
+typedef struct
+{
+	/**
+	 * Draw using this FMGL context
+	 */
+	FMGL_API_DriverContext* Fmgl;
+
+	/**
+	 * Display, scene colors are taken from it
+	 */
+	const Displays_DisplayStruct* Display;
+
+	/**
+	 * Builtin (monospaced) font
+	 */
+	FMGL_API_Font* BuiltinFont;
+
+	/**
+	 * Loadable (proportional, with kerning) font and its context
+	 */
+	FMGL_API_Font* LoadableFont;
+	FMGL_LoadableFont_ContextStruct* LoadableFontContext;
+
+	/**
+	 * Off-screen layers storage, scene resets it before use
+	 */
+	FMGL_Layers_StorageStruct* LayersStorage;
+
+	/**
+	 * Called when frame is drawn, could be NULL (when scene is timed)
+	 */
+	void (*FrameCompleted)(void* context);
+	void* FrameCompletedContext;
+}
+Scenes_ContextStruct;
+
+/**
+ * Scene
+ */
+typedef struct
+{
+	/**
+	 * Scene name, it is used in images file names
+	 */
+	const char* Name;
+
+	/**
+	 * Draw scene. Scene must not depend on previous framebuffer contents and previous runs
+	 */
+	void (*Run)(Scenes_ContextStruct* context);
+}
+Scenes_SceneStruct;
+
+/**
+ * All scenes
+ */
+extern const Scenes_SceneStruct Scenes_Scenes[];
+extern const uint8_t Scenes_Count;
+
+#endif /* INCLUDE_SCENES_H_ */
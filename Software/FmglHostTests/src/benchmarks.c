@@ -0,0 +1,330 @@
+/*
+ * benchmarks.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "../include/benchmarks.h"
+#include "../include/displays.h"
+#include "../include/pixel_formats.h"
+
+/**
+ * Glyphs screen is filled with these characters, they are present in both fonts
+ */
+#define BENCHMARKS_FIRST_GLYPH 0x21U
+#define BENCHMARKS_LAST_GLYPH 0x7EU
+
+#define BENCHMARKS_MAX_GLYPHS 4096U
+
+/**
+ * Pixel formats benchmarks framebuffer, blitted image size and distance between images. Images and spans are not
+ * byte-aligned
+ */
+#define BENCHMARKS_FRAMEBUFFER_WIDTH 240U
+#define BENCHMARKS_FRAMEBUFFER_HEIGHT 240U
+#define BENCHMARKS_SPAN_MARGIN 3U
+#define BENCHMARKS_IMAGE_SIZE 16U
+#define BENCHMARKS_IMAGE_STEP 19U
+
+/**
+ * Glyph on glyphs screen
+ */
+typedef struct
+{
+	uint16_t X;
+	uint16_t Y;
+	char Character[2];
+}
+GlyphStruct;
+
+/**
+ * Glyphs screen
+ */
+typedef struct
+{
+	FMGL_API_FontSettings* FontSettings;
+	GlyphStruct Glyphs[BENCHMARKS_MAX_GLYPHS];
+	uint16_t GlyphsCount;
+}
+GlyphsScreenStruct;
+
+double Benchmarks_GetTime(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * Lay glyphs out left to right, top to bottom, until screen is full
+ */
+static void LayOutGlyphs(FMGL_API_DriverContext* fmgl, GlyphsScreenStruct* screen)
+{
+	FMGL_API_Font* font = screen->FontSettings->Font;
+	uint16_t scale = screen->FontSettings->Scale;
+	uint16_t lineHeight = font->Height * scale;
+
+	uint16_t x = 0;
+	uint16_t y = 0;
+	uint8_t character = BENCHMARKS_FIRST_GLYPH;
+
+	screen->GlyphsCount = 0;
+
+	while (screen->GlyphsCount < BENCHMARKS_MAX_GLYPHS)
+	{
+		uint16_t width = font->GetCharacterWidth(font->Context, character) * scale;
+
+		if (x + width > FMGL_API_GetDisplayWidth(fmgl))
+		{
+			x = 0;
+			y += lineHeight;
+		}
+
+		if (y + lineHeight > FMGL_API_GetDisplayHeight(fmgl))
+		{
+			break;
+		}
+
+		GlyphStruct* glyph = &screen->Glyphs[screen->GlyphsCount];
+		glyph->X = x;
+		glyph->Y = y;
+		glyph->Character[0] = (char)character;
+		glyph->Character[1] = '\0';
+		screen->GlyphsCount ++;
+
+		x += width;
+		character = (BENCHMARKS_LAST_GLYPH == character) ? BENCHMARKS_FIRST_GLYPH : (uint8_t)(character + 1);
+	}
+}
+
+static void DrawGlyphs(FMGL_API_DriverContext* fmgl, GlyphsScreenStruct* screen)
+{
+	uint16_t width;
+
+	for (uint16_t i = 0; i < screen->GlyphsCount; i++)
+	{
+		GlyphStruct* glyph = &screen->Glyphs[i];
+		FMGL_API_RenderOneLineDumb(fmgl, screen->FontSettings, glyph->X, glyph->Y, &width, false, glyph->Character);
+	}
+}
+
+/**
+ * Draw glyphs screen once and capture it, then draw it repeatedly for at least BENCHMARKS_MIN_TIME. Returns glyphs
+ * per second
+ */
+static double MeasureGlyphs(const Displays_DisplayStruct* display, HostMemory_ContextStruct* memory, bool isBulkOperations,
+		GlyphsScreenStruct* screen, Images_ImageStruct* image)
+{
+	FMGL_API_DriverContext fmgl = display->Init(memory, isBulkOperations);
+
+	/* Left half is filled, so transparency modes make difference */
+	FMGL_API_SetBlankingColor(&fmgl, display->BackgroundColor);
+	FMGL_API_ClearScreen(&fmgl);
+	FMGL_API_DrawRectangleFilled(&fmgl, 0, 0, FMGL_API_GetDisplayWidth(&fmgl) / 2 - 1, FMGL_API_GetDisplayHeight(&fmgl) - 1,
+		display->AccentColor, display->AccentColor);
+
+	LayOutGlyphs(&fmgl, screen);
+	DrawGlyphs(&fmgl, screen);
+	*image = display->Capture();
+
+	uint32_t glyphsCount = 0;
+	double start = Benchmarks_GetTime();
+	double time;
+
+	do
+	{
+		DrawGlyphs(&fmgl, screen);
+		glyphsCount += screen->GlyphsCount;
+		time = Benchmarks_GetTime() - start;
+	}
+	while (time < BENCHMARKS_MIN_TIME);
+
+	return glyphsCount / time;
+}
+
+bool Benchmarks_RunGlyphs(HostMemory_ContextStruct* memory, FMGL_API_Font* builtinFont, FMGL_API_Font* loadableFont)
+{
+	static const struct
+	{
+		const char* Name;
+		FMGL_API_XBMTransparencyMode Mode;
+	}
+	transparencies[] =
+	{
+		{ "normal", FMGL_XBMTransparencyModeNormal },
+		{ "inactive", FMGL_XBMTransparencyModeTransparentInactive },
+		{ "active", FMGL_XBMTransparencyModeTransparentActive }
+	};
+
+	FMGL_API_Font* fonts[] = { builtinFont, loadableFont };
+	const char* fontsNames[] = { "builtin", "loadable" };
+
+	static const uint16_t scales[] = { 1, 2 };
+
+	static GlyphsScreenStruct screen;
+	bool isPassed = true;
+
+	printf("%-14s %-9s %-9s %5s %14s %14s %8s\n", "Display", "Font", "Mode", "Scale", "Per-pixel, g/s", "Bulk, g/s", "Speedup");
+
+	for (uint8_t displayIndex = 0; displayIndex < Displays_Count; displayIndex++)
+	{
+		const Displays_DisplayStruct* display = &Displays_Displays[displayIndex];
+
+		for (uint8_t fontIndex = 0; fontIndex < sizeof(fonts) / sizeof(fonts[0]); fontIndex++)
+		{
+			for (uint8_t transparencyIndex = 0; transparencyIndex < sizeof(transparencies) / sizeof(transparencies[0]); transparencyIndex++)
+			{
+				for (uint8_t scaleIndex = 0; scaleIndex < sizeof(scales) / sizeof(scales[0]); scaleIndex++)
+				{
+					FMGL_API_ColorStruct fontColor = display->ForegroundColor;
+					FMGL_API_ColorStruct backgroundColor = display->BackgroundColor;
+					FMGL_API_XBMTransparencyMode transparency = transparencies[transparencyIndex].Mode;
+
+					FMGL_API_FontSettings fontSettings;
+					fontSettings.Font = fonts[fontIndex];
+					fontSettings.Scale = scales[scaleIndex];
+					fontSettings.CharactersSpacing = 0;
+					fontSettings.LinesSpacing = 0;
+					fontSettings.FontColor = &fontColor;
+					fontSettings.BackgroundColor = &backgroundColor;
+					fontSettings.Transparency = &transparency;
+
+					screen.FontSettings = &fontSettings;
+
+					Images_ImageStruct perPixelImage;
+					Images_ImageStruct bulkImage;
+					double perPixelRate = MeasureGlyphs(display, memory, false, &screen, &perPixelImage);
+					double bulkRate = MeasureGlyphs(display, memory, true, &screen, &bulkImage);
+
+					printf("%-14s %-9s %-9s %5u %14.0f %14.0f %7.1fx\n", display->Name, fontsNames[fontIndex],
+						transparencies[transparencyIndex].Name, scales[scaleIndex], perPixelRate, bulkRate, bulkRate / perPixelRate);
+
+					uint32_t differentPixelsCount = Images_CountDifferentPixels(&perPixelImage, &bulkImage);
+					if (0 != differentPixelsCount)
+					{
+						printf("    %u pixels drawn with bulk operations differ from drawn pixel by pixel\n", differentPixelsCount);
+						isPassed = false;
+					}
+
+					Images_Free(&perPixelImage);
+					Images_Free(&bulkImage);
+				}
+			}
+		}
+	}
+
+	return isPassed;
+}
+
+/**
+ * Pixel formats benchmark pass, draws whole framebuffer with kernel or with reference implementation. Returns pixels
+ * count
+ */
+typedef uint32_t (*PixelFormatsPassFunctionPtr)(const PixelFormats_FormatStruct* format, bool isReference, uint8_t* framebuffer);
+
+static uint32_t FillPass(const PixelFormats_FormatStruct* format, bool isReference, uint8_t* framebuffer)
+{
+	uint16_t lineSize = PixelFormats_GetLineSize(format, BENCHMARKS_FRAMEBUFFER_WIDTH);
+	uint16_t x1 = BENCHMARKS_SPAN_MARGIN;
+	uint16_t x2 = BENCHMARKS_FRAMEBUFFER_WIDTH - 1 - BENCHMARKS_SPAN_MARGIN;
+	uint32_t value = 1;
+
+	for (uint16_t y = 0; y < BENCHMARKS_FRAMEBUFFER_HEIGHT; y++)
+	{
+		if (isReference)
+		{
+			PixelFormats_ReferenceFillSpan(format, &framebuffer[y * lineSize], x1, x2, value);
+		}
+		else
+		{
+			format->FillSpan(&framebuffer[y * lineSize], x1, x2, value);
+		}
+	}
+
+	return (uint32_t)(x2 - x1 + 1) * BENCHMARKS_FRAMEBUFFER_HEIGHT;
+}
+
+static uint32_t BlitPass(const PixelFormats_FormatStruct* format, bool isReference, uint8_t* framebuffer)
+{
+	static const uint8_t raster[BENCHMARKS_IMAGE_SIZE * BENCHMARKS_IMAGE_SIZE / 8] =
+	{
+		0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3C, 0x3C, 0x38, 0x1C, 0x70, 0x0E, 0x70, 0x0E, 0x7F, 0xFE,
+		0x7F, 0xFE, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x70, 0x0E, 0x00, 0x00
+	};
+
+	FMGL_API_XBMImage image = { BENCHMARKS_IMAGE_SIZE, BENCHMARKS_IMAGE_SIZE, raster, true };
+
+	uint16_t lineSize = PixelFormats_GetLineSize(format, BENCHMARKS_FRAMEBUFFER_WIDTH);
+	uint32_t pixelsCount = 0;
+
+	for (uint16_t y = 0; y + BENCHMARKS_IMAGE_SIZE <= BENCHMARKS_FRAMEBUFFER_HEIGHT; y += BENCHMARKS_IMAGE_STEP)
+	{
+		for (uint16_t x = BENCHMARKS_SPAN_MARGIN; x + BENCHMARKS_IMAGE_SIZE <= BENCHMARKS_FRAMEBUFFER_WIDTH; x += BENCHMARKS_IMAGE_STEP)
+		{
+			if (isReference)
+			{
+				PixelFormats_ReferenceBlit(format, framebuffer, lineSize, x, y, &image, BENCHMARKS_IMAGE_SIZE, BENCHMARKS_IMAGE_SIZE, 1, 0,
+					FMGL_XBMTransparencyModeNormal);
+			}
+			else
+			{
+				format->Blit(framebuffer, lineSize, x, y, &image, BENCHMARKS_IMAGE_SIZE, BENCHMARKS_IMAGE_SIZE, 1, 0,
+					FMGL_XBMTransparencyModeNormal);
+			}
+
+			pixelsCount += BENCHMARKS_IMAGE_SIZE * BENCHMARKS_IMAGE_SIZE;
+		}
+	}
+
+	return pixelsCount;
+}
+
+/**
+ * Repeat pass for at least BENCHMARKS_MIN_TIME. Returns megapixels per second
+ */
+static double MeasurePixels(PixelFormatsPassFunctionPtr pass, const PixelFormats_FormatStruct* format, bool isReference)
+{
+	static uint8_t framebuffer[BENCHMARKS_FRAMEBUFFER_WIDTH * 3 * BENCHMARKS_FRAMEBUFFER_HEIGHT]; /* Largest format is RGB888 */
+
+	uint64_t pixelsCount = 0;
+	double start = Benchmarks_GetTime();
+	double time;
+
+	do
+	{
+		pixelsCount += pass(format, isReference, framebuffer);
+		time = Benchmarks_GetTime() - start;
+	}
+	while (time < BENCHMARKS_MIN_TIME);
+
+	return pixelsCount / time / 1e6;
+}
+
+void Benchmarks_RunPixelFormats(void)
+{
+	printf("%-10s %12s %12s %8s %12s %12s %8s\n", "Format", "Fill, Mpx/s", "Reference", "Speedup", "Blit, Mpx/s", "Reference", "Speedup");
+
+	for (uint8_t formatIndex = 0; formatIndex < PixelFormats_Count; formatIndex++)
+	{
+		const PixelFormats_FormatStruct* format = &PixelFormats_Formats[formatIndex];
+
+		double fillRate = MeasurePixels(&FillPass, format, false);
+		double referenceFillRate = MeasurePixels(&FillPass, format, true);
+
+		printf("%-10s %12.1f %12.1f %7.1fx", format->Name, fillRate, referenceFillRate, fillRate / referenceFillRate);
+
+		if (NULL != format->Blit)
+		{
+			double blitRate = MeasurePixels(&BlitPass, format, false);
+			double referenceBlitRate = MeasurePixels(&BlitPass, format, true);
+
+			printf(" %12.1f %12.1f %7.1fx", blitRate, referenceBlitRate, blitRate / referenceBlitRate);
+		}
+
+		printf("\n");
+	}
+}
@@ -0,0 +1,471 @@
+/*
+ * displays.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include <string.h>
+#include "../include/displays.h"
+#include "../include/host_hal.h"
+#include "../../../Firmware/Main/libs/l2hal/drivers/display/ssd1683/include/ssd1683.h"
+#include "../../../Firmware/Main/libs/l2hal/drivers/display/ssd1306/include/l2hal_ssd1306.h"
+#include "../../../Firmware/Main/libs/l2hal/drivers/display/ssd1327/include/l2hal_ssd1327.h"
+#include "../../../Firmware/Main/libs/l2hal/drivers/display/gc9a01/include/l2hal_gc9a01.h"
+#include "../../../Firmware/Main/libs/l2hal/drivers/display/gc9a01/include/l2hal_gc9a01_private.h"
+#include "../../../Firmware/Main/libs/l2hal/drivers/display/gc9a01_local_framebuffer/include/l2hal_gc9a01_lfb.h"
+
+/**
+ * Colors
+ */
+#define DISPLAYS_BLACK { 0x00, 0x00, 0x00 }
+#define DISPLAYS_WHITE { 0xFF, 0xFF, 0xFF }
+#define DISPLAYS_GREY { 0x60, 0x60, 0x60 }
+#define DISPLAYS_ORANGE { 0xFF, 0xA0, 0x00 }
+
+static SPI_HandleTypeDef SPIHandle;
+static I2C_HandleTypeDef I2CHandle;
+
+static L2HAL_SSD1683_ContextStruct SSD1683Context;
+static uint8_t SSD1683GreyscaleFramebuffer[L2HAL_SSD1683_GREYSCALE_FRAMEBUFFER_SIZE];
+static uint8_t SSD1683GreyscaleWaveform[L2HAL_SSD1683_WAVEFORM_SIZE];
+
+static L2HAL_SSD1306_ContextStruct SSD1306Context;
+static L2HAL_SSD1327_ContextStruct SSD1327Context;
+
+static L2HAL_GC9A01_ContextStruct GC9A01Context;
+static L2HAL_CRCContextStruct CRCContext;
+static HostMemory_ContextStruct* GC9A01Memory;
+
+static L2HAL_GC9A01_LFB_ContextStruct GC9A01LFBContext;
+
+/**
+ * Pushes to display are not simulated
+ */
+static void PushFramebuffer(void* deviceContext)
+{
+	(void)deviceContext;
+}
+
+/**
+ * SSD1683, monochrome mode
+ */
+static void SSD1683TransferCompleted(void* context)
+{
+	L2HAL_SSD1683_MarkDataTransferAsCompleted((L2HAL_SSD1683_ContextStruct*)context);
+}
+
+static void InitSSD1683(FMGL_API_ColorStruct initColor)
+{
+	memset(&SSD1683Context, 0x00, sizeof(SSD1683Context));
+	HostHal_SetTransferCompletedCallback(&SSD1683TransferCompleted, &SSD1683Context);
+
+	L2HAL_SSD1683_RefreshPolicyStruct refreshPolicy;
+	memset(&refreshPolicy, 0x00, sizeof(refreshPolicy));
+
+	L2HAL_SSD1683_Init(&SSD1683Context, &SPIHandle, NULL, 0, NULL, 0, NULL, 0, NULL, 0, initColor, refreshPolicy);
+}
+
+static FMGL_API_DriverContext SSD1683Init(HostMemory_ContextStruct* memory, bool isBulkOperations)
+{
+	(void)memory;
+
+	FMGL_API_ColorStruct white = DISPLAYS_WHITE;
+	InitSSD1683(white);
+
+	FMGL_API_DriverContext context = FMGL_API_AttachToDriver
+	(
+		&SSD1683Context,
+		&L2HAL_SSD1683_GetWidth,
+		&L2HAL_SSD1683_GetHeight,
+		(void (*) (void* deviceContext, FMGL_API_ColorStruct color))&L2HAL_SSD1683_SetActiveColor,
+		(void (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1683_DrawPixel,
+		(FMGL_API_ColorStruct (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1683_GetPixel,
+		&PushFramebuffer,
+		white,
+		(void (*)(void *, FMGL_API_ColorStruct))&L2HAL_SSD1683_ClearFramebuffer
+	);
+
+	if (isBulkOperations)
+	{
+		FMGL_API_AttachBulkOperations
+		(
+			&context,
+			(void (*) (void* deviceContext, uint16_t x1, uint16_t x2, uint16_t y))&L2HAL_SSD1683_FillSpan,
+			(void (*) (void* deviceContext, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2))&L2HAL_SSD1683_FillRect,
+			(void (*) (void* deviceContext, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+				FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency))&L2HAL_SSD1683_BlitMono1bpp
+		);
+	}
+
+	return context;
+}
+
+/**
+ * 1 bit per pixel, MSB first, 1 - white
+ */
+static Images_ImageStruct SSD1683Capture(void)
+{
+	Images_ImageStruct image = Images_Create(L2HAL_SSD1683_DISPLAY_WIDTH, L2HAL_SSD1683_DISPLAY_HEIGHT, Images_Bitmap);
+	FMGL_API_ColorStruct white = DISPLAYS_WHITE;
+	FMGL_API_ColorStruct black = DISPLAYS_BLACK;
+
+	for (uint16_t y = 0; y < L2HAL_SSD1683_DISPLAY_HEIGHT; y++)
+	{
+		for (uint16_t x = 0; x < L2HAL_SSD1683_DISPLAY_WIDTH; x++)
+		{
+			uint8_t pixels = SSD1683Context.Framebuffer[y * L2HAL_SSD1683_DISPLAY_LINE_SIZE + x / 8];
+			Images_SetPixel(&image, x, y, (0 != (pixels & (0x80 >> (x % 8)))) ? white : black);
+		}
+	}
+
+	return image;
+}
+
+/**
+ * SSD1683, greyscale mode
+ */
+static FMGL_API_DriverContext SSD1683GreyscaleInit(HostMemory_ContextStruct* memory, bool isBulkOperations)
+{
+	(void)memory;
+
+	FMGL_API_ColorStruct white = DISPLAYS_WHITE;
+	InitSSD1683(white);
+
+	L2HAL_SSD1683_AttachGreyscaleFramebuffer(&SSD1683Context, SSD1683GreyscaleFramebuffer, SSD1683GreyscaleWaveform);
+
+	FMGL_API_DriverContext context = FMGL_API_AttachToDriver
+	(
+		&SSD1683Context,
+		&L2HAL_SSD1683_GetWidth,
+		&L2HAL_SSD1683_GetHeight,
+		(void (*) (void* deviceContext, FMGL_API_ColorStruct color))&L2HAL_SSD1683_SetGreyscaleActiveColor,
+		(void (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1683_DrawPixelGreyscale,
+		(FMGL_API_ColorStruct (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1683_GetPixelGreyscale,
+		&PushFramebuffer,
+		white,
+		(void (*)(void *, FMGL_API_ColorStruct))&L2HAL_SSD1683_ClearGreyscaleFramebuffer
+	);
+
+	if (isBulkOperations)
+	{
+		FMGL_API_AttachBulkOperations
+		(
+			&context,
+			(void (*) (void* deviceContext, uint16_t x1, uint16_t x2, uint16_t y))&L2HAL_SSD1683_FillSpanGreyscale,
+			NULL,
+			NULL
+		);
+	}
+
+	return context;
+}
+
+/**
+ * 2 bits per pixel, leftmost pixel in most significant bits, 0 - black, 3 - white
+ */
+static Images_ImageStruct SSD1683GreyscaleCapture(void)
+{
+	Images_ImageStruct image = Images_Create(L2HAL_SSD1683_DISPLAY_WIDTH, L2HAL_SSD1683_DISPLAY_HEIGHT, Images_Greymap);
+
+	for (uint16_t y = 0; y < L2HAL_SSD1683_DISPLAY_HEIGHT; y++)
+	{
+		for (uint16_t x = 0; x < L2HAL_SSD1683_DISPLAY_WIDTH; x++)
+		{
+			uint8_t pixels = SSD1683GreyscaleFramebuffer[y * L2HAL_SSD1683_GREYSCALE_LINE_SIZE + x / 4];
+			uint8_t level = (pixels >> (6 - 2 * (x % 4))) & 0x03;
+
+			FMGL_API_ColorStruct color;
+			color.R = level * 0x55;
+			color.G = color.R;
+			color.B = color.R;
+
+			Images_SetPixel(&image, x, y, color);
+		}
+	}
+
+	return image;
+}
+
+/**
+ * SSD1306
+ */
+static void SSD1306TransferCompleted(void* context)
+{
+	L2HAL_SSD1306_InterruptTransferCompleted((L2HAL_SSD1306_ContextStruct*)context);
+}
+
+static FMGL_API_DriverContext SSD1306Init(HostMemory_ContextStruct* memory, bool isBulkOperations)
+{
+	(void)memory;
+
+	memset(&SSD1306Context, 0x00, sizeof(SSD1306Context));
+	HostHal_SetTransferCompletedCallback(&SSD1306TransferCompleted, &SSD1306Context);
+
+	SSD1306Context.I2CHandle = &I2CHandle;
+	L2HAL_SSD1306_DetectDisplay(&SSD1306Context);
+	L2HAL_SSD1306_TurnDisplayOn(&SSD1306Context);
+
+	FMGL_API_ColorStruct black = DISPLAYS_BLACK;
+
+	FMGL_API_DriverContext context = FMGL_API_AttachToDriver
+	(
+		&SSD1306Context,
+		&L2HAL_SSD1306_GetWidth,
+		&L2HAL_SSD1306_GetHeight,
+		(void (*) (void* deviceContext, FMGL_API_ColorStruct color))&L2HAL_SSD1306_SetActiveColor,
+		(void (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1306_DrawPixel,
+		(FMGL_API_ColorStruct (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1306_GetPixel,
+		&PushFramebuffer,
+		black,
+		NULL
+	);
+
+	if (isBulkOperations)
+	{
+		FMGL_API_AttachBulkOperations
+		(
+			&context,
+			(void (*) (void* deviceContext, uint16_t x1, uint16_t x2, uint16_t y))&L2HAL_SSD1306_FillSpan,
+			(void (*) (void* deviceContext, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2))&L2HAL_SSD1306_FillRect,
+			(void (*) (void* deviceContext, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+				FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency))&L2HAL_SSD1306_BlitMono1bpp
+		);
+	}
+
+	return context;
+}
+
+/**
+ * Pages of 8 lines, byte is a column of page, LSB is the top pixel, 1 - lit
+ */
+static Images_ImageStruct SSD1306Capture(void)
+{
+	Images_ImageStruct image = Images_Create(L2HAL_SSD1306_DISPLAY_WIDTH, L2HAL_SSD1306_DISPLAY_HEIGHT, Images_Bitmap);
+	FMGL_API_ColorStruct white = DISPLAYS_WHITE;
+	FMGL_API_ColorStruct black = DISPLAYS_BLACK;
+
+	for (uint16_t y = 0; y < L2HAL_SSD1306_DISPLAY_HEIGHT; y++)
+	{
+		for (uint16_t x = 0; x < L2HAL_SSD1306_DISPLAY_WIDTH; x++)
+		{
+			uint8_t column = SSD1306Context.Framebuffer[(y / 8) * L2HAL_SSD1306_DISPLAY_WIDTH + x];
+			Images_SetPixel(&image, x, y, (0 != (column & (1 << (y % 8)))) ? white : black);
+		}
+	}
+
+	return image;
+}
+
+/**
+ * SSD1327 (in monochrome mode, see L2HAL_SSD1327_MONOCHROME_MODE)
+ */
+static void SSD1327TransferCompleted(void* context)
+{
+	L2HAL_SSD1327_InterruptTransferCompleted((L2HAL_SSD1327_ContextStruct*)context);
+}
+
+static FMGL_API_DriverContext SSD1327Init(HostMemory_ContextStruct* memory, bool isBulkOperations)
+{
+	(void)memory;
+
+	HostHal_SetTransferCompletedCallback(&SSD1327TransferCompleted, &SSD1327Context);
+
+	SSD1327Context = L2HAL_SSD1327_DetectDisplay(&I2CHandle);
+	L2HAL_SSD1327_InitDisplay(&SSD1327Context);
+
+	FMGL_API_ColorStruct black = DISPLAYS_BLACK;
+
+	FMGL_API_DriverContext context = FMGL_API_AttachToDriver
+	(
+		&SSD1327Context,
+		&L2HAL_SSD1327_GetWidth,
+		&L2HAL_SSD1327_GetHeight,
+		(void (*) (void* deviceContext, FMGL_API_ColorStruct color))&L2HAL_SSD1327_SetActiveColor,
+		(void (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1327_DrawPixel,
+		(FMGL_API_ColorStruct (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_SSD1327_GetPixel,
+		&PushFramebuffer,
+		black,
+		NULL
+	);
+
+	if (isBulkOperations)
+	{
+		FMGL_API_AttachBulkOperations
+		(
+			&context,
+			(void (*) (void* deviceContext, uint16_t x1, uint16_t x2, uint16_t y))&L2HAL_SSD1327_FillSpan,
+			(void (*) (void* deviceContext, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2))&L2HAL_SSD1327_FillRect,
+			(void (*) (void* deviceContext, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+				FMGL_API_ColorStruct activeColor, FMGL_API_ColorStruct inactiveColor, FMGL_API_XBMTransparencyMode transparency))&L2HAL_SSD1327_BlitMono1bpp
+		);
+	}
+
+	return context;
+}
+
+/**
+ * 1 bit per pixel, LSB first, 1 - lit
+ */
+static Images_ImageStruct SSD1327Capture(void)
+{
+	Images_ImageStruct image = Images_Create(L2HAL_SSD1327_DISPLAY_WIDTH, L2HAL_SSD1327_DISPLAY_HEIGHT, Images_Bitmap);
+	FMGL_API_ColorStruct white = DISPLAYS_WHITE;
+	FMGL_API_ColorStruct black = DISPLAYS_BLACK;
+
+	for (uint16_t y = 0; y < L2HAL_SSD1327_DISPLAY_HEIGHT; y++)
+	{
+		for (uint16_t x = 0; x < L2HAL_SSD1327_DISPLAY_WIDTH; x++)
+		{
+			uint8_t pixels = SSD1327Context.Framebuffer[y * L2HAL_SSD1327_COMPRESSED_LINE_SIZE + x / 8];
+			Images_SetPixel(&image, x, y, (0 != (pixels & (1 << (x % 8)))) ? white : black);
+		}
+	}
+
+	return image;
+}
+
+/**
+ * GC9A01, framebuffer is in external memory
+ */
+static void GC9A01TransferCompleted(void* context)
+{
+	L2HAL_GC9A01_MarkDataTransferAsCompleted((L2HAL_GC9A01_ContextStruct*)context);
+}
+
+static FMGL_API_DriverContext GC9A01Init(HostMemory_ContextStruct* memory, bool isBulkOperations)
+{
+	/* Driver has no bulk operations */
+	(void)isBulkOperations;
+
+	GC9A01Memory = memory;
+
+	memset(&GC9A01Context, 0x00, sizeof(GC9A01Context));
+	HostHal_SetTransferCompletedCallback(&GC9A01TransferCompleted, &GC9A01Context);
+
+	L2HAL_GC9A01_Init
+	(
+		&GC9A01Context,
+		&SPIHandle,
+		NULL, 0,
+		NULL, 0,
+		NULL, 0,
+		ROTATION_0,
+		memory,
+		&HostMemory_Write,
+		&HostMemory_Read,
+		DISPLAYS_GC9A01_FRAMEBUFFER_ADDRESS,
+		DISPLAYS_GC9A01_PREVIOUS_FRAMEBUFFER_ADDRESS,
+		&CRCContext
+	);
+
+	FMGL_API_ColorStruct black = DISPLAYS_BLACK;
+
+	return FMGL_API_AttachToDriver
+	(
+		&GC9A01Context,
+		&L2HAL_GC9A01_GetWidth,
+		&L2HAL_GC9A01_GetHeight,
+		(void (*) (void* deviceContext, FMGL_API_ColorStruct color))&L2HAL_GC9A01_SetActiveColor,
+		(void (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_GC9A01_DrawPixel,
+		(FMGL_API_ColorStruct (*) (void* deviceContext, uint16_t x, uint16_t y))&L2HAL_GC9A01_GetPixel,
+		&PushFramebuffer,
+		black,
+		NULL
+	);
+}
+
+/**
+ * RGB888, pixels cache is written back to memory first
+ */
+static Images_ImageStruct GC9A01Capture(void)
+{
+	Images_ImageStruct image = Images_Create(L2HAL_GC9A01_DISPLAY_WIDTH, L2HAL_GC9A01_DISPLAY_HEIGHT, Images_Pixmap);
+
+	L2HAL_GC9A01_WriteCacheToFramebuffer(&GC9A01Context);
+
+	for (uint16_t y = 0; y < L2HAL_GC9A01_DISPLAY_HEIGHT; y++)
+	{
+		HostMemory_Read
+		(
+			GC9A01Memory,
+			DISPLAYS_GC9A01_FRAMEBUFFER_ADDRESS + y * L2HAL_GC9A01_DISPLAY_LINE_SIZE,
+			L2HAL_GC9A01_DISPLAY_LINE_SIZE,
+			&image.Pixels[y * L2HAL_GC9A01_DISPLAY_LINE_SIZE]
+		);
+	}
+
+	return image;
+}
+
+/**
+ * GC9A01 with framebuffer in MCU memory. Driver push code is run (over stubbed SPI), so dirty lines and regions are exercised
+ */
+static void GC9A01LFBTransferCompleted(void* context)
+{
+	L2HAL_GC9A01_LFB_MarkDataTransferAsCompleted((L2HAL_GC9A01_LFB_ContextStruct*)context);
+}
+
+static FMGL_API_DriverContext GC9A01LFBInit(HostMemory_ContextStruct* memory, bool isBulkOperations)
+{
+	(void)memory;
+
+	memset(&GC9A01LFBContext, 0x00, sizeof(GC9A01LFBContext));
+	HostHal_SetTransferCompletedCallback(&GC9A01LFBTransferCompleted, &GC9A01LFBContext);
+
+	L2HAL_GC9A01_LFB_Init(&GC9A01LFBContext, &SPIHandle, NULL, 0, NULL, 0, NULL, 0, L2HAL_GC9A01_LFB_ROTATION_0);
+
+	FMGL_API_ColorStruct black = DISPLAYS_BLACK;
+
+	FMGL_API_DriverContext context = FMGL_API_AttachToDriver
+	(
+		&GC9A01LFBContext,
+		&L2HAL_GC9A01_LFB_GetWidth,
+		&L2HAL_GC9A01_LFB_GetHeight,
+		&L2HAL_GC9A01_LFB_SetActiveColor,
+		&L2HAL_GC9A01_LFB_DrawPixel,
+		&L2HAL_GC9A01_LFB_GetPixel,
+		&L2HAL_GC9A01_LFB_PushFramebuffer,
+		black,
+		NULL
+	);
+
+	if (isBulkOperations)
+	{
+		FMGL_API_AttachBulkOperations
+		(
+			&context,
+			&L2HAL_GC9A01_LFB_FillSpan,
+			&L2HAL_GC9A01_LFB_FillRect,
+			&L2HAL_GC9A01_LFB_BlitMono1bpp
+		);
+
+		FMGL_API_AttachRegionsPush(&context, &L2HAL_GC9A01_LFB_PushRegions);
+	}
+
+	return context;
+}
+
+/**
+ * RGB888, the same layout as image one
+ */
+static Images_ImageStruct GC9A01LFBCapture(void)
+{
+	Images_ImageStruct image = Images_Create(L2HAL_GC9A01_LFB_DISPLAY_WIDTH, L2HAL_GC9A01_LFB_DISPLAY_HEIGHT, Images_Pixmap);
+
+	memcpy(image.Pixels, GC9A01LFBContext.Framebuffer, L2HAL_GC9A01_LFB_FRAMEBUFFER_SIZE);
+
+	return image;
+}
+
+const Displays_DisplayStruct Displays_Displays[] =
+{
+	{ "ssd1683", Images_Bitmap, DISPLAYS_WHITE, DISPLAYS_BLACK, DISPLAYS_BLACK, &SSD1683Init, &SSD1683Capture },
+	{ "ssd1683-grey", Images_Greymap, DISPLAYS_WHITE, DISPLAYS_BLACK, DISPLAYS_GREY, &SSD1683GreyscaleInit, &SSD1683GreyscaleCapture },
+	{ "ssd1306", Images_Bitmap, DISPLAYS_BLACK, DISPLAYS_WHITE, DISPLAYS_WHITE, &SSD1306Init, &SSD1306Capture },
+	{ "ssd1327", Images_Bitmap, DISPLAYS_BLACK, DISPLAYS_WHITE, DISPLAYS_WHITE, &SSD1327Init, &SSD1327Capture },
+	{ "gc9a01", Images_Pixmap, DISPLAYS_BLACK, DISPLAYS_WHITE, DISPLAYS_ORANGE, &GC9A01Init, &GC9A01Capture },
+	{ "gc9a01-lfb", Images_Pixmap, DISPLAYS_BLACK, DISPLAYS_WHITE, DISPLAYS_ORANGE, &GC9A01LFBInit, &GC9A01LFBCapture }
+};
+
+const uint8_t Displays_Count = sizeof(Displays_Displays) / sizeof(Displays_Displays[0]);
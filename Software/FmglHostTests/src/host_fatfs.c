@@ -0,0 +1,53 @@
+/*
+ * host_fatfs.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * FatFs functions, used by loadable fonts, over host files. Host FILE* is kept instead of filesystem object pointer
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../../../Firmware/Main/libs/fatfs/ff.h"
+
+FRESULT f_open(FIL* fp, const TCHAR* path, BYTE mode)
+{
+	if (0 == (mode & FA_READ) || 0 != (mode & FA_WRITE))
+	{
+		return FR_DENIED;
+	}
+
+	FILE* file = fopen(path, "rb");
+	if (NULL == file)
+	{
+		return FR_NO_FILE;
+	}
+
+	memset(fp, 0x00, sizeof(FIL));
+	fp->obj.fs = (FATFS*)file;
+
+	fseek(file, 0, SEEK_END);
+	fp->obj.objsize = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	return FR_OK;
+}
+
+FRESULT f_read(FIL* fp, void* buff, UINT btr, UINT* br)
+{
+	FILE* file = (FILE*)fp->obj.fs;
+
+	*br = fread(buff, 1, btr, file);
+	fp->fptr += *br;
+
+	return ferror(file) ? FR_DISK_ERR : FR_OK;
+}
+
+FRESULT f_close(FIL* fp)
+{
+	fclose((FILE*)fp->obj.fs);
+	fp->obj.fs = NULL;
+
+	return FR_OK;
+}
@@ -0,0 +1,141 @@
+/*
+ * host_hal.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stm32f4xx_hal.h>
+#include "../include/host_hal.h"
+#include "../../../Firmware/Main/libs/l2hal/include/l2hal_errors.h"
+#include "../../../Firmware/Main/libs/l2hal/drivers/internal/crc/include/l2hal_crc.h"
+
+static void (*TransferCompletedCallback)(void* context) = NULL;
+static void* TransferCompletedCallbackContext = NULL;
+
+/**
+ * Milliseconds, passed in HAL_Delay() calls
+ */
+static uint32_t Tick = 0;
+
+void HostHal_SetTransferCompletedCallback(void (*callback)(void* context), void* context)
+{
+	TransferCompletedCallback = callback;
+	TransferCompletedCallbackContext = context;
+}
+
+static void CompleteTransfer(void)
+{
+	if (NULL != TransferCompletedCallback)
+	{
+		TransferCompletedCallback(TransferCompletedCallbackContext);
+	}
+}
+
+void L2HAL_Error(L2HAL_ErrorCode code)
+{
+	fprintf(stderr, "L2HAL_Error(%d) called\n", (int)code);
+	exit(EXIT_FAILURE);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+	Tick += Delay;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return Tick;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	(void)GPIOx;
+	(void)GPIO_Pin;
+
+	return GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	(void)GPIOx;
+	(void)GPIO_Pin;
+	(void)PinState;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hspi;
+	(void)pData;
+	(void)Size;
+	(void)Timeout;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
+{
+	(void)hspi;
+	(void)pData;
+	(void)Size;
+
+	CompleteTransfer();
+
+	return HAL_OK;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef *hspi)
+{
+	(void)hspi;
+
+	return HAL_SPI_STATE_READY;
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)Trials;
+	(void)Timeout;
+
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize,
+		uint8_t *pData, uint16_t Size)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)MemAddress;
+	(void)MemAddSize;
+	(void)pData;
+	(void)Size;
+
+	CompleteTransfer();
+
+	return HAL_OK;
+}
+
+/**
+ * Software CRC-32 instead of CRC peripheral, drivers only compare results
+ */
+uint32_t L2HAL_CRC_Calculate(L2HAL_CRCContextStruct* context, uint8_t* buffer, uint32_t size)
+{
+	(void)context;
+
+	uint32_t crc = 0xFFFFFFFFU;
+
+	for (uint32_t i = 0; i < size; i++)
+	{
+		crc ^= buffer[i];
+
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+		}
+	}
+
+	return ~crc;
+}
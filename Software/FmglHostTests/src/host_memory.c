@@ -0,0 +1,63 @@
+/*
+ * host_memory.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/host_memory.h"
+
+static void CheckAccess(uint32_t address, uint32_t size, const char* operation)
+{
+	if (address >= HOST_MEMORY_SIZE || size > HOST_MEMORY_SIZE - address)
+	{
+		fprintf(stderr, "External memory %s out of bounds: address 0x%08X, size %u\n", operation, address, size);
+		exit(EXIT_FAILURE);
+	}
+}
+
+HostMemory_ContextStruct HostMemory_Init(void)
+{
+	HostMemory_ContextStruct context;
+
+	context.Data = malloc(HOST_MEMORY_SIZE);
+	if (NULL == context.Data)
+	{
+		fprintf(stderr, "Failed to allocate external memory\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* Fixed garbage, so results are reproducible, but code can't rely on zeroed memory */
+	for (uint32_t i = 0; i < HOST_MEMORY_SIZE; i++)
+	{
+		context.Data[i] = (uint8_t)((i * 2654435761U) >> 24);
+	}
+
+	context.ReadsCount = 0;
+	context.WritesCount = 0;
+
+	return context;
+}
+
+void HostMemory_Read(void* context, uint32_t address, uint32_t size, uint8_t* buffer)
+{
+	HostMemory_ContextStruct* memory = (HostMemory_ContextStruct*)context;
+
+	CheckAccess(address, size, "read");
+
+	memcpy(buffer, &memory->Data[address], size);
+	memory->ReadsCount ++;
+}
+
+void HostMemory_Write(void* context, uint32_t address, uint32_t size, uint8_t* buffer)
+{
+	HostMemory_ContextStruct* memory = (HostMemory_ContextStruct*)context;
+
+	CheckAccess(address, size, "write");
+
+	memcpy(&memory->Data[address], buffer, size);
+	memory->WritesCount ++;
+}
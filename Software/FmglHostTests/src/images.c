@@ -0,0 +1,296 @@
+/*
+ * images.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/images.h"
+
+/**
+ * Maximal channel value in written files
+ */
+#define IMAGES_MAX_VALUE 255
+
+Images_ImageStruct Images_Create(uint16_t width, uint16_t height, Images_Format format)
+{
+	Images_ImageStruct image;
+
+	image.Width = width;
+	image.Height = height;
+	image.Format = format;
+
+	image.Pixels = calloc((size_t)width * height, 3);
+	if (NULL == image.Pixels)
+	{
+		fprintf(stderr, "Failed to allocate %ux%u image\n", width, height);
+		exit(EXIT_FAILURE);
+	}
+
+	return image;
+}
+
+void Images_Free(Images_ImageStruct* image)
+{
+	free(image->Pixels);
+	image->Pixels = NULL;
+}
+
+void Images_SetPixel(Images_ImageStruct* image, uint16_t x, uint16_t y, FMGL_API_ColorStruct color)
+{
+	uint8_t* pixel = &image->Pixels[((size_t)y * image->Width + x) * 3];
+
+	pixel[0] = color.R;
+	pixel[1] = color.G;
+	pixel[2] = color.B;
+}
+
+FMGL_API_ColorStruct Images_GetPixel(const Images_ImageStruct* image, uint16_t x, uint16_t y)
+{
+	const uint8_t* pixel = &image->Pixels[((size_t)y * image->Width + x) * 3];
+
+	FMGL_API_ColorStruct color;
+	color.R = pixel[0];
+	color.G = pixel[1];
+	color.B = pixel[2];
+
+	return color;
+}
+
+const char* Images_GetExtension(Images_Format format)
+{
+	switch (format)
+	{
+		case Images_Bitmap:
+			return "pbm";
+
+		case Images_Greymap:
+			return "pgm";
+
+		default:
+			return "ppm";
+	}
+}
+
+static bool IsWhite(const uint8_t* pixel)
+{
+	return IMAGES_MAX_VALUE == pixel[0] && IMAGES_MAX_VALUE == pixel[1] && IMAGES_MAX_VALUE == pixel[2];
+}
+
+bool Images_Write(const Images_ImageStruct* image, const char* path)
+{
+	FILE* file = fopen(path, "wb");
+	if (NULL == file)
+	{
+		return false;
+	}
+
+	size_t pixelsCount = (size_t)image->Width * image->Height;
+
+	switch (image->Format)
+	{
+		case Images_Bitmap:
+		{
+			/* 1 - black, rows are padded to byte, MSB first */
+			fprintf(file, "P4\n%u %u\n", image->Width, image->Height);
+
+			uint16_t lineSize = (image->Width + 7) / 8;
+			uint8_t* line = malloc(lineSize);
+
+			for (uint16_t y = 0; y < image->Height; y++)
+			{
+				memset(line, 0x00, lineSize);
+
+				for (uint16_t x = 0; x < image->Width; x++)
+				{
+					if (!IsWhite(&image->Pixels[((size_t)y * image->Width + x) * 3]))
+					{
+						line[x / 8] |= 0x80 >> (x % 8);
+					}
+				}
+
+				fwrite(line, 1, lineSize, file);
+			}
+
+			free(line);
+			break;
+		}
+
+		case Images_Greymap:
+			fprintf(file, "P5\n%u %u\n%u\n", image->Width, image->Height, IMAGES_MAX_VALUE);
+
+			for (size_t i = 0; i < pixelsCount; i++)
+			{
+				fputc(image->Pixels[i * 3], file);
+			}
+			break;
+
+		default:
+			fprintf(file, "P6\n%u %u\n%u\n", image->Width, image->Height, IMAGES_MAX_VALUE);
+			fwrite(image->Pixels, 3, pixelsCount, file);
+			break;
+	}
+
+	bool isOk = !ferror(file);
+
+	return (0 == fclose(file)) && isOk;
+}
+
+/**
+ * Read header number, skipping whitespaces and comments
+ */
+static bool ReadNumber(FILE* file, unsigned int* value)
+{
+	int character = fgetc(file);
+
+	while (EOF != character)
+	{
+		if ('#' == character)
+		{
+			while (EOF != character && '\n' != character)
+			{
+				character = fgetc(file);
+			}
+		}
+		else if (' ' != character && '\t' != character && '\r' != character && '\n' != character)
+		{
+			break;
+		}
+
+		character = fgetc(file);
+	}
+
+	if (character < '0' || character > '9')
+	{
+		return false;
+	}
+
+	*value = 0;
+	while (character >= '0' && character <= '9')
+	{
+		*value = *value * 10 + (character - '0');
+		if (*value > UINT16_MAX)
+		{
+			return false;
+		}
+
+		character = fgetc(file);
+	}
+
+	/* Exactly one whitespace separates header from data */
+	return (' ' == character || '\t' == character || '\r' == character || '\n' == character);
+}
+
+bool Images_Read(Images_ImageStruct* image, const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	if (NULL == file)
+	{
+		return false;
+	}
+
+	char magic[2];
+	unsigned int width;
+	unsigned int height;
+	unsigned int maxValue = IMAGES_MAX_VALUE;
+
+	if (2 != fread(magic, 1, 2, file) || 'P' != magic[0] || magic[1] < '4' || magic[1] > '6'
+		|| !ReadNumber(file, &width) || !ReadNumber(file, &height) || 0 == width || 0 == height
+		|| ('4' != magic[1] && (!ReadNumber(file, &maxValue) || IMAGES_MAX_VALUE != maxValue)))
+	{
+		fclose(file);
+		return false;
+	}
+
+	Images_Format format = ('4' == magic[1]) ? Images_Bitmap : (('5' == magic[1]) ? Images_Greymap : Images_Pixmap);
+	*image = Images_Create(width, height, format);
+
+	bool isOk = true;
+	size_t pixelsCount = (size_t)width * height;
+
+	switch (format)
+	{
+		case Images_Bitmap:
+		{
+			uint16_t lineSize = (width + 7) / 8;
+			uint8_t* line = malloc(lineSize);
+
+			for (uint16_t y = 0; isOk && y < height; y++)
+			{
+				isOk = (lineSize == fread(line, 1, lineSize, file));
+
+				for (uint16_t x = 0; isOk && x < width; x++)
+				{
+					uint8_t value = (0 != (line[x / 8] & (0x80 >> (x % 8)))) ? 0 : IMAGES_MAX_VALUE;
+					memset(&image->Pixels[((size_t)y * width + x) * 3], value, 3);
+				}
+			}
+
+			free(line);
+			break;
+		}
+
+		case Images_Greymap:
+			for (size_t i = 0; isOk && i < pixelsCount; i++)
+			{
+				int value = fgetc(file);
+				isOk = (EOF != value);
+
+				memset(&image->Pixels[i * 3], value, 3);
+			}
+			break;
+
+		default:
+			isOk = (pixelsCount == fread(image->Pixels, 3, pixelsCount, file));
+			break;
+	}
+
+	fclose(file);
+
+	if (!isOk)
+	{
+		Images_Free(image);
+	}
+
+	return isOk;
+}
+
+uint32_t Images_CountDifferentPixels(const Images_ImageStruct* first, const Images_ImageStruct* second)
+{
+	uint32_t result = 0;
+
+	for (size_t i = 0; i < (size_t)first->Width * first->Height; i++)
+	{
+		if (0 != memcmp(&first->Pixels[i * 3], &second->Pixels[i * 3], 3))
+		{
+			result ++;
+		}
+	}
+
+	return result;
+}
+
+Images_ImageStruct Images_MakeDifference(const Images_ImageStruct* first, const Images_ImageStruct* second)
+{
+	Images_ImageStruct result = Images_Create(first->Width, first->Height, Images_Pixmap);
+
+	for (size_t i = 0; i < (size_t)first->Width * first->Height; i++)
+	{
+		if (0 != memcmp(&first->Pixels[i * 3], &second->Pixels[i * 3], 3))
+		{
+			result.Pixels[i * 3] = IMAGES_MAX_VALUE;
+		}
+		else
+		{
+			for (uint8_t channel = 0; channel < 3; channel++)
+			{
+				result.Pixels[i * 3 + channel] = first->Pixels[i * 3 + channel] / 4;
+			}
+		}
+	}
+
+	return result;
+}
@@ -0,0 +1,386 @@
+/*
+ * main.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ *
+ * Draws FMGL scenes with display drivers framebuffer code, compares captured frames with golden images and reports
+ * scenes rendering time
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "../include/host_memory.h"
+#include "../include/images.h"
+#include "../include/displays.h"
+#include "../include/scenes.h"
+#include "../include/benchmarks.h"
+#include "../include/pixel_formats.h"
+#include "../../../Firmware/Main/libs/l2hal/fmgl/fonts/builtin/include/terminusRegular12.h"
+
+/**
+ * Defaults
+ */
+#define MAIN_DEFAULT_RUNS 10U
+#define MAIN_DEFAULT_GOLDEN_DIRECTORY "golden"
+#define MAIN_DEFAULT_OUTPUT_DIRECTORY "output"
+#define MAIN_DEFAULT_FONT "fonts/DejaVuSans16.fmglfont"
+
+/**
+ * Where loadable font is placed in external memory (after GC9A01 framebuffers)
+ */
+#define MAIN_FONT_ADDRESS 0x100000U
+#define MAIN_FONT_MAX_SIZE (HOST_MEMORY_SIZE - MAIN_FONT_ADDRESS)
+
+/**
+ * Where layers storage is placed in external memory (between GC9A01 framebuffers and loadable font)
+ */
+#define MAIN_LAYERS_ADDRESS 0x080000U
+#define MAIN_LAYERS_SIZE (MAIN_FONT_ADDRESS - MAIN_LAYERS_ADDRESS)
+
+#define MAIN_MAX_PATH_LENGTH 512
+
+/**
+ * Test run settings and results
+ */
+typedef struct
+{
+	bool IsUpdate;
+	const char* GoldenDirectory;
+	const char* OutputDirectory;
+
+	/**
+	 * Current display and scene
+	 */
+	const Displays_DisplayStruct* Display;
+	const Scenes_SceneStruct* Scene;
+	FMGL_API_DriverContext* Fmgl;
+
+	/**
+	 * Frames of current scene
+	 */
+	uint16_t FramesCount;
+	uint16_t FailedFramesCount;
+
+	/**
+	 * Totals
+	 */
+	uint32_t TotalFramesCount;
+	uint32_t TotalFailedFramesCount;
+}
+MainStateStruct;
+
+static void PrintUsage(const char* name)
+{
+	fprintf(stderr,
+		"Usage: %s [options]\n"
+		"  -b            Run benchmarks instead of scenes\n"
+		"  -u            Overwrite golden images with rendered ones instead of comparing\n"
+		"  -r runs       Time each scene this number of times, the fastest run is reported (default %u)\n"
+		"  -d display    Test only given display\n"
+		"  -s scene      Test only given scene\n"
+		"  -g directory  Golden images directory (default %s)\n"
+		"  -o directory  Rendered images and differences are written here (default %s)\n"
+		"  -f font       Loadable font (default %s)\n",
+		name, MAIN_DEFAULT_RUNS, MAIN_DEFAULT_GOLDEN_DIRECTORY, MAIN_DEFAULT_OUTPUT_DIRECTORY, MAIN_DEFAULT_FONT);
+}
+
+/**
+ * Join directory and file name
+ */
+static void MakePath(char* path, const char* directory, const char* name, const char* suffix)
+{
+	if (snprintf(path, MAIN_MAX_PATH_LENGTH, "%s/%s%s", directory, name, suffix) >= MAIN_MAX_PATH_LENGTH)
+	{
+		fprintf(stderr, "Path to %s%s is too long\n", name, suffix);
+		exit(EXIT_FAILURE);
+	}
+}
+
+/**
+ * Check that driver GetPixel() returns what is actually stored in framebuffer. Returns false and prints first
+ * mismatch if it isn't so
+ */
+static bool CheckGetPixel(MainStateStruct* state, const Images_ImageStruct* image, const char* name)
+{
+	for (uint16_t y = 0; y < image->Height; y++)
+	{
+		for (uint16_t x = 0; x < image->Width; x++)
+		{
+			FMGL_API_ColorStruct expected = Images_GetPixel(image, x, y);
+			FMGL_API_ColorStruct actual = FMGL_API_GetPixel(state->Fmgl, x, y);
+
+			if (expected.R != actual.R || expected.G != actual.G || expected.B != actual.B)
+			{
+				printf("    %s: GetPixel(%u, %u) returned (%u, %u, %u), framebuffer contains (%u, %u, %u)\n", name, x, y,
+					actual.R, actual.G, actual.B, expected.R, expected.G, expected.B);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Compare frame with golden image. Returns false and writes difference image if they differ
+ */
+static bool CompareWithGolden(MainStateStruct* state, const Images_ImageStruct* image, const char* name)
+{
+	char path[MAIN_MAX_PATH_LENGTH];
+	MakePath(path, state->GoldenDirectory, name, "");
+
+	Images_ImageStruct golden;
+	if (!Images_Read(&golden, path))
+	{
+		printf("    %s: no golden image (run with -u to create it)\n", name);
+		return false;
+	}
+
+	bool isSame = false;
+
+	if (golden.Width != image->Width || golden.Height != image->Height || golden.Format != image->Format)
+	{
+		printf("    %s: golden image has different size or format\n", name);
+	}
+	else
+	{
+		uint32_t differentPixelsCount = Images_CountDifferentPixels(image, &golden);
+		isSame = (0 == differentPixelsCount);
+
+		if (!isSame)
+		{
+			MakePath(path, state->OutputDirectory, name, ".diff.ppm");
+
+			Images_ImageStruct difference = Images_MakeDifference(image, &golden);
+			Images_Write(&difference, path);
+			Images_Free(&difference);
+
+			printf("    %s: %u pixels differ from golden image, see %s\n", name, differentPixelsCount, path);
+		}
+	}
+
+	Images_Free(&golden);
+
+	return isSame;
+}
+
+/**
+ * Called by scene for each frame
+ */
+static void CaptureFrame(void* context)
+{
+	MainStateStruct* state = (MainStateStruct*)context;
+
+	state->FramesCount ++;
+
+	char name[MAIN_MAX_PATH_LENGTH];
+	snprintf(name, sizeof(name), "%s-%s-%u.%s", state->Display->Name, state->Scene->Name, state->FramesCount,
+		Images_GetExtension(state->Display->Format));
+
+	Images_ImageStruct image = state->Display->Capture();
+
+	char path[MAIN_MAX_PATH_LENGTH];
+	MakePath(path, state->OutputDirectory, name, "");
+	if (!Images_Write(&image, path))
+	{
+		fprintf(stderr, "Failed to write %s\n", path);
+		exit(EXIT_FAILURE);
+	}
+
+	bool isPassed = CheckGetPixel(state, &image, name);
+
+	if (state->IsUpdate)
+	{
+		MakePath(path, state->GoldenDirectory, name, "");
+		if (!Images_Write(&image, path))
+		{
+			fprintf(stderr, "Failed to write %s\n", path);
+			exit(EXIT_FAILURE);
+		}
+	}
+	else
+	{
+		isPassed = CompareWithGolden(state, &image, name) && isPassed;
+	}
+
+	if (!isPassed)
+	{
+		state->FailedFramesCount ++;
+	}
+
+	Images_Free(&image);
+}
+
+int main(int argc, char** argv)
+{
+	MainStateStruct state;
+	memset(&state, 0x00, sizeof(state));
+	state.GoldenDirectory = MAIN_DEFAULT_GOLDEN_DIRECTORY;
+	state.OutputDirectory = MAIN_DEFAULT_OUTPUT_DIRECTORY;
+
+	bool isBenchmark = false;
+	unsigned long runs = MAIN_DEFAULT_RUNS;
+	const char* displayName = NULL;
+	const char* sceneName = NULL;
+	char* fontPath = MAIN_DEFAULT_FONT;
+
+	int option;
+	while ((option = getopt(argc, argv, "bur:d:s:g:o:f:")) != -1)
+	{
+		switch (option)
+		{
+			case 'b':
+				isBenchmark = true;
+				break;
+
+			case 'u':
+				state.IsUpdate = true;
+				break;
+
+			case 'r':
+				runs = strtoul(optarg, NULL, 10);
+				break;
+
+			case 'd':
+				displayName = optarg;
+				break;
+
+			case 's':
+				sceneName = optarg;
+				break;
+
+			case 'g':
+				state.GoldenDirectory = optarg;
+				break;
+
+			case 'o':
+				state.OutputDirectory = optarg;
+				break;
+
+			case 'f':
+				fontPath = optarg;
+				break;
+
+			default:
+				PrintUsage(argv[0]);
+				return EXIT_FAILURE;
+		}
+	}
+
+	if (optind != argc || 0 == runs)
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (0 != access(fontPath, R_OK))
+	{
+		fprintf(stderr, "Can't read font %s\n", fontPath);
+		return EXIT_FAILURE;
+	}
+
+	mkdir(state.OutputDirectory, 0755);
+	if (state.IsUpdate)
+	{
+		mkdir(state.GoldenDirectory, 0755);
+	}
+
+	HostMemory_ContextStruct memory = HostMemory_Init();
+
+	FMGL_API_Font builtinFont = FMGL_FontTerminusRegular12Init();
+
+	static FMGL_LoadableFont_ContextStruct loadableFontContext;
+	FMGL_API_Font loadableFont = FMGL_LoadableFont_Init(&loadableFontContext, fontPath, &memory, &HostMemory_Write, &HostMemory_Read,
+		MAIN_FONT_ADDRESS, MAIN_FONT_MAX_SIZE);
+
+	static FMGL_Layers_StorageStruct layersStorage;
+	FMGL_Layers_InitStorage(&layersStorage, &memory, &HostMemory_Write, &HostMemory_Read, MAIN_LAYERS_ADDRESS, MAIN_LAYERS_SIZE);
+
+	printf("Loadable font: %lu glyphs, %lu bytes of memory\n\n", (unsigned long)loadableFontContext.CharactersCount, (unsigned long)loadableFontContext.MemorySize);
+
+	if (isBenchmark)
+	{
+		Benchmarks_RunPixelFormats();
+		printf("\n");
+
+		bool isPassed = Benchmarks_RunGlyphs(&memory, &builtinFont, &loadableFont);
+
+		free(memory.Data);
+
+		return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	bool isPixelFormatsPassed = PixelFormats_Test();
+	printf("Pixel formats kernels: %s\n\n", isPixelFormatsPassed ? "passed" : "failed");
+
+	printf("%-14s %-16s %6s %6s %12s\n", "Display", "Scene", "Frames", "Failed", "Time, ms");
+
+	for (uint8_t displayIndex = 0; displayIndex < Displays_Count; displayIndex++)
+	{
+		state.Display = &Displays_Displays[displayIndex];
+		if (NULL != displayName && 0 != strcmp(displayName, state.Display->Name))
+		{
+			continue;
+		}
+
+		FMGL_API_DriverContext fmgl = state.Display->Init(&memory, true);
+		state.Fmgl = &fmgl;
+
+		Scenes_ContextStruct sceneContext;
+		sceneContext.Fmgl = &fmgl;
+		sceneContext.Display = state.Display;
+		sceneContext.BuiltinFont = &builtinFont;
+		sceneContext.LoadableFont = &loadableFont;
+		sceneContext.LoadableFontContext = &loadableFontContext;
+		sceneContext.LayersStorage = &layersStorage;
+
+		for (uint8_t sceneIndex = 0; sceneIndex < Scenes_Count; sceneIndex++)
+		{
+			state.Scene = &Scenes_Scenes[sceneIndex];
+			if (NULL != sceneName && 0 != strcmp(sceneName, state.Scene->Name))
+			{
+				continue;
+			}
+
+			/* Capturing frames */
+			state.FramesCount = 0;
+			state.FailedFramesCount = 0;
+
+			sceneContext.FrameCompleted = &CaptureFrame;
+			sceneContext.FrameCompletedContext = &state;
+			state.Scene->Run(&sceneContext);
+
+			/* Timing without captures */
+			sceneContext.FrameCompleted = NULL;
+			double bestTime = 0;
+
+			for (unsigned long run = 0; run < runs; run++)
+			{
+				double start = Benchmarks_GetTime();
+				state.Scene->Run(&sceneContext);
+				double time = Benchmarks_GetTime() - start;
+
+				if (0 == run || time < bestTime)
+				{
+					bestTime = time;
+				}
+			}
+
+			printf("%-14s %-16s %6u %6u %12.3f\n", state.Display->Name, state.Scene->Name, state.FramesCount, state.FailedFramesCount,
+				bestTime * 1000.0);
+
+			state.TotalFramesCount += state.FramesCount;
+			state.TotalFailedFramesCount += state.FailedFramesCount;
+		}
+	}
+
+	printf("\n%u frames, %u failed%s\n", state.TotalFramesCount, state.TotalFailedFramesCount, state.IsUpdate ? ", golden images are updated" : "");
+
+	free(memory.Data);
+
+	return (isPixelFormatsPassed && 0 == state.TotalFailedFramesCount && 0 != state.TotalFramesCount) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
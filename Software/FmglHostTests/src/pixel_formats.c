@@ -0,0 +1,476 @@
+/*
+ * pixel_formats.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../include/pixel_formats.h"
+#include "../../../Firmware/Main/libs/l2hal/fmgl/include/fmgl_pixel_formats.h"
+
+/**
+ * Test framebuffer size. Width is multiple of 8, as Grey2 bit planes extraction requires
+ */
+#define PIXEL_FORMATS_TEST_WIDTH 64U
+#define PIXEL_FORMATS_TEST_HEIGHT 16U
+
+/**
+ * Bytes after framebuffer, kernels must not touch them
+ */
+#define PIXEL_FORMATS_TEST_GUARD_SIZE 16U
+
+#define PIXEL_FORMATS_TEST_FRAMEBUFFER_SIZE (PIXEL_FORMATS_TEST_WIDTH * FMGL_PF_RGB888_BYTES_PER_PIXEL * PIXEL_FORMATS_TEST_HEIGHT \
+	+ PIXEL_FORMATS_TEST_GUARD_SIZE)
+
+/**
+ * Random cases per kernel
+ */
+#define PIXEL_FORMATS_TEST_CASES 20000U
+
+/**
+ * Blitted images are up to this number of pixels wider than blitted part
+ */
+#define PIXEL_FORMATS_TEST_MAX_IMAGE_EXTRA_WIDTH 12U
+
+static uint32_t RandomState = 1;
+
+/**
+ * Deterministic pseudo-random number in [0; limit)
+ */
+static uint32_t Random(uint32_t limit)
+{
+	RandomState = RandomState * 1664525U + 1013904223U;
+
+	return (uint32_t)(((uint64_t)(RandomState >> 8) * limit) >> 24);
+}
+
+static void RandomBytes(uint8_t* buffer, uint32_t size)
+{
+	for (uint32_t i = 0; i < size; i++)
+	{
+		buffer[i] = (uint8_t)Random(256);
+	}
+}
+
+static FMGL_API_ColorStruct UnpackRGB888(uint32_t value)
+{
+	FMGL_API_ColorStruct color = { (uint8_t)(value >> 16), (uint8_t)(value >> 8), (uint8_t)value };
+
+	return color;
+}
+
+/*********************************
+ * Kernels with common signature *
+ *********************************/
+
+static void Mono1MSBFillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value)
+{
+	FMGL_PF_Mono1FillSpan(line, x1, x2, value ? 0xFFU : 0x00U, true);
+}
+
+static void Mono1MSBBlit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+	uint32_t activeValue, uint32_t inactiveValue, FMGL_API_XBMTransparencyMode transparency)
+{
+	FMGL_PF_Mono1Blit(framebuffer, lineSize, x, y, image, width, height, activeValue ? 0xFFU : 0x00U, inactiveValue ? 0xFFU : 0x00U,
+		transparency, true);
+}
+
+static void Mono1LSBFillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value)
+{
+	FMGL_PF_Mono1FillSpan(line, x1, x2, value ? 0xFFU : 0x00U, false);
+}
+
+static void Mono1LSBBlit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+	uint32_t activeValue, uint32_t inactiveValue, FMGL_API_XBMTransparencyMode transparency)
+{
+	FMGL_PF_Mono1Blit(framebuffer, lineSize, x, y, image, width, height, activeValue ? 0xFFU : 0x00U, inactiveValue ? 0xFFU : 0x00U,
+		transparency, false);
+}
+
+static void Grey2FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value)
+{
+	FMGL_PF_Grey2FillSpan(line, x1, x2, (uint8_t)value);
+}
+
+static void Grey4FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value)
+{
+	FMGL_PF_Grey4FillSpan(line, x1, x2, (uint8_t)value);
+}
+
+static void Grey4Blit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+	uint32_t activeValue, uint32_t inactiveValue, FMGL_API_XBMTransparencyMode transparency)
+{
+	FMGL_PF_Grey4Blit(framebuffer, lineSize, x, y, image, width, height, (uint8_t)activeValue, (uint8_t)inactiveValue, transparency);
+}
+
+static void RGB565FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value)
+{
+	FMGL_PF_RGB565FillSpan(line, x1, x2, (uint16_t)value);
+}
+
+static void RGB565Blit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+	uint32_t activeValue, uint32_t inactiveValue, FMGL_API_XBMTransparencyMode transparency)
+{
+	FMGL_PF_RGB565Blit(framebuffer, lineSize, x, y, image, width, height, (uint16_t)activeValue, (uint16_t)inactiveValue, transparency);
+}
+
+static void RGB888FillSpan(uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value)
+{
+	FMGL_PF_RGB888FillSpan(line, x1, x2, UnpackRGB888(value));
+}
+
+static void RGB888Blit(uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y, FMGL_API_XBMImage* image, uint16_t width, uint16_t height,
+	uint32_t activeValue, uint32_t inactiveValue, FMGL_API_XBMTransparencyMode transparency)
+{
+	FMGL_PF_RGB888Blit(framebuffer, lineSize, x, y, image, width, height, UnpackRGB888(activeValue), UnpackRGB888(inactiveValue), transparency);
+}
+
+/**
+ * There is no Grey2 blit kernel, SSD1683 draws greyscale images pixel by pixel
+ */
+const PixelFormats_FormatStruct PixelFormats_Formats[] =
+{
+	{ "mono1-msb", 1, true, &Mono1MSBFillSpan, &Mono1MSBBlit },
+	{ "mono1-lsb", 1, false, &Mono1LSBFillSpan, &Mono1LSBBlit },
+	{ "grey2", 2, true, &Grey2FillSpan, NULL },
+	{ "grey4", 4, true, &Grey4FillSpan, &Grey4Blit },
+	{ "rgb565", 16, true, &RGB565FillSpan, &RGB565Blit },
+	{ "rgb888", 24, true, &RGB888FillSpan, &RGB888Blit }
+};
+
+const uint8_t PixelFormats_Count = sizeof(PixelFormats_Formats) / sizeof(PixelFormats_Formats[0]);
+
+/*****************************
+ * Reference implementations *
+ *****************************/
+
+uint16_t PixelFormats_GetLineSize(const PixelFormats_FormatStruct* format, uint16_t width)
+{
+	return ((uint32_t)width * format->BitsPerPixel + FMGL_PF_BITS_PER_BYTE - 1) / FMGL_PF_BITS_PER_BYTE;
+}
+
+/**
+ * Pixel position: for packed formats it is byte and shift of pixel bits in it, for others it is first byte
+ */
+static void GetPixelPosition(const PixelFormats_FormatStruct* format, uint16_t x, uint32_t* byteIndex, uint8_t* shift)
+{
+	uint32_t bitIndex = (uint32_t)x * format->BitsPerPixel;
+
+	*byteIndex = bitIndex / FMGL_PF_BITS_PER_BYTE;
+	*shift = format->IsMSBFirst
+		? FMGL_PF_BITS_PER_BYTE - format->BitsPerPixel - bitIndex % FMGL_PF_BITS_PER_BYTE
+		: bitIndex % FMGL_PF_BITS_PER_BYTE;
+}
+
+uint32_t PixelFormats_ReadPixel(const PixelFormats_FormatStruct* format, const uint8_t* line, uint16_t x)
+{
+	uint32_t byteIndex;
+	uint8_t shift;
+	GetPixelPosition(format, x, &byteIndex, &shift);
+
+	if (format->BitsPerPixel < FMGL_PF_BITS_PER_BYTE)
+	{
+		return (line[byteIndex] >> shift) & ((1U << format->BitsPerPixel) - 1U);
+	}
+
+	uint32_t value = 0;
+	for (uint8_t i = 0; i < format->BitsPerPixel / FMGL_PF_BITS_PER_BYTE; i++)
+	{
+		value = (value << FMGL_PF_BITS_PER_BYTE) | line[byteIndex + i];
+	}
+
+	return value;
+}
+
+void PixelFormats_WritePixel(const PixelFormats_FormatStruct* format, uint8_t* line, uint16_t x, uint32_t value)
+{
+	uint32_t byteIndex;
+	uint8_t shift;
+	GetPixelPosition(format, x, &byteIndex, &shift);
+
+	if (format->BitsPerPixel < FMGL_PF_BITS_PER_BYTE)
+	{
+		uint8_t mask = (uint8_t)(((1U << format->BitsPerPixel) - 1U) << shift);
+		line[byteIndex] = (line[byteIndex] & ~mask) | (uint8_t)((value << shift) & mask);
+		return;
+	}
+
+	uint8_t bytesCount = format->BitsPerPixel / FMGL_PF_BITS_PER_BYTE;
+	for (uint8_t i = 0; i < bytesCount; i++)
+	{
+		line[byteIndex + i] = (uint8_t)(value >> (FMGL_PF_BITS_PER_BYTE * (bytesCount - 1U - i)));
+	}
+}
+
+void PixelFormats_ReferenceFillSpan(const PixelFormats_FormatStruct* format, uint8_t* line, uint16_t x1, uint16_t x2, uint32_t value)
+{
+	for (uint16_t x = x1; x <= x2; x++)
+	{
+		PixelFormats_WritePixel(format, line, x, value);
+	}
+}
+
+void PixelFormats_ReferenceBlit(const PixelFormats_FormatStruct* format, uint8_t* framebuffer, uint16_t lineSize, uint16_t x, uint16_t y,
+	FMGL_API_XBMImage* image, uint16_t width, uint16_t height, uint32_t activeValue, uint32_t inactiveValue, FMGL_API_XBMTransparencyMode transparency)
+{
+	uint16_t imageLineSize = (image->Width + FMGL_PF_BITS_PER_BYTE - 1) / FMGL_PF_BITS_PER_BYTE;
+
+	for (uint16_t row = 0; row < height; row++)
+	{
+		for (uint16_t column = 0; column < width; column++)
+		{
+			uint8_t bits = image->Raster[row * imageLineSize + column / FMGL_PF_BITS_PER_BYTE];
+			uint8_t bitNumber = image->IsMSBFirst ? 7U - column % FMGL_PF_BITS_PER_BYTE : column % FMGL_PF_BITS_PER_BYTE;
+			bool isActive = (0 != ((bits >> bitNumber) & 0x01U));
+
+			if (isActive && FMGL_XBMTransparencyModeTransparentActive != transparency)
+			{
+				PixelFormats_WritePixel(format, &framebuffer[(y + row) * lineSize], x + column, activeValue);
+			}
+			else if (!isActive && FMGL_XBMTransparencyModeTransparentInactive != transparency)
+			{
+				PixelFormats_WritePixel(format, &framebuffer[(y + row) * lineSize], x + column, inactiveValue);
+			}
+		}
+	}
+}
+
+/*********
+ * Tests *
+ *********/
+
+/**
+ * Framebuffer modified by kernel and by reference implementation
+ */
+typedef struct
+{
+	uint8_t Actual[PIXEL_FORMATS_TEST_FRAMEBUFFER_SIZE];
+	uint8_t Expected[PIXEL_FORMATS_TEST_FRAMEBUFFER_SIZE];
+}
+TestFramebuffersStruct;
+
+static void ResetFramebuffers(TestFramebuffersStruct* framebuffers)
+{
+	RandomBytes(framebuffers->Actual, PIXEL_FORMATS_TEST_FRAMEBUFFER_SIZE);
+	memcpy(framebuffers->Expected, framebuffers->Actual, PIXEL_FORMATS_TEST_FRAMEBUFFER_SIZE);
+}
+
+static bool IsFramebuffersSame(TestFramebuffersStruct* framebuffers)
+{
+	return 0 == memcmp(framebuffers->Actual, framebuffers->Expected, PIXEL_FORMATS_TEST_FRAMEBUFFER_SIZE);
+}
+
+static uint32_t RandomValue(const PixelFormats_FormatStruct* format)
+{
+	return Random(1U << format->BitsPerPixel);
+}
+
+static bool TestFillSpan(const PixelFormats_FormatStruct* format, TestFramebuffersStruct* framebuffers)
+{
+	for (uint32_t i = 0; i < PIXEL_FORMATS_TEST_CASES; i++)
+	{
+		ResetFramebuffers(framebuffers);
+
+		uint16_t x1 = Random(PIXEL_FORMATS_TEST_WIDTH);
+		uint16_t x2 = x1 + Random(PIXEL_FORMATS_TEST_WIDTH - x1);
+		uint32_t value = RandomValue(format);
+
+		format->FillSpan(framebuffers->Actual, x1, x2, value);
+		PixelFormats_ReferenceFillSpan(format, framebuffers->Expected, x1, x2, value);
+
+		if (!IsFramebuffersSame(framebuffers))
+		{
+			printf("    %s: FillSpan(%u, %u, 0x%X) differs from reference\n", format->Name, x1, x2, value);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool TestBlit(const PixelFormats_FormatStruct* format, TestFramebuffersStruct* framebuffers)
+{
+	uint16_t lineSize = PixelFormats_GetLineSize(format, PIXEL_FORMATS_TEST_WIDTH);
+	uint8_t raster[(PIXEL_FORMATS_TEST_WIDTH + PIXEL_FORMATS_TEST_MAX_IMAGE_EXTRA_WIDTH + FMGL_PF_BITS_PER_BYTE - 1) / FMGL_PF_BITS_PER_BYTE
+		* PIXEL_FORMATS_TEST_HEIGHT];
+
+	for (uint32_t i = 0; i < PIXEL_FORMATS_TEST_CASES; i++)
+	{
+		ResetFramebuffers(framebuffers);
+		RandomBytes(raster, sizeof(raster));
+
+		uint16_t x = Random(PIXEL_FORMATS_TEST_WIDTH);
+		uint16_t y = Random(PIXEL_FORMATS_TEST_HEIGHT);
+		uint16_t width = 1 + Random(PIXEL_FORMATS_TEST_WIDTH - x);
+		uint16_t height = 1 + Random(PIXEL_FORMATS_TEST_HEIGHT - y);
+
+		FMGL_API_XBMImage image;
+		image.Width = width + Random(PIXEL_FORMATS_TEST_MAX_IMAGE_EXTRA_WIDTH);
+		image.Height = height;
+		image.Raster = raster;
+		image.IsMSBFirst = (0 != Random(2));
+
+		uint32_t activeValue = RandomValue(format);
+		uint32_t inactiveValue = RandomValue(format);
+		FMGL_API_XBMTransparencyMode transparency = (FMGL_API_XBMTransparencyMode)Random(3);
+
+		format->Blit(framebuffers->Actual, lineSize, x, y, &image, width, height, activeValue, inactiveValue, transparency);
+		PixelFormats_ReferenceBlit(format, framebuffers->Expected, lineSize, x, y, &image, width, height, activeValue, inactiveValue, transparency);
+
+		if (!IsFramebuffersSame(framebuffers))
+		{
+			printf("    %s: Blit(%u, %u, %ux%u of %u px wide %s image, 0x%X, 0x%X, transparency %u) differs from reference\n", format->Name,
+				x, y, width, height, image.Width, image.IsMSBFirst ? "MSB-first" : "LSB-first", activeValue, inactiveValue, transparency);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool TestMono1FillRect(const PixelFormats_FormatStruct* format, TestFramebuffersStruct* framebuffers)
+{
+	uint16_t lineSize = PixelFormats_GetLineSize(format, PIXEL_FORMATS_TEST_WIDTH);
+
+	for (uint32_t i = 0; i < PIXEL_FORMATS_TEST_CASES; i++)
+	{
+		ResetFramebuffers(framebuffers);
+
+		uint16_t x1 = Random(PIXEL_FORMATS_TEST_WIDTH);
+		uint16_t x2 = x1 + Random(PIXEL_FORMATS_TEST_WIDTH - x1);
+		uint16_t y1 = Random(PIXEL_FORMATS_TEST_HEIGHT);
+		uint16_t y2 = y1 + Random(PIXEL_FORMATS_TEST_HEIGHT - y1);
+		uint32_t value = RandomValue(format);
+
+		FMGL_PF_Mono1FillRect(framebuffers->Actual, lineSize, x1, y1, x2, y2, value ? 0xFFU : 0x00U, format->IsMSBFirst);
+
+		for (uint16_t y = y1; y <= y2; y++)
+		{
+			PixelFormats_ReferenceFillSpan(format, &framebuffers->Expected[y * lineSize], x1, x2, value);
+		}
+
+		if (!IsFramebuffersSame(framebuffers))
+		{
+			printf("    %s: Mono1FillRect(%u, %u, %u, %u, %u) differs from reference\n", format->Name, x1, y1, x2, y2, value);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool TestGrey2Pixels(const PixelFormats_FormatStruct* format, TestFramebuffersStruct* framebuffers)
+{
+	for (uint32_t i = 0; i < PIXEL_FORMATS_TEST_CASES; i++)
+	{
+		ResetFramebuffers(framebuffers);
+
+		uint16_t x = Random(PIXEL_FORMATS_TEST_WIDTH);
+		uint8_t level = RandomValue(format);
+
+		if (FMGL_PF_Grey2ReadPixel(framebuffers->Actual, x) != PixelFormats_ReadPixel(format, framebuffers->Actual, x))
+		{
+			printf("    %s: Grey2ReadPixel(%u) differs from reference\n", format->Name, x);
+			return false;
+		}
+
+		FMGL_PF_Grey2WritePixel(framebuffers->Actual, x, level);
+		PixelFormats_WritePixel(format, framebuffers->Expected, x, level);
+
+		if (!IsFramebuffersSame(framebuffers))
+		{
+			printf("    %s: Grey2WritePixel(%u, %u) differs from reference\n", format->Name, x, level);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool TestGrey2ExtractPlane(const PixelFormats_FormatStruct* format)
+{
+	uint8_t line[PIXEL_FORMATS_TEST_WIDTH / 4U];
+	uint8_t actual[PIXEL_FORMATS_TEST_WIDTH / FMGL_PF_BITS_PER_BYTE + PIXEL_FORMATS_TEST_GUARD_SIZE];
+	uint8_t expected[sizeof(actual)];
+
+	for (uint32_t i = 0; i < PIXEL_FORMATS_TEST_CASES; i++)
+	{
+		RandomBytes(line, sizeof(line));
+		RandomBytes(actual, sizeof(actual));
+		memcpy(expected, actual, sizeof(actual));
+
+		uint16_t width = FMGL_PF_BITS_PER_BYTE * (1 + Random(PIXEL_FORMATS_TEST_WIDTH / FMGL_PF_BITS_PER_BYTE));
+		uint8_t plane = Random(2);
+
+		FMGL_PF_Grey2ExtractPlane(line, width, plane, actual);
+
+		for (uint16_t x = 0; x < width; x++)
+		{
+			uint8_t mask = 0x80U >> (x % FMGL_PF_BITS_PER_BYTE);
+			bool isSet = (0 != ((PixelFormats_ReadPixel(format, line, x) >> plane) & 0x01U));
+
+			expected[x / FMGL_PF_BITS_PER_BYTE] = isSet ? (expected[x / FMGL_PF_BITS_PER_BYTE] | mask) : (expected[x / FMGL_PF_BITS_PER_BYTE] & ~mask);
+		}
+
+		if (0 != memcmp(actual, expected, sizeof(actual)))
+		{
+			printf("    %s: Grey2ExtractPlane(%u px, plane %u) differs from reference\n", format->Name, width, plane);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool TestPackRGB565(void)
+{
+	for (uint32_t value = 0; value < (1U << 24); value++)
+	{
+		FMGL_API_ColorStruct color = UnpackRGB888(value);
+		uint16_t expected = (uint16_t)(((color.R >> 3) << 11) | ((color.G >> 2) << 5) | (color.B >> 3));
+
+		if (FMGL_PF_PackRGB565(color) != expected)
+		{
+			printf("    rgb565: PackRGB565(%u, %u, %u) is 0x%04X, 0x%04X is expected\n", color.R, color.G, color.B,
+				FMGL_PF_PackRGB565(color), expected);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool PixelFormats_Test(void)
+{
+	static TestFramebuffersStruct framebuffers;
+	bool isPassed = true;
+
+	for (uint8_t formatIndex = 0; formatIndex < PixelFormats_Count; formatIndex++)
+	{
+		const PixelFormats_FormatStruct* format = &PixelFormats_Formats[formatIndex];
+
+		isPassed = TestFillSpan(format, &framebuffers) && isPassed;
+
+		if (NULL != format->Blit)
+		{
+			isPassed = TestBlit(format, &framebuffers) && isPassed;
+		}
+
+		if (1 == format->BitsPerPixel)
+		{
+			isPassed = TestMono1FillRect(format, &framebuffers) && isPassed;
+		}
+
+		if (2 == format->BitsPerPixel)
+		{
+			isPassed = TestGrey2Pixels(format, &framebuffers) && isPassed;
+			isPassed = TestGrey2ExtractPlane(format) && isPassed;
+		}
+	}
+
+	isPassed = TestPackRGB565() && isPassed;
+
+	return isPassed;
+}
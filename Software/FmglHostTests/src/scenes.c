@@ -0,0 +1,548 @@
+/*
+ * scenes.c
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: shakti
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "../include/scenes.h"
+#include "../../../Firmware/Main/libs/l2hal/fmgl/console/include/console.h"
+#include "../../../Firmware/Main/libs/l2hal/fmgl/widgets/include/widgets.h"
+#include "../../../Firmware/Main/libs/l2hal/fmgl/fonts/builtin/include/terminusRegular12.h"
+#include "../../../Firmware/Main/libs/l2hal/include/l2hal_aux.h"
+
+/**
+ * Gap between glyphs on glyphs sheets
+ */
+#define SCENES_GLYPHS_GAP 2
+
+/**
+ * Code point, shown as missing character
+ */
+#define SCENES_MISSING_CHARACTER 0xFFFDU
+
+/**
+ * Thermometer icon, 16x16, classic XBM
+ */
+static const uint8_t ThermometerIconRaster[] =
+{
+	0x80, 0x01, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x03,
+	0x40, 0x03, 0x40, 0x03, 0x20, 0x07, 0xA0, 0x07, 0xA0, 0x07, 0x20, 0x07, 0xC0, 0x03, 0x00, 0x00
+};
+
+static FMGL_API_XBMImage ThermometerIcon = { 16, 16, ThermometerIconRaster, false };
+
+/**
+ * Thermometer silhouette, it is used as thermometer sprite mask
+ */
+static const uint8_t ThermometerMaskRaster[] =
+{
+	0x80, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+	0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x03, 0x00, 0x00
+};
+
+static FMGL_API_XBMImage ThermometerMask = { 16, 16, ThermometerMaskRaster, false };
+
+static void CompleteFrame(Scenes_ContextStruct* context)
+{
+	if (NULL != context->FrameCompleted)
+	{
+		context->FrameCompleted(context->FrameCompletedContext);
+	}
+}
+
+static void ClearScreen(Scenes_ContextStruct* context)
+{
+	FMGL_API_SetBlankingColor(context->Fmgl, context->Display->BackgroundColor);
+	FMGL_API_ClearScreen(context->Fmgl);
+}
+
+static FMGL_API_FontSettings MakeFontSettings(FMGL_API_Font* font, FMGL_API_ColorStruct* fontColor, FMGL_API_ColorStruct* backgroundColor,
+		FMGL_API_XBMTransparencyMode* transparency)
+{
+	FMGL_API_FontSettings settings;
+
+	settings.Font = font;
+	settings.Scale = 1;
+	settings.CharactersSpacing = 0;
+	settings.LinesSpacing = 0;
+	settings.FontColor = fontColor;
+	settings.BackgroundColor = backgroundColor;
+	settings.Transparency = transparency;
+
+	return settings;
+}
+
+/**
+ * Deterministic pseudo-random numbers in [0; 1)
+ */
+static float Random(uint32_t* state)
+{
+	*state = *state * 1664525U + 1013904223U;
+
+	return (float)(*state >> 8) / (float)(1U << 24);
+}
+
+/**
+ * Boot log like the firmware one, then measurements log, which makes console to scroll
+ */
+static void ConsoleScene(Scenes_ContextStruct* context)
+{
+	FMGL_API_ColorStruct fontColor = context->Display->ForegroundColor;
+	FMGL_API_ColorStruct backgroundColor = context->Display->BackgroundColor;
+	FMGL_API_XBMTransparencyMode transparency = FMGL_XBMTransparencyModeNormal;
+	FMGL_API_FontSettings fontSettings = MakeFontSettings(context->BuiltinFont, &fontColor, &backgroundColor, &transparency);
+
+	FMGL_API_SetBlankingColor(context->Fmgl, backgroundColor);
+	FMGL_Console_ContextStruct console = FMGL_ConsoleInit(context->Fmgl, &fontSettings);
+
+	static char* bootLog[] =
+	{
+		"Rainforest",
+		"SD card initialization...",
+		"Hardware self-test, it will take a while...",
+		"Success",
+		"Mounting SD card...",
+		"Success",
+		"Loading font:",
+		"/System/Fonts/FreeSans32.fmglfont",
+		"Success",
+		"Loading localization settings:",
+		"/System/Configs/localization.config",
+		"Success",
+		"Loading display waveforms:",
+		"/System/Display/waveforms.bin",
+		"Not found, using built-in ones",
+		"Температура, влажность, давление"
+	};
+
+	for (uint8_t i = 0; i < sizeof(bootLog) / sizeof(bootLog[0]); i++)
+	{
+		FMGL_ConsoleAddLine(&console, bootLog[i]);
+	}
+
+	CompleteFrame(context);
+
+	/* More lines than console buffer keeps */
+	char line[FMGL_CONSOLE_MAX_LINE_LENGTH];
+	for (uint16_t i = 0; i < FMGL_CONSOLE_LINES_BUFFER_SIZE + 16; i++)
+	{
+		snprintf(line, sizeof(line), "%02u:%02u T=%.1fC H=%.1f%% P=%.1fhPa", i / 60, i % 60,
+			20.0 + 5.0 * sin(i / 10.0), 45.0 + 10.0 * cos(i / 7.0), 1013.0 + 3.0 * sin(i / 13.0));
+
+		FMGL_ConsoleAddLine(&console, line);
+	}
+
+	CompleteFrame(context);
+}
+
+/**
+ * Measurements screen: icon, values and temperature history. Then values are changed, so only changed widgets are redrawn
+ */
+static void DashboardScene(Scenes_ContextStruct* context)
+{
+	ClearScreen(context);
+
+	FMGL_API_ColorStruct fontColor = context->Display->ForegroundColor;
+	FMGL_API_ColorStruct backgroundColor = context->Display->BackgroundColor;
+	FMGL_API_XBMTransparencyMode transparency = FMGL_XBMTransparencyModeNormal;
+	FMGL_API_FontSettings fontSettings = MakeFontSettings(context->LoadableFont, &fontColor, &backgroundColor, &transparency);
+
+	uint16_t width = FMGL_API_GetDisplayWidth(context->Fmgl);
+	uint16_t height = FMGL_API_GetDisplayHeight(context->Fmgl);
+	uint16_t lineHeight = context->LoadableFont->Height;
+	uint16_t iconSize = ThermometerIcon.Width;
+
+	FMGL_Widgets_ScreenStruct screen = FMGL_Widgets_InitScreen(context->Fmgl, backgroundColor);
+
+	FMGL_Widgets_WidgetStruct icon = FMGL_Widgets_CreateIcon(0, 0, iconSize, lineHeight, &ThermometerIcon, context->Display->AccentColor);
+	FMGL_Widgets_WidgetStruct temperature = FMGL_Widgets_CreateValue(iconSize + 2, 0, width - iconSize - 2, lineHeight, &fontSettings, "%.1f°C");
+	FMGL_Widgets_WidgetStruct humidity = FMGL_Widgets_CreateValue(0, lineHeight, width, lineHeight, &fontSettings, "H: %.1f%%");
+	FMGL_Widgets_WidgetStruct pressure = FMGL_Widgets_CreateValue(0, 2 * lineHeight, width, lineHeight, &fontSettings, "P: %.1f hPa");
+
+	FMGL_Widgets_AddWidget(&screen, &icon);
+	FMGL_Widgets_AddWidget(&screen, &temperature);
+	FMGL_Widgets_AddWidget(&screen, &humidity);
+	FMGL_Widgets_AddWidget(&screen, &pressure);
+
+	FMGL_Widgets_WidgetStruct chart;
+	uint16_t chartTop = 3 * lineHeight + 2;
+	bool isChart = (chartTop + 8 <= height);
+	if (isChart)
+	{
+		chart = FMGL_Widgets_CreateChart(0, chartTop, width, height - chartTop, 15.0f, 30.0f, context->Display->AccentColor);
+		FMGL_Widgets_AddWidget(&screen, &chart);
+	}
+
+	uint32_t randomState = 1;
+	for (uint8_t step = 0; step < 2; step++)
+	{
+		for (uint8_t i = 0; i < FMGL_WIDGETS_CHART_MAX_POINTS / 2; i++)
+		{
+			float value = 22.0f + 4.0f * sinf((step * FMGL_WIDGETS_CHART_MAX_POINTS / 2 + i) / 6.0f) + Random(&randomState);
+
+			FMGL_Widgets_SetValue(&temperature, value);
+			if (isChart)
+			{
+				FMGL_Widgets_AddChartPoint(&chart, value);
+			}
+		}
+
+		FMGL_Widgets_SetValue(&humidity, 40.0f + 20.0f * step + Random(&randomState));
+		FMGL_Widgets_SetValue(&pressure, 1013.25f - 7.5f * step);
+
+		FMGL_Widgets_Render(&screen);
+		CompleteFrame(context);
+	}
+}
+
+/**
+ * Charts with various data, including out of range values and more points than chart keeps
+ */
+static void ChartsScene(Scenes_ContextStruct* context)
+{
+	ClearScreen(context);
+
+	uint16_t chartWidth = FMGL_API_GetDisplayWidth(context->Fmgl) / 2;
+	uint16_t chartHeight = FMGL_API_GetDisplayHeight(context->Fmgl) / 2;
+
+	FMGL_Widgets_ScreenStruct screen = FMGL_Widgets_InitScreen(context->Fmgl, context->Display->BackgroundColor);
+	FMGL_Widgets_WidgetStruct charts[4];
+
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		FMGL_API_ColorStruct lineColor = (0 == i % 2) ? context->Display->ForegroundColor : context->Display->AccentColor;
+
+		charts[i] = FMGL_Widgets_CreateChart((i % 2) * chartWidth + 1, (i / 2) * chartHeight + 1, chartWidth - 2, chartHeight - 2,
+			-1.0f, 1.0f, lineColor);
+
+		FMGL_Widgets_AddWidget(&screen, &charts[i]);
+	}
+
+	uint32_t randomState = 7;
+	for (uint16_t point = 0; point < FMGL_WIDGETS_CHART_MAX_POINTS + FMGL_WIDGETS_CHART_MAX_POINTS / 2; point++)
+	{
+		/* Sine, sawtooth, noise exceeding range, constant */
+		FMGL_Widgets_AddChartPoint(&charts[0], sinf(point / 5.0f));
+		FMGL_Widgets_AddChartPoint(&charts[1], (point % 16) / 8.0f - 1.0f);
+		FMGL_Widgets_AddChartPoint(&charts[2], 3.0f * (Random(&randomState) - 0.5f));
+		FMGL_Widgets_AddChartPoint(&charts[3], 0.25f);
+	}
+
+	FMGL_Widgets_Render(&screen);
+
+	/* Frames around charts */
+	FMGL_API_SetActiveColor(context->Fmgl, context->Display->ForegroundColor);
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		FMGL_API_DrawRectangle(context->Fmgl, charts[i].X - 1, charts[i].Y - 1, charts[i].X + charts[i].Width, charts[i].Y + charts[i].Height);
+	}
+
+	CompleteFrame(context);
+}
+
+/**
+ * Wrapped text with all alignments, then multiline text with alignments, using kerning font
+ */
+static void TextScene(Scenes_ContextStruct* context)
+{
+	ClearScreen(context);
+
+	FMGL_API_ColorStruct fontColor = context->Display->ForegroundColor;
+	FMGL_API_ColorStruct accentColor = context->Display->AccentColor;
+	FMGL_API_ColorStruct backgroundColor = context->Display->BackgroundColor;
+	FMGL_API_XBMTransparencyMode transparency = FMGL_XBMTransparencyModeTransparentInactive;
+	FMGL_API_FontSettings fontSettings = MakeFontSettings(context->LoadableFont, &fontColor, &backgroundColor, &transparency);
+
+	static const char* text = "AVAILABLE WAVEFORMS: To, Ty, Yo. Humidity is 45%, pressure is 1013 hPa. Широкая электрификация южных губерний";
+
+	uint16_t width = FMGL_API_GetDisplayWidth(context->Fmgl);
+	uint16_t textWidth;
+	uint16_t textHeight;
+	uint16_t y = 0;
+
+	static const FMGL_API_TextAlignment alignments[] = { FMGL_TextAlignmentLeft, FMGL_TextAlignmentCenter, FMGL_TextAlignmentRight };
+
+	for (uint8_t i = 0; i < sizeof(alignments) / sizeof(alignments[0]); i++)
+	{
+		fontSettings.FontColor = (1 == i) ? &accentColor : &fontColor;
+
+		FMGL_API_RenderTextWrapped(context->Fmgl, &fontSettings, 0, y, width, alignments[i], &textWidth, &textHeight, false, text);
+		y += textHeight + 2;
+
+		if (y >= FMGL_API_GetDisplayHeight(context->Fmgl))
+		{
+			break;
+		}
+	}
+
+	CompleteFrame(context);
+
+	/* Multiline text, aligned within its own width. Second block is taken from layout cache */
+	ClearScreen(context);
+
+	static const char* lines = "Outside\n-12.5°C\nНа улице";
+
+	FMGL_API_RenderTextAligned(context->Fmgl, &fontSettings, 0, 0, FMGL_TextAlignmentCenter, &textWidth, &textHeight, false, lines);
+
+	fontSettings.FontColor = &accentColor;
+	FMGL_API_RenderTextAligned(context->Fmgl, &fontSettings, width - textWidth, textHeight, FMGL_TextAlignmentRight, &textWidth, &textHeight,
+		false, lines);
+
+	CompleteFrame(context);
+}
+
+/**
+ * Encode code point as UTF-8
+ */
+static void EncodeUtf8(uint32_t code, char* buffer)
+{
+	if (code < 0x80)
+	{
+		buffer[0] = code;
+		buffer[1] = '\0';
+	}
+	else if (code < 0x800)
+	{
+		buffer[0] = 0xC0 | (code >> 6);
+		buffer[1] = 0x80 | (code & 0x3F);
+		buffer[2] = '\0';
+	}
+	else if (code < 0x10000)
+	{
+		buffer[0] = 0xE0 | (code >> 12);
+		buffer[1] = 0x80 | ((code >> 6) & 0x3F);
+		buffer[2] = 0x80 | (code & 0x3F);
+		buffer[3] = '\0';
+	}
+	else
+	{
+		buffer[0] = 0xF0 | (code >> 18);
+		buffer[1] = 0x80 | ((code >> 12) & 0x3F);
+		buffer[2] = 0x80 | ((code >> 6) & 0x3F);
+		buffer[3] = 0x80 | (code & 0x3F);
+		buffer[4] = '\0';
+	}
+}
+
+/**
+ * Glyphs sheets drawing state
+ */
+typedef struct
+{
+	Scenes_ContextStruct* Context;
+	FMGL_API_FontSettings* FontSettings;
+	uint16_t X;
+	uint16_t Y;
+	bool IsPageEmpty;
+}
+GlyphsSheetStruct;
+
+static void StartGlyphsSheet(GlyphsSheetStruct* sheet)
+{
+	ClearScreen(sheet->Context);
+
+	sheet->X = 0;
+	sheet->Y = 0;
+	sheet->IsPageEmpty = true;
+}
+
+/**
+ * Draw glyph on sheet, glyphs are flowing left to right, top to bottom. When page is full, it is completed and new one
+ * is started
+ */
+static void DrawGlyph(GlyphsSheetStruct* sheet, uint32_t code)
+{
+	FMGL_API_DriverContext* fmgl = sheet->Context->Fmgl;
+	FMGL_API_Font* font = sheet->FontSettings->Font;
+	uint16_t glyphWidth = font->GetCharacterWidth(font->Context, code);
+	uint16_t lineHeight = font->Height + SCENES_GLYPHS_GAP;
+
+	if (sheet->X + glyphWidth > FMGL_API_GetDisplayWidth(fmgl))
+	{
+		sheet->X = 0;
+		sheet->Y += lineHeight;
+	}
+
+	if (sheet->Y + lineHeight > FMGL_API_GetDisplayHeight(fmgl))
+	{
+		CompleteFrame(sheet->Context);
+		StartGlyphsSheet(sheet);
+	}
+
+	char character[5];
+	EncodeUtf8(code, character);
+
+	uint16_t width;
+	FMGL_API_RenderOneLineDumb(fmgl, sheet->FontSettings, sheet->X, sheet->Y, &width, false, character);
+
+	sheet->X += glyphWidth + SCENES_GLYPHS_GAP;
+	sheet->IsPageEmpty = false;
+}
+
+static void CompleteGlyphsSheet(GlyphsSheetStruct* sheet)
+{
+	if (!sheet->IsPageEmpty)
+	{
+		CompleteFrame(sheet->Context);
+	}
+}
+
+/**
+ * Every glyph of builtin font
+ */
+static void BuiltinGlyphsScene(Scenes_ContextStruct* context)
+{
+	FMGL_API_ColorStruct fontColor = context->Display->ForegroundColor;
+	FMGL_API_ColorStruct backgroundColor = context->Display->BackgroundColor;
+	FMGL_API_XBMTransparencyMode transparency = FMGL_XBMTransparencyModeNormal;
+	FMGL_API_FontSettings fontSettings = MakeFontSettings(context->BuiltinFont, &fontColor, &backgroundColor, &transparency);
+
+	GlyphsSheetStruct sheet;
+	sheet.Context = context;
+	sheet.FontSettings = &fontSettings;
+	StartGlyphsSheet(&sheet);
+
+	for (uint32_t code = FMGL_FONT_TERMINUS_REGULAR_12_FIRST_CHARACTER_CODE; code < FMGL_FONT_TERMINUS_REGULAR_12_FIRST_NON_ASCII_CHARACTER_CODE; code++)
+	{
+		DrawGlyph(&sheet, code);
+	}
+
+	for (uint16_t i = 0; i < FMGL_FONT_TERMINUS_REGULAR_12_UNICODE_TABLE_LENGTH; i++)
+	{
+		DrawGlyph(&sheet, FMGL_FontTerminusRegular12UnicodeToKoi8R[i].CodePoint);
+	}
+
+	DrawGlyph(&sheet, SCENES_MISSING_CHARACTER);
+
+	CompleteGlyphsSheet(&sheet);
+}
+
+/**
+ * Every glyph of loadable font. Font has more glyphs than metrics and rasters caches keep
+ */
+static void LoadableGlyphsScene(Scenes_ContextStruct* context)
+{
+	FMGL_API_ColorStruct fontColor = context->Display->ForegroundColor;
+	FMGL_API_ColorStruct backgroundColor = context->Display->BackgroundColor;
+	FMGL_API_XBMTransparencyMode transparency = FMGL_XBMTransparencyModeNormal;
+	FMGL_API_FontSettings fontSettings = MakeFontSettings(context->LoadableFont, &fontColor, &backgroundColor, &transparency);
+
+	GlyphsSheetStruct sheet;
+	sheet.Context = context;
+	sheet.FontSettings = &fontSettings;
+	StartGlyphsSheet(&sheet);
+
+	FMGL_LoadableFont_ContextStruct* font = context->LoadableFontContext;
+
+	for (uint16_t range = 0; range < font->CodeRangesCount; range++)
+	{
+		for (uint16_t i = 0; i < font->CodeRanges[range].Count; i++)
+		{
+			uint32_t code = font->CodeRanges[range].FirstCode + i;
+
+			/* Code 0 can't be in string, it is shown for missing characters */
+			if (0 != code)
+			{
+				DrawGlyph(&sheet, code);
+			}
+		}
+	}
+
+	DrawGlyph(&sheet, SCENES_MISSING_CHARACTER);
+
+	CompleteGlyphsSheet(&sheet);
+}
+
+/**
+ * Layers: masked sprite over pattern with background saved under it, then sprite is moved and background is restored.
+ * Captured text is drawn transparent, opaque and clipped
+ */
+static void LayersScene(Scenes_ContextStruct* context)
+{
+	ClearScreen(context);
+
+	FMGL_API_ColorStruct foregroundColor = context->Display->ForegroundColor;
+	FMGL_API_ColorStruct backgroundColor = context->Display->BackgroundColor;
+	FMGL_API_ColorStruct accentColor = context->Display->AccentColor;
+	FMGL_API_XBMTransparencyMode transparency = FMGL_XBMTransparencyModeNormal;
+	FMGL_API_FontSettings fontSettings = MakeFontSettings(context->LoadableFont, &foregroundColor, &backgroundColor, &transparency);
+
+	uint16_t width = FMGL_API_GetDisplayWidth(context->Fmgl);
+	uint16_t height = FMGL_API_GetDisplayHeight(context->Fmgl);
+	uint16_t spriteSize = ThermometerIcon.Width;
+
+	FMGL_Layers_ResetStorage(context->LayersStorage);
+
+	/* Text layer */
+	uint16_t textWidth;
+	uint16_t textHeight;
+	FMGL_API_RenderTextWithLineBreaks(context->Fmgl, &fontSettings, 0, 0, &textWidth, &textHeight, false, "Layers Слои");
+
+	textWidth = MIN(textWidth, width);
+	FMGL_Layers_LayerStruct text = FMGL_Layers_Create(context->LayersStorage, textWidth, textHeight, false);
+	FMGL_Layers_CaptureImage(&text, context->Fmgl, 0, 0, backgroundColor);
+
+	/* Checkerboard background */
+	ClearScreen(context);
+
+	for (uint16_t y = 0; y < height; y += 8)
+	{
+		for (uint16_t x = (y / 8 % 2) * 8; x < width; x += 16)
+		{
+			FMGL_API_DrawRectangleFilled(context->Fmgl, x, y, MIN(x + 7, width - 1), MIN(y + 7, height - 1), foregroundColor, foregroundColor);
+		}
+	}
+
+	FMGL_Layers_Draw(&text, context->Fmgl, 4, height / 2, accentColor, backgroundColor, FMGL_XBMTransparencyModeTransparentInactive);
+
+	uint16_t opaqueTextY = MIN(height / 2 + textHeight, height - 1);
+	FMGL_Layers_Draw(&text, context->Fmgl, 4, opaqueTextY, foregroundColor, backgroundColor, FMGL_XBMTransparencyModeNormal);
+
+	/* Sprite, background under it is saved first */
+	FMGL_Layers_LayerStruct sprite = FMGL_Layers_Create(context->LayersStorage, spriteSize, spriteSize, true);
+	FMGL_Layers_LoadImage(&sprite, &ThermometerIcon, &ThermometerMask);
+
+	uint16_t spriteX = width / 2;
+	uint16_t spriteY = 4;
+
+	FMGL_Layers_LayerStruct savedBackground = FMGL_Layers_Create(context->LayersStorage, spriteSize, spriteSize, false);
+	FMGL_Layers_CaptureImage(&savedBackground, context->Fmgl, spriteX, spriteY, backgroundColor);
+
+	FMGL_Layers_Draw(&sprite, context->Fmgl, spriteX, spriteY, accentColor, backgroundColor, FMGL_XBMTransparencyModeNormal);
+
+	/* Partially off screen */
+	FMGL_Layers_Draw(&sprite, context->Fmgl, width - spriteSize / 2, height - spriteSize / 2, accentColor, backgroundColor,
+		FMGL_XBMTransparencyModeNormal);
+
+	CompleteFrame(context);
+
+	/* Moving sprite */
+	FMGL_Layers_Draw(&savedBackground, context->Fmgl, spriteX, spriteY, foregroundColor, backgroundColor, FMGL_XBMTransparencyModeNormal);
+
+	spriteX += 3 * spriteSize / 2;
+	FMGL_Layers_Draw(&sprite, context->Fmgl, spriteX, spriteY, accentColor, backgroundColor, FMGL_XBMTransparencyModeNormal);
+
+	/* Text, clipped by left half of screen */
+	FMGL_API_PushClipRegion(context->Fmgl, 0, 0, width / 2 - 1, height - 1);
+	FMGL_Layers_Draw(&text, context->Fmgl, width / 2 - textWidth / 2, height / 4, foregroundColor, backgroundColor,
+		FMGL_XBMTransparencyModeNormal);
+	FMGL_API_PopClipRegion(context->Fmgl);
+
+	CompleteFrame(context);
+}
+
+const Scenes_SceneStruct Scenes_Scenes[] =
+{
+	{ "console", &ConsoleScene },
+	{ "dashboard", &DashboardScene },
+	{ "charts", &ChartsScene },
+	{ "text", &TextScene },
+	{ "glyphs-builtin", &BuiltinGlyphsScene },
+	{ "glyphs-loadable", &LoadableGlyphsScene },
+	{ "layers", &LayersScene }
+};
+
+const uint8_t Scenes_Count = sizeof(Scenes_Scenes) / sizeof(Scenes_Scenes[0]);